@@ -12,7 +12,6 @@
 #include <memory>
 
 #include "debug.h"
-#include "interp.h"
 
 const SpeciesEnum& XsecRecord::Species() const { return mspecies; };
 
@@ -84,99 +83,87 @@ void XsecRecord::Extract(VectorView result,
                          const Vector& f_grid,
                          const Numeric pressure,
                          const Numeric temperature) const {
+  ARTS_ASSERT(result.nelem() == f_grid.nelem())
+
+  Prepare(pressure, temperature).Extract(result, f_grid);
+}
+
+XsecRecord::Prepared XsecRecord::Prepare(const Numeric pressure,
+                                         const Numeric temperature) const {
+  return {*this, pressure, temperature};
+}
+
+XsecRecord::Prepared::Prepared(const XsecRecord& record,
+                               const Numeric pressure,
+                               const Numeric temperature)
+    : mrecord(&record), mfits(record.mfitcoeffs.size()) {
+  for (Size i = 0; i < mfits.size(); i++) {
+    mfits[i].resize(record.mfitcoeffs[i].grid<0>().nelem());
+    record.CalcXsec(mfits[i], i, pressure, temperature);
+    RemoveNegativeXsec(mfits[i]);
+  }
+}
+
+namespace {
+//! Linear interpolation of y at f between x[j] and x[j + 1]
+Numeric interp_linear(const Vector& x,
+                      const Vector& y,
+                      const Index j,
+                      const Numeric f) {
+  return y[j] * (f - x[j + 1]) / (x[j] - x[j + 1]) +
+         y[j + 1] * (f - x[j]) / (x[j + 1] - x[j]);
+}
+}  // namespace
+
+void XsecRecord::Prepared::Extract(VectorView result,
+                                   const ConstVectorView& f_grid) const {
   const Index nf = f_grid.nelem();
 
   ARTS_ASSERT(result.nelem() == nf)
 
   result = 0.;
 
-  const Index ndatasets = mfitcoeffs.size();
-  for (Index this_dataset_i = 0; this_dataset_i < ndatasets; this_dataset_i++) {
-    const Vector& data_f_grid = mfitcoeffs[this_dataset_i].grid<0>();
+  // We want to return result zero for all f_grid points that are outside the
+  // data_f_grid, because xsec datasets are defined only where the absorption
+  // was measured.
+  for (Size d = 0; d < mfits.size(); d++) {
+    const Vector& data_f_grid = mrecord->mfitcoeffs[d].grid<0>();
+    const Index n             = data_f_grid.nelem();
+    if (n < 2) continue;
+
     const Numeric data_fmin   = data_f_grid[0];
-    const Numeric data_fmax   = data_f_grid[data_f_grid.nelem() - 1];
-
-    // We want to return result zero for all f_grid points that are outside the
-    // data_f_grid, because xsec datasets are defined only where the absorption
-    // was measured. So, we have to find out which part of f_grid is inside
-    // data_f_grid.
-    const Numeric* f_grid_begin = f_grid.data_handle();
-    const Numeric* f_grid_end   = f_grid_begin + f_grid.nelem();
-    const Index i_fstart        = std::distance(
-        f_grid_begin, std::lower_bound(f_grid_begin, f_grid_end, data_fmin));
-    const Index i_fstop =
-        std::distance(
-            f_grid_begin,
-            std::upper_bound(f_grid_begin + i_fstart, f_grid_end, data_fmax)) -
-        1;
-
-    // Ignore band if all frequencies are below or above data_f_grid:
-    if (i_fstart == nf || i_fstop == -1) continue;
-
-    const Index f_extent = i_fstop - i_fstart + 1;
-
-    // If f_extent is less than one, then the entire data_f_grid is between two
-    // grid points of f_grid. (So that we do not have any f_grid points inside
-    // data_f_grid.) Return also in this case.
-    if (f_extent < 1) continue;
-
-    // This is the part of f_grid that lies inside the xsec band
-    const ConstVectorView f_grid_active = f_grid[Range(i_fstart, f_extent)];
-
-    // Determine the index of the first grid points in the xsec band that lie
-    // outside or on the boundary of the part of f_grid that lies inside the
-    // xsec band. We can ignore the remaining data.
-    const Numeric f_grid_fmin = f_grid[i_fstart];
-    const Numeric f_grid_fmax = f_grid[i_fstop];
-
-    const Numeric* data_f_grid_begin = data_f_grid.data_handle();
-    const Numeric* data_f_grid_end = data_f_grid_begin + data_f_grid.size() - 1;
-    const Index i_data_fstart =
-        std::distance(
-            data_f_grid_begin,
-            std::upper_bound(data_f_grid_begin, data_f_grid_end, f_grid_fmin)) -
-        1;
-    const Index i_data_fstop = std::distance(
-        data_f_grid_begin,
-        std::upper_bound(
-            data_f_grid_begin + i_data_fstart, data_f_grid_end, f_grid_fmax));
-
-    ARTS_ASSERT(i_data_fstart >= 0)
-    ARTS_ASSERT(f_grid[i_fstart] > data_f_grid[i_data_fstart])
-    ARTS_ASSERT(f_grid[i_fstart] < data_f_grid[i_data_fstart + 1])
-    ARTS_ASSERT(f_grid[i_fstop] < data_f_grid[i_data_fstop])
-    ARTS_ASSERT(f_grid[i_fstop] > data_f_grid[i_data_fstop - 1])
-
-    // Extent for active data frequency vector:
-    const Index data_f_extent = i_data_fstop - i_data_fstart + 1;
-
-    // This is the part of the xsec dataset for which we have to do the
-    // interpolation.
-    const Range active_range(i_data_fstart, data_f_extent);
-    const ConstVectorView data_f_grid_active = data_f_grid[active_range];
-
-    Vector fit_result(data_f_grid.nelem());
-    VectorView fit_result_active = fit_result[active_range];
-
-    // We have to create a matching view on the result vector:
-    VectorView result_active = result[Range(i_fstart, f_extent)];
-    Vector xsec_interp(f_extent);
-
-    CalcXsec(fit_result, this_dataset_i, pressure, temperature);
-
-    RemoveNegativeXsec(fit_result);
-
-    {
-      const auto f_gp =
-          my_interp::lagrange_interpolation_list<FixedLagrangeInterpolation<1>>(
-              data_f_grid_active, f_grid_active, 0.5, "Frequency");
-      const auto f_itw = interpweights(f_gp);
-      // Find frequency grid positions:
-      my_interp::reinterp(xsec_interp, fit_result_active, f_itw, f_gp);
+    const Numeric data_fmax   = data_f_grid[n - 1];
+
+    Index i = std::distance(
+        f_grid.begin(),
+        std::lower_bound(f_grid.begin(), f_grid.end(), data_fmin));
+    for (Index j = 0; i < nf and f_grid[i] <= data_fmax; i++) {
+      while (j < n - 2 and data_f_grid[j + 1] <= f_grid[i]) j++;
+      result[i] += interp_linear(data_f_grid, mfits[d], j, f_grid[i]);
     }
+  }
+}
 
-    result_active += xsec_interp;
+Numeric XsecRecord::Prepared::At(const Numeric frequency) const {
+  Numeric out = 0.;
+
+  for (Size d = 0; d < mfits.size(); d++) {
+    const Vector& data_f_grid = mrecord->mfitcoeffs[d].grid<0>();
+    const Index n             = data_f_grid.nelem();
+    if (n < 2 or frequency < data_f_grid[0] or frequency > data_f_grid[n - 1])
+      continue;
+
+    const Index j = std::clamp<Index>(
+        std::distance(data_f_grid.begin(),
+                      std::upper_bound(
+                          data_f_grid.begin(), data_f_grid.end(), frequency)) -
+            1,
+        0,
+        n - 2);
+    out += interp_linear(data_f_grid, mfits[d], j, frequency);
   }
+
+  return out;
 }
 
 void XsecRecord::CalcXsec(VectorView xsec,
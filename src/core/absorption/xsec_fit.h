@@ -12,6 +12,7 @@
 #include <matpack.h>
 
 #include <memory>
+#include <vector>
 
 #include "array.h"
 #include "mystring.h"
@@ -54,6 +55,44 @@ class XsecRecord {
                Numeric pressure,
                Numeric temperature) const;
 
+  /** Hitran cross section fits evaluated for one pressure and temperature.
+
+     The fit of every dataset is evaluated once, after which cross sections
+     at any frequency are only an interpolation of the fitted data.  Gives the
+     same result as Extract, which is implemented using this.
+     */
+  class Prepared {
+    const XsecRecord* mrecord{};
+    std::vector<Vector> mfits{};
+
+   public:
+    Prepared() = default;
+
+    /** Evaluate the fits.
+
+       \param[in] record      The data, must outlive this object.
+       \param[in] pressure    Scalar pressure.
+       \param[in] temperature Scalar temperature.
+       */
+    Prepared(const XsecRecord& record, Numeric pressure, Numeric temperature);
+
+    /** Calculate cross sections for an ascending frequency grid.
+
+       The frequency grid and each data grid are swept together, so there is
+       only a single search per dataset.
+
+       \param[out] result Crosssections for given frequency grid.
+       \param[in] f_grid  Frequency grid.
+       */
+    void Extract(VectorView result, const ConstVectorView& f_grid) const;
+
+    /** Calculate the cross section at a single frequency. */
+    [[nodiscard]] Numeric At(Numeric frequency) const;
+  };
+
+  /** Evaluate the fits for given pressure and temperature. */
+  [[nodiscard]] Prepared Prepare(Numeric pressure, Numeric temperature) const;
+
   /************ VERSION 2 *************/
   /** Get mininum pressures from fit */
   [[nodiscard]] const Vector& FitMinPressures() const ;
@@ -1131,8 +1131,9 @@ std::pair<Numeric, Numeric> main_data::flux_down(flux_data& data,
 void main_data::gridded_flux(ExhaustiveVectorView flux_up,
                              ExhaustiveVectorView flux_do,
                              ExhaustiveVectorView flux_dd) const try {
-  Vector u0(NQuad);
-  Vector exponent(NQuad, 1);
+  const matpack::arena_scope scope;
+  matpack::arena_data<Numeric, 1> u0(NQuad);
+  matpack::arena_data<Numeric, 1> exponent(NQuad, 1);
   mathscr_v_data src(NQuad, Nscoeffs);
 
   for (Index l = 0; l < NLayers; l++) {
@@ -1181,12 +1182,13 @@ void main_data::gridded_flux(ExhaustiveVectorView flux_up,
 ARTS_METHOD_ERROR_CATCH
 
 void main_data::gridded_u(ExhaustiveTensor3View out, const Vector& phi) const {
-  Matrix exponent(NFourier, NQuad, 1);
-  Matrix um(NFourier, NQuad);
+  const matpack::arena_scope scope;
+  matpack::arena_data<Numeric, 2> exponent(NFourier, NQuad, 1);
+  matpack::arena_data<Numeric, 2> um(NFourier, NQuad);
   mathscr_v_data src(NQuad, Nscoeffs);
 
   const Index Nphi = phi.size();
-  Matrix cp(Nphi, NFourier);
+  matpack::arena_data<Numeric, 2> cp(Nphi, NFourier);
   for (Index p = 0; p < phi.size(); p++) {
     for (Index m = 0; m < NFourier; m++) {
       cp(p, m) = I0_orig * std::cos(static_cast<Numeric>(m) * (phi0 - phi[p]));
@@ -1248,8 +1250,9 @@ void main_data::ungridded_flux(ExhaustiveVectorView flux_up,
                      tau.back(),
                      tau_arr.back());
 
-  Vector u0(NQuad);
-  Vector exponent(NQuad, 1);
+  const matpack::arena_scope scope;
+  matpack::arena_data<Numeric, 1> u0(NQuad);
+  matpack::arena_data<Numeric, 1> exponent(NQuad, 1);
   mathscr_v_data src(NQuad, Nscoeffs);
 
   Index l = tau_index(tau.front());
@@ -1314,12 +1317,13 @@ void main_data::ungridded_u(ExhaustiveTensor3View out,
                      tau.back(),
                      tau_arr.back());
 
-  Matrix exponent(NFourier, NQuad, 1);
-  Matrix um(NFourier, NQuad);
+  const matpack::arena_scope scope;
+  matpack::arena_data<Numeric, 2> exponent(NFourier, NQuad, 1);
+  matpack::arena_data<Numeric, 2> um(NFourier, NQuad);
   mathscr_v_data src(NQuad, Nscoeffs);
 
   const Index Nphi = phi.size();
-  Matrix cp(Nphi, NFourier);
+  matpack::arena_data<Numeric, 2> cp(Nphi, NFourier);
   for (Index p = 0; p < phi.size(); p++) {
     for (Index m = 0; m < NFourier; m++) {
       cp(p, m) = I0_orig * std::cos(static_cast<Numeric>(m) * (phi0 - phi[p]));
@@ -30,6 +30,7 @@ Complex full::single::at(const Numeric frequency) const {
 
 void full::adapt() try {
   models.resize(0);
+  cache = {};
 
   if (not ciarecords) {
     return;
@@ -49,6 +50,19 @@ void full::adapt() try {
     models.emplace_back(
         atm->pressure, atm->temperature, VMR1, VMR2, &data, extrap, robust);
   }
+
+  if (cache_tolerance > 0.0) {
+    cache = continuum_cache(
+        [this](const Vector& f) {
+          std::vector<Complex> out(f.size());
+          std::ranges::transform(
+              f, out.begin(), [this](Numeric x) { return compute(x); });
+          return out;
+        },
+        cache_range,
+        cache_tolerance,
+        cache_start_nodes);
+  }
 }
 ARTS_METHOD_ERROR_CATCH
 
@@ -63,7 +77,7 @@ full::full(std::shared_ptr<AtmPoint> atm_,
   adapt();
 }
 
-Complex full::operator()(const Numeric frequency) const {
+Complex full::compute(const Numeric frequency) const {
   return std::transform_reduce(
       models.begin(),
       models.end(),
@@ -72,6 +86,14 @@ Complex full::operator()(const Numeric frequency) const {
       [f = frequency](auto& mod) { return mod.at(f); });
 }
 
+Complex full::operator()(const Numeric frequency) const {
+  if (cache.contains(frequency)) {
+    return cache(frequency);
+  }
+
+  return compute(frequency);
+}
+
 void full::set_extrap(Numeric extrap_) {
   extrap = extrap_;
   adapt();
@@ -91,4 +113,11 @@ void full::set_atm(std::shared_ptr<AtmPoint> atm_) {
   atm = std::move(atm_);
   adapt();
 }
+
+void full::set_cache(Vector2 range, Numeric tolerance, Index start_nodes) {
+  cache_range       = range;
+  cache_tolerance   = tolerance;
+  cache_start_nodes = start_nodes;
+  adapt();
+}
 }  // namespace fwd::cia
@@ -6,6 +6,8 @@
 #include <memory>
 #include <vector>
 
+#include "fwd_continuum.h"
+
 namespace fwd::cia {
 class full {
   struct single {
@@ -39,8 +41,15 @@ class full {
 
   std::vector<single> models{};
 
+  Vector2 cache_range{};
+  Numeric cache_tolerance{0.0};
+  Index cache_start_nodes{33};
+  continuum_cache cache{};
+
   void adapt();
 
+  [[nodiscard]] Complex compute(const Numeric frequency) const;
+
  public:
   full() = default;
   full(const full&) = default;
@@ -59,5 +68,8 @@ class full {
   void set_robust(Index robust);
   void set_model(std::shared_ptr<ArrayOfCIARecord> cia);
   void set_atm(std::shared_ptr<AtmPoint> atm);
+
+  //! Interpolate inside the range, a non-positive tolerance turns this off
+  void set_cache(Vector2 range, Numeric tolerance, Index start_nodes);
 };
 }  // namespace fwd::cia
@@ -0,0 +1,87 @@
+#include "fwd_continuum.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "debug.h"
+
+namespace fwd {
+continuum_cache::continuum_cache(const model& fun,
+                                 const Vector2 frequency_range,
+                                 const Numeric tolerance,
+                                 const Index start_nodes,
+                                 const Index max_depth) try {
+  const auto [f0, f1] = frequency_range;
+  ARTS_USER_ERROR_IF(not(f0 < f1), "Bad frequency range [{}, {}]", f0, f1)
+  ARTS_USER_ERROR_IF(
+      tolerance <= 0.0, "The tolerance must be positive: {}", tolerance)
+  ARTS_USER_ERROR_IF(
+      start_nodes < 2, "Must start with at least 2 nodes: {}", start_nodes)
+
+  struct interval {
+    Numeric fa, fb;
+    Complex ya, yb;
+  };
+
+  Vector fs(start_nodes);
+  for (Index i = 0; i < start_nodes; i++) {
+    fs[i] = f0 + (f1 - f0) * static_cast<Numeric>(i) /
+                     static_cast<Numeric>(start_nodes - 1);
+  }
+  const std::vector<Complex> ys = fun(fs);
+  ARTS_ASSERT(ys.size() == fs.size())
+
+  Numeric scale = 0.0;
+  for (auto& x : ys) scale = std::max(scale, std::abs(x));
+  const Numeric atol = tolerance * scale;
+
+  std::vector<std::pair<Numeric, Complex>> nodes;
+  std::vector<interval> pending;
+  for (Index i = 0; i < start_nodes; i++) {
+    nodes.emplace_back(fs[i], ys[i]);
+    if (i > 0) pending.push_back({fs[i - 1], fs[i], ys[i - 1], ys[i]});
+  }
+
+  for (Index depth = 0; depth < max_depth and not pending.empty(); depth++) {
+    Vector fm(pending.size());
+    for (Size i = 0; i < pending.size(); i++) {
+      fm[i] = 0.5 * (pending[i].fa + pending[i].fb);
+    }
+    const std::vector<Complex> ym = fun(fm);
+    ARTS_ASSERT(ym.size() == pending.size())
+
+    std::vector<interval> next;
+    for (Size i = 0; i < pending.size(); i++) {
+      const auto& [fa, fb, ya, yb] = pending[i];
+      nodes.emplace_back(fm[i], ym[i]);
+      if (std::abs(ym[i] - 0.5 * (ya + yb)) > atol) {
+        next.push_back({fa, fm[i], ya, ym[i]});
+        next.push_back({fm[i], fb, ym[i], yb});
+      }
+    }
+    pending = std::move(next);
+  }
+
+  std::ranges::sort(nodes, {}, &std::pair<Numeric, Complex>::first);
+  f.reserve(nodes.size());
+  y.reserve(nodes.size());
+  for (auto& [fn, yn] : nodes) {
+    f.push_back(fn);
+    y.push_back(yn);
+  }
+}
+ARTS_METHOD_ERROR_CATCH
+
+bool continuum_cache::contains(const Numeric frequency) const {
+  return f.size() > 1 and f.front() <= frequency and frequency <= f.back();
+}
+
+Complex continuum_cache::operator()(const Numeric frequency) const {
+  ARTS_ASSERT(contains(frequency))
+
+  const Size n    = std::ranges::upper_bound(f, frequency) - f.begin();
+  const Size i    = std::clamp<Size>(n, 1, f.size() - 1) - 1;
+  const Numeric t = (frequency - f[i]) / (f[i + 1] - f[i]);
+  return y[i] + t * (y[i + 1] - y[i]);
+}
+}  // namespace fwd
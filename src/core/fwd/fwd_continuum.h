@@ -0,0 +1,47 @@
+#pragma once
+
+#include <matpack.h>
+
+#include <functional>
+#include <vector>
+
+namespace fwd {
+/** A piecewise linear interpolant of slowly varying absorption
+ *
+ * The nodes start evenly spaced over the frequency range.  Each interval is
+ * bisected until the linear interpolation at its middle is within the
+ * tolerance, relative to the largest absolute value at the starting nodes, or
+ * until it has been bisected max_depth times.  All evaluated middles are kept
+ * as nodes.
+ *
+ * Features narrower than the starting spacing may be missed entirely, so the
+ * model should be smooth on that scale.
+ */
+class continuum_cache {
+  std::vector<Numeric> f{};
+  std::vector<Complex> y{};
+
+ public:
+  //! Computes the model at all frequencies of a grid
+  using model = std::function<std::vector<Complex>(const Vector&)>;
+
+  continuum_cache()                                  = default;
+  continuum_cache(const continuum_cache&)            = default;
+  continuum_cache(continuum_cache&&)                 = default;
+  continuum_cache& operator=(const continuum_cache&) = default;
+  continuum_cache& operator=(continuum_cache&&)      = default;
+
+  continuum_cache(const model& fun,
+                  const Vector2 frequency_range,
+                  const Numeric tolerance,
+                  const Index start_nodes = 33,
+                  const Index max_depth   = 20);
+
+  //! Whether or not the frequency can be interpolated
+  [[nodiscard]] bool contains(const Numeric frequency) const;
+
+  [[nodiscard]] Complex operator()(const Numeric frequency) const;
+
+  [[nodiscard]] Size size() const { return f.size(); }
+};
+}  // namespace fwd
@@ -4,12 +4,10 @@
 
 namespace fwd::hxsec {
 full::single::single(Numeric p, Numeric t, Numeric VMR, XsecRecord* xsec)
-    : scl{number_density(p, t) * VMR}, P{p}, T{t}, xsecrec{xsec} {}
+    : scl{number_density(p, t) * VMR}, fit{xsec->Prepare(p, t)} {}
 
 Complex full::single::at(const Numeric frequency) const {
-  Numeric out{};
-  xsecrec->Extract(ExhaustiveVectorView{out}, Vector{frequency}, P, T);
-  return scl * out;
+  return scl * fit.At(frequency);
 }
 
 void full::adapt() try {
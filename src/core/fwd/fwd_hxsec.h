@@ -11,9 +11,7 @@ namespace fwd::hxsec {
 class full {
   struct single {
     Numeric scl{};
-    Numeric P{};
-    Numeric T{};
-    XsecRecord* xsecrec{};
+    XsecRecord::Prepared fit{};
 
     single() = default;
     single(const single&) = default;
@@ -8,6 +8,8 @@ namespace fwd::predef {
 void full::adapt() try {
   ARTS_USER_ERROR_IF(not atm, "Must have an atmosphere")
 
+  cache = {};
+
   if (not data) {
     return;
   }
@@ -17,6 +19,13 @@ void full::adapt() try {
   }
 
   vmrs = Absorption::PredefinedModel::VMRS(*atm);
+
+  if (cache_tolerance > 0.0) {
+    cache = continuum_cache([this](const Vector& f) { return compute(f); },
+                            cache_range,
+                            cache_tolerance,
+                            cache_start_nodes);
+  }
 }
 ARTS_METHOD_ERROR_CATCH
 
@@ -26,15 +35,10 @@ full::full(std::shared_ptr<AtmPoint> atm_,
   adapt();
 }
 
-Complex full::operator()(const Numeric frequency) const {
-  if (not data) {
-    return {};
-  }
-
-  PropmatVector propmat_clearsky(1);
+std::vector<Complex> full::compute(const Vector& f_grid) const {
+  PropmatVector propmat_clearsky(f_grid.size());
   PropmatMatrix dpropmat_clearsky_dx;
   JacobianTargets jacobian_targets;
-  Vector f_grid{frequency};
 
   for (auto& [tag, mod] : data->data) {
     Absorption::PredefinedModel::compute(propmat_clearsky,
@@ -48,7 +52,21 @@ Complex full::operator()(const Numeric frequency) const {
                                          mod);
   }
 
-  return propmat_clearsky[0].A();
+  std::vector<Complex> out(f_grid.size());
+  for (Index i = 0; i < f_grid.size(); i++) out[i] = propmat_clearsky[i].A();
+  return out;
+}
+
+Complex full::operator()(const Numeric frequency) const {
+  if (not data) {
+    return {};
+  }
+
+  if (cache.contains(frequency)) {
+    return cache(frequency);
+  }
+
+  return compute(Vector{frequency}).front();
 }
 
 void full::set_model(std::shared_ptr<PredefinedModelData> data_) {
@@ -60,4 +78,11 @@ void full::set_atm(std::shared_ptr<AtmPoint> atm_) {
   atm = std::move(atm_);
   adapt();
 }
+
+void full::set_cache(Vector2 range, Numeric tolerance, Index start_nodes) {
+  cache_range       = range;
+  cache_tolerance   = tolerance;
+  cache_start_nodes = start_nodes;
+  adapt();
+}
 }  // namespace fwd::predef
@@ -5,14 +5,23 @@
 
 #include <memory>
 
+#include "fwd_continuum.h"
+
 namespace fwd::predef {
 class full {
   Absorption::PredefinedModel::VMRS vmrs;
   std::shared_ptr<AtmPoint> atm;
   std::shared_ptr<PredefinedModelData> data;
 
+  Vector2 cache_range{};
+  Numeric cache_tolerance{0.0};
+  Index cache_start_nodes{33};
+  continuum_cache cache{};
+
   void adapt();
 
+  [[nodiscard]] std::vector<Complex> compute(const Vector& f_grid) const;
+
  public:
   full() = default;
   full(const full&) = default;
@@ -27,5 +36,8 @@ class full {
 
   void set_model(std::shared_ptr<PredefinedModelData> data);
   void set_atm(std::shared_ptr<AtmPoint> atm);
+
+  //! Interpolate inside the range, a non-positive tolerance turns this off
+  void set_cache(Vector2 range, Numeric tolerance, Index start_nodes);
 };
 }  // namespace fwd::predef
@@ -20,14 +20,19 @@ propmat::propmat(std::shared_ptr<AtmPoint> atm_,
       predef(atm, std::move(predef_)),
       xsec(atm, std::move(xsec_)) {}
 
-std::pair<Propmat, Stokvec> propmat::operator()(const Numeric f,
-                                                const Vector2 los) const {
+propmat::spectral_parts propmat::parts(const Numeric f) const {
   using namespace lbl::zeeman;
 
   const auto [ano, sno] = lines(f, pol::no);
 
-  const std::array zres{
-      lines(f, pol::sm), lines(f, pol::pi), lines(f, pol::sp)};
+  return {.a = cia(f).real() + predef(f).real() + xsec(f).real() + ano.real(),
+          .s = sno.real(),
+          .z = {lines(f, pol::sm), lines(f, pol::pi), lines(f, pol::sp)}};
+}
+
+std::pair<Propmat, Stokvec> propmat::combine(const spectral_parts& x,
+                                             const Vector2 los) const {
+  using namespace lbl::zeeman;
 
   const std::array zpol{
       norm_view(pol::sm, atm->mag, los),
@@ -38,9 +43,8 @@ std::pair<Propmat, Stokvec> propmat::operator()(const Numeric f,
   return {std::transform_reduce(
               zpol.begin(),
               zpol.end(),
-              zres.begin(),
-              Propmat{cia(f).real() + predef(f).real() + xsec(f).real() +
-                      ano.real()},
+              x.z.begin(),
+              Propmat{x.a},
               std::plus<>(),
               [](const Propmat& a, const std::pair<Complex, Complex>& b) {
                 return scale(a, b.first);
@@ -48,14 +52,19 @@ std::pair<Propmat, Stokvec> propmat::operator()(const Numeric f,
           std::transform_reduce(
               zpol.begin(),
               zpol.end(),
-              zres.begin(),
-              Stokvec{sno.real()},
+              x.z.begin(),
+              Stokvec{x.s},
               std::plus<>(),
               [](const Propmat& a, const std::pair<Complex, Complex>& b) {
                 return absvec(scale(a, b.second));
               })};
 }
 
+std::pair<Propmat, Stokvec> propmat::operator()(const Numeric f,
+                                                const Vector2 los) const {
+  return combine(parts(f), los);
+}
+
 void propmat::set_atm(std::shared_ptr<AtmPoint> atm_) {
   atm = std::move(atm_);
   lines.set_atm(atm);
@@ -83,4 +92,11 @@ void propmat::set_predef(std::shared_ptr<PredefinedModelData> predef_) {
 void propmat::set_model(std::shared_ptr<ArrayOfXsecRecord> xsec_) {
   xsec.set_model(std::move(xsec_));
 }
+
+void propmat::set_continuum_cache(Vector2 range,
+                                  Numeric tolerance,
+                                  Index start_nodes) {
+  cia.set_cache(range, tolerance, start_nodes);
+  predef.set_cache(range, tolerance, start_nodes);
+}
 }  // namespace fwd
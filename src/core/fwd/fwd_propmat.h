@@ -2,6 +2,7 @@
 
 #include <lbl.h>
 
+#include <array>
 #include <memory>
 
 #include "atm.h"
@@ -36,6 +37,24 @@ class propmat {
           Numeric ciaextrap = {},
           Index ciarobust = {});
 
+  //! The parts of the absorption that do not depend on the line of sight
+  struct spectral_parts {
+    //! Unpolarized absorption
+    Numeric a{};
+
+    //! Unpolarized non-LTE source
+    Numeric s{};
+
+    //! Zeeman absorption and non-LTE source for sigma-minus, pi, sigma-plus
+    std::array<std::pair<Complex, Complex>, 3> z{};
+  };
+
+  [[nodiscard]] spectral_parts parts(const Numeric frequency) const;
+
+  //! Combines the parts with the polarization of the line of sight
+  [[nodiscard]] std::pair<Propmat, Stokvec> combine(const spectral_parts& x,
+                                                    const Vector2 los) const;
+
   std::pair<Propmat, Stokvec> operator()(const Numeric frequency,
                                          const Vector2 los) const;
 
@@ -46,5 +65,8 @@ class propmat {
   void set_cia(std::shared_ptr<ArrayOfCIARecord> cia);
   void set_predef(std::shared_ptr<PredefinedModelData> predef);
   void set_model(std::shared_ptr<ArrayOfXsecRecord> xsec);
+
+  //! Interpolate CIA and predefined models, see continuum_cache
+  void set_continuum_cache(Vector2 range, Numeric tolerance, Index start_nodes);
 };  // struct propmat
 }  // namespace fwd
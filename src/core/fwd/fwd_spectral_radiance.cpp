@@ -3,11 +3,15 @@
 #include <path_point.h>
 
 #include <algorithm>
+#include <array>
 #include <memory>
+#include <optional>
 #include <ostream>
 #include <ranges>
+#include <vector>
 
 #include "arts_constants.h"
+#include "arts_conversions.h"
 #include "arts_omp.h"
 #include "configtypes.h"
 #include "debug.h"
@@ -15,14 +19,64 @@
 #include "rtepack.h"
 
 namespace fwd {
+namespace {
+//! The propagation direction of a line of sight as [east, north, up]
+Vector3 propagation_direction(const Vector2 los) {
+  using Conversion::cosd, Conversion::sind;
+
+  const auto [za, aa] = path::mirror(los);
+  return {sind(za) * sind(aa), sind(za) * cosd(aa), cosd(za)};
+}
+
+//! The frequency scaling of the wind, as in frequency_gridWindShift
+Numeric wind_scaling(const Vector3& wind, const Vector3& n) {
+  const Numeric x = 1.0 - (wind[0] * n[0] + wind[1] * n[1] + wind[2] * n[2]) /
+                              Constant::speed_of_light;
+  return std::isnan(x) ? 1.0 : x;
+}
+
+//! The index of the wind component of a key, or -1 if it is not a wind
+Index wind_component(const AtmKeyVal& key) {
+  if (const auto* x = std::get_if<AtmKey>(&key)) {
+    switch (*x) {
+      case AtmKey::wind_u: return 0;
+      case AtmKey::wind_v: return 1;
+      case AtmKey::wind_w: return 2;
+      default:             break;
+    }
+  }
+  return -1;
+}
+
+bool is_temperature(const AtmKeyVal& key) {
+  const auto* x = std::get_if<AtmKey>(&key);
+  return x != nullptr and *x == AtmKey::t;
+}
+
+//! The linear mix (1 - x) a + x b
+template <typename T>
+T mix(const T& a, const T& b, const Numeric x) {
+  T out  = (1.0 - x) * a;
+  out   += x * b;
+  return out;
+}
+}  // namespace
+
 Stokvec spectral_radiance::B(
     const Numeric f,
     const std::array<spectral_radiance::weighted_position, 8>& pos) const {
   Numeric out = 0.0;
 
-  for (const auto& p : pos) {
-    if (p.w == 0.0) continue;
-    out += p.w * planck(f, atm(p.i, p.j, p.k)->temperature);
+  if (const Index iv = baked_index(f); iv >= 0) {
+    for (const auto& p : pos) {
+      if (p.w == 0.0) continue;
+      out += p.w * baked_B(iv, p.i, p.j, p.k);
+    }
+  } else {
+    for (const auto& p : pos) {
+      if (p.w == 0.0) continue;
+      out += p.w * planck(f, atm(p.i, p.j, p.k)->temperature);
+    }
   }
 
   return {out, 0.0, 0.0, 0.0};
@@ -56,9 +110,36 @@ std::pair<Propmat, Stokvec> spectral_radiance::PM(
   std::pair<Propmat, Stokvec> out{Propmat{0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
                                   Stokvec{0.0, 0.0, 0.0, 0.0}};
 
+  if (const Index iv = baked_index(f); iv >= 0) {
+    const bool polarized = not baked_zabs.empty();
+
+    for (const auto& p : pos) {
+      if (p.w == 0.0) continue;
+
+      if (polarized) {
+        propmat::spectral_parts x{.a = baked_a(iv, p.i, p.j, p.k),
+                                  .s = baked_s(iv, p.i, p.j, p.k)};
+        for (Index iz = 0; iz < 3; iz++) {
+          x.z[iz] = {baked_zabs(iv, iz, p.i, p.j, p.k),
+                     baked_zsrc(iv, iz, p.i, p.j, p.k)};
+        }
+
+        const auto [propmat, stokvec] =
+            pm(p.i, p.j, p.k).combine(x, pp.point.los);
+        out.first  += p.w * propmat;
+        out.second += p.w * stokvec;
+      } else {
+        out.first  += p.w * Propmat{baked_a(iv, p.i, p.j, p.k)};
+        out.second += p.w * Stokvec{baked_s(iv, p.i, p.j, p.k)};
+      }
+    }
+
+    return out;
+  }
+
   for (const auto& p : pos) {
     if (p.w == 0.0) continue;
-    const auto [propmat, stokvec]  = pm(p.i, p.j, p.k)(f, pp.point.los);
+    const auto [propmat, stokvec]  = node_PM(f, p, pp);
     out.first                     += p.w * propmat;
     out.second                    += p.w * stokvec;
   }
@@ -66,6 +147,66 @@ std::pair<Propmat, Stokvec> spectral_radiance::PM(
   return out;
 }
 
+std::pair<Propmat, Stokvec> spectral_radiance::node_PM(
+    const Numeric f, const weighted_position& p, const path& pp) const {
+  const Numeric fs =
+      wind_shift ? f * wind_scaling(atm(p.i, p.j, p.k)->wind,
+                                    propagation_direction(pp.point.los))
+                 : f;
+  return pm(p.i, p.j, p.k)(fs, pp.point.los);
+}
+
+void spectral_radiance::dPM(PropmatVectorView dK,
+                            StokvecVectorView dN,
+                            VectorView dB,
+                            const Numeric f,
+                            const weighted_position& p,
+                            const path& pp,
+                            const std::pair<Propmat, Stokvec>& nominal) const {
+  //! Relative frequency step for the wind, well inside any Doppler width
+  constexpr Numeric df_rel = 1e-9;
+
+  const Index nt = static_cast<Index>(jacobian_keys.size());
+  ARTS_ASSERT(dK.size() == nt and dN.size() == nt and dB.size() == nt)
+
+  const Vector2 los    = pp.point.los;
+  const Vector3 n      = propagation_direction(los);
+  const AtmPoint& node = *atm(p.i, p.j, p.k);
+  const propmat& model = pm(p.i, p.j, p.k);
+  const Numeric fs     = wind_shift ? f * wind_scaling(node.wind, n) : f;
+
+  const auto& [K, N] = nominal;
+
+  std::pair<Propmat, Stokvec> dpm_df{};
+  bool has_dpm_df = false;
+
+  for (Index it = 0; it < nt; it++) {
+    const AtmKeyVal& key = jacobian_keys[it];
+
+    if (const Index iw = wind_component(key); iw >= 0) {
+      if (not has_dpm_df) {
+        const Numeric h     = df_rel * fs;
+        const auto [Kp, Np] = model(fs + h, los);
+        const auto [Km, Nm] = model(fs - h, los);
+        dpm_df     = {(0.5 / h) * (Kp - Km), (0.5 / h) * (Np - Nm)};
+        has_dpm_df = true;
+      }
+
+      const Numeric dfs = -f * n[iw] / Constant::speed_of_light;
+      dK[it]            = dfs * dpm_df.first;
+      dN[it]            = dfs * dpm_df.second;
+      dB[it]            = 0.0;
+    } else {
+      const Numeric d     = jacobian_perturbations[it];
+      const auto [Kd, Nd] = jacobian_pm(it, p.i, p.j, p.k)(fs, los);
+
+      dK[it] = (1.0 / d) * (Kd - K);
+      dN[it] = (1.0 / d) * (Nd - N);
+      dB[it] = is_temperature(key) ? dplanck_dt(f, node.temperature) : 0.0;
+    }
+  }
+}
+
 std::array<spectral_radiance::weighted_position, 8>
 spectral_radiance::pos_weights(const path& pp) const {
   std::array<weighted_position, 8> out;
@@ -171,6 +312,209 @@ spectral_radiance::spectral_radiance(
   }
 }
 
+void spectral_radiance::set_continuum_cache(const Vector2 range,
+                                            const Numeric tolerance,
+                                            const Index start_nodes) {
+  unbake();
+
+  String errors{};
+
+#pragma omp parallel for collapse(3) if (not arts_omp_in_parallel())
+  for (Index i = 0; i < alt.size(); i++) {
+    for (Index j = 0; j < lat.size(); j++) {
+      for (Index k = 0; k < lon.size(); k++) {
+        try {
+          pm(i, j, k).set_continuum_cache(range, tolerance, start_nodes);
+        } catch (const std::exception& e) {
+#pragma omp critical
+          errors += e.what();
+        }
+      }
+    }
+  }
+
+  //! The perturbed models must use the same approximations as the nominal
+  const Index nt = static_cast<Index>(jacobian_keys.size());
+
+#pragma omp parallel for collapse(4) if (not arts_omp_in_parallel())
+  for (Index it = 0; it < nt; it++) {
+    for (Index i = 0; i < alt.size(); i++) {
+      for (Index j = 0; j < lat.size(); j++) {
+        for (Index k = 0; k < lon.size(); k++) {
+          if (wind_component(jacobian_keys[it]) >= 0) continue;
+
+          try {
+            jacobian_pm(it, i, j, k)
+                .set_continuum_cache(range, tolerance, start_nodes);
+          } catch (const std::exception& e) {
+#pragma omp critical
+            errors += e.what();
+          }
+        }
+      }
+    }
+  }
+
+  ARTS_USER_ERROR_IF(not errors.empty(), "{}", errors)
+}
+
+Index spectral_radiance::baked_index(const Numeric f) const {
+  if (baked_f.empty()) return -1;
+
+  const auto it = std::ranges::lower_bound(baked_f, f);
+  return (it != baked_f.end() and *it == f)
+             ? static_cast<Index>(std::distance(baked_f.begin(), it))
+             : -1;
+}
+
+void spectral_radiance::bake(const AscendingGrid& frequency_grid) {
+  if (frequency_grid.empty()) {
+    unbake();
+    return;
+  }
+
+  const Index nf = frequency_grid.size();
+
+  Tensor4 a(nf, alt.size(), lat.size(), lon.size());
+  Tensor4 s(a.shape());
+  Tensor4 b(a.shape());
+
+  //! Only allocated by the first node with Zeeman parts
+  matpack::matpack_data<Complex, 5> zabs;
+  matpack::matpack_data<Complex, 5> zsrc;
+  String errors{};
+
+#pragma omp parallel for collapse(3) if (not arts_omp_in_parallel())
+  for (Index i = 0; i < alt.size(); i++) {
+    for (Index j = 0; j < lat.size(); j++) {
+      for (Index k = 0; k < lon.size(); k++) {
+        try {
+          const AtmPoint& node = *atm(i, j, k);
+          const auto [u, v, w] = node.wind;
+          ARTS_USER_ERROR_IF(
+              wind_shift and not std::isnan(u + v + w) and
+                  (u != 0 or v != 0 or w != 0),
+              "Cannot bake the node at [{}, {}, {}] with wind {:B,}",
+              alt[i],
+              lat[j],
+              lon[k],
+              node.wind)
+
+          std::vector<std::array<std::pair<Complex, Complex>, 3>> z(nf);
+          bool zeeman = false;
+          for (Index iv = 0; iv < nf; iv++) {
+            const Numeric f = frequency_grid[iv];
+            const auto x    = pm(i, j, k).parts(f);
+
+            a(iv, i, j, k) = x.a;
+            s(iv, i, j, k) = x.s;
+            b(iv, i, j, k) = planck(f, node.temperature);
+            z[iv]          = x.z;
+            for (auto& [za, zs] : x.z) {
+              zeeman = zeeman or za != 0.0 or zs != 0.0;
+            }
+          }
+
+          if (zeeman) {
+#pragma omp critical(fwd_spectral_radiance_bake)
+            {
+              if (zabs.empty()) {
+                zabs = matpack::matpack_data<Complex, 5>(
+                    nf, 3, alt.size(), lat.size(), lon.size(), Complex{0.0});
+                zsrc = matpack::matpack_data<Complex, 5>(zabs.shape(),
+                                                         Complex{0.0});
+              }
+
+              for (Index iv = 0; iv < nf; iv++) {
+                for (Index iz = 0; iz < 3; iz++) {
+                  zabs(iv, iz, i, j, k) = z[iv][iz].first;
+                  zsrc(iv, iz, i, j, k) = z[iv][iz].second;
+                }
+              }
+            }
+          }
+        } catch (const std::exception& e) {
+#pragma omp critical
+          errors += e.what();
+        }
+      }
+    }
+  }
+
+  ARTS_USER_ERROR_IF(not errors.empty(), "{}", errors)
+
+  baked_f    = frequency_grid;
+  baked_a    = std::move(a);
+  baked_s    = std::move(s);
+  baked_B    = std::move(b);
+  baked_zabs = std::move(zabs);
+  baked_zsrc = std::move(zsrc);
+}
+
+void spectral_radiance::unbake() {
+  baked_f    = AscendingGrid{};
+  baked_a    = Tensor4{};
+  baked_s    = Tensor4{};
+  baked_B    = Tensor4{};
+  baked_zabs = matpack::matpack_data<Complex, 5>{};
+  baked_zsrc = matpack::matpack_data<Complex, 5>{};
+}
+
+void spectral_radiance::set_wind_shift(const bool on) {
+  unbake();
+  wind_shift = on;
+}
+
+void spectral_radiance::set_jacobian(const std::vector<AtmKeyVal>& keys,
+                                     const Vector& perturbations) {
+  ARTS_USER_ERROR_IF(
+      static_cast<Index>(keys.size()) != perturbations.size(),
+      "Must have one perturbation per key, got {} keys and {} perturbations",
+      keys.size(),
+      perturbations.size())
+
+  for (Size it = 0; it < keys.size(); it++) {
+    ARTS_USER_ERROR_IF(wind_component(keys[it]) < 0 and perturbations[it] == 0,
+                       "Zero perturbation for {}",
+                       keys[it])
+    ARTS_USER_ERROR_IF(wind_component(keys[it]) >= 0 and not wind_shift,
+                       "Derivatives by {} need the wind shift to be on",
+                       keys[it])
+  }
+
+  const Index nt = static_cast<Index>(keys.size());
+  matpack::matpack_data<propmat, 4> models(
+      nt, alt.size(), lat.size(), lon.size());
+  String errors{};
+
+#pragma omp parallel for collapse(4) if (not arts_omp_in_parallel())
+  for (Index it = 0; it < nt; it++) {
+    for (Index i = 0; i < alt.size(); i++) {
+      for (Index j = 0; j < lat.size(); j++) {
+        for (Index k = 0; k < lon.size(); k++) {
+          if (wind_component(keys[it]) >= 0) continue;
+
+          try {
+            auto node          = std::make_shared<AtmPoint>(*atm(i, j, k));
+            (*node)[keys[it]] += perturbations[it];
+            models(it, i, j, k) = pm(i, j, k);
+            models(it, i, j, k).set_atm(std::move(node));
+          } catch (const std::exception& e) {
+#pragma omp critical
+            errors += e.what();
+          }
+        }
+      }
+    }
+  }
+
+  ARTS_USER_ERROR_IF(not errors.empty(), "{}", errors)
+
+  jacobian_keys          = keys;
+  jacobian_perturbations = perturbations;
+  jacobian_pm            = std::move(models);
+}
+
 Stokvec spectral_radiance::operator()(const Numeric f,
                                       const std::vector<path>& path_points,
                                       const Numeric cutoff_transmission) const {
@@ -215,6 +559,288 @@ Stokvec spectral_radiance::operator()(const Numeric f,
   return I;
 }
 
+Stokvec spectral_radiance::operator()(StokvecMatrixView dI,
+                                      const Numeric f,
+                                      const std::vector<path>& path_points,
+                                      const Numeric cutoff_transmission) const {
+  ARTS_ASSERT(path_points.size() > 0, "No path points")
+  ARTS_ASSERT(path_points.front().distance == 0.0, "Bad path point")
+
+  const Index nt = static_cast<Index>(jacobian_keys.size());
+  const Index nd = 8 * nt;
+
+  ARTS_ASSERT(dI.nrows() == nt and dI.ncols() == node_count())
+
+  if (path_points.size() == 1) {
+    return Iback(f, pos_weights(path_points.front()), path_points.front());
+  }
+
+  //! A path level and its derivatives by the targets of its 8 nodes
+  struct level {
+    std::array<weighted_position, 8> pos;
+    Propmat K;
+    Stokvec J;
+    PropmatVector dK;
+    StokvecVector dJ;
+  };
+
+  PropmatVector dKn(nt);
+  StokvecVector dNn(nt);
+  Vector dBn(nt);
+
+  const auto make_level = [&](const path& pp) {
+    level out{.pos = pos_weights(pp),
+              .dK  = PropmatVector(nd),
+              .dJ  = StokvecVector(nd)};
+
+    //! The nodes are evaluated once, for both the level and its derivatives
+    std::array<std::pair<Propmat, Stokvec>, 8> nominal{};
+    for (Index s = 0; s < 8; s++) {
+      if (out.pos[s].w != 0.0) nominal[s] = node_PM(f, out.pos[s], pp);
+    }
+
+    std::pair<Propmat, Stokvec> KN{Propmat{0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+                                   Stokvec{0.0, 0.0, 0.0, 0.0}};
+    if (baked_index(f) >= 0) {
+      KN = PM(f, out.pos, pp);
+    } else {
+      for (Index s = 0; s < 8; s++) {
+        if (out.pos[s].w == 0.0) continue;
+        KN.first  += out.pos[s].w * nominal[s].first;
+        KN.second += out.pos[s].w * nominal[s].second;
+      }
+    }
+
+    const auto& [K, N] = KN;
+    const Stokvec Bv   = B(f, out.pos);
+    const Muelmat iK   = inv(K);
+    out.K              = K;
+    out.J              = iK * N + Bv;
+
+    for (Index s = 0; s < 8; s++) {
+      const auto& p = out.pos[s];
+      if (p.w == 0.0) continue;
+
+      dPM(dKn, dNn, dBn, f, p, pp, nominal[s]);
+      for (Index it = 0; it < nt; it++) {
+        const Propmat dK    = p.w * dKn[it];
+        out.dK[s * nt + it] = dK;
+        out.dJ[s * nt + it] = iK * (p.w * dNn[it] - dK * (out.J - Bv)) +
+                              Stokvec{p.w * dBn[it], 0.0, 0.0, 0.0};
+      }
+    }
+
+    return out;
+  };
+
+  //! Forward: levels and layer transmissions until background or cutoff
+  std::vector<level> levels{make_level(path_points.front())};
+  std::vector<Muelmat> t;
+  std::vector<MuelmatVector> dt_lo, dt_hi;
+  const Vector dr(nd, 0.0);
+  Stokvec Ib{0.0, 0.0, 0.0, 0.0};
+  Muelmat T{1.0};
+  bool cutoff = false;
+
+  for (Size ip = 1; ip < path_points.size(); ip++) {
+    const path& pp = path_points[ip];
+
+    if (pp.point.los_type != PathPositionType::atm) {
+      Ib = Iback(f, pos_weights(pp), pp);
+      break;
+    }
+
+    levels.push_back(make_level(pp));
+    const level& lo = levels[levels.size() - 2];
+    const level& hi = levels.back();
+
+    two_level_exp(t.emplace_back(),
+                  dt_lo.emplace_back(nd),
+                  dt_hi.emplace_back(nd),
+                  lo.K,
+                  hi.K,
+                  lo.dK,
+                  hi.dK,
+                  pp.distance,
+                  dr,
+                  dr);
+
+    T = T * t.back();
+    if (T(0, 0) < cutoff_transmission) {
+      cutoff = true;
+      break;
+    }
+  }
+
+  //! Transmission from the start of the path to each layer
+  std::vector<Muelmat> T0{Muelmat{1.0}};
+  for (Size q = 1; q < t.size(); q++) T0.push_back(T0.back() * t[q - 1]);
+
+  //! Backward: radiance beyond each layer and the layer derivatives
+  Stokvec R = Ib;
+  for (Size q = t.size(); q-- > 0;) {
+    const level& lo = levels[q];
+    const level& hi = levels[q + 1];
+    const Stokvec S = avg(lo.J, hi.J);
+    const bool last = cutoff and q + 1 == t.size();
+
+    //! dR = dt X + Y dS, where R = (1 - t) S + t R' or R = t S at the cutoff
+    const Stokvec X = last ? S : R - S;
+    const Muelmat Y = last ? t[q] : Muelmat{1.0} - t[q];
+
+    for (Index s = 0; s < 8; s++) {
+      for (auto [lev, dt] :
+           {std::pair{&lo, &dt_lo[q]}, std::pair{&hi, &dt_hi[q]}}) {
+        const auto& p = lev->pos[s];
+        if (p.w == 0.0) continue;
+
+        const Index in = node_index(p);
+        for (Index it = 0; it < nt; it++) {
+          const Index id  = s * nt + it;
+          dI(it, in)     += T0[q] * ((*dt)[id] * X + Y * (0.5 * lev->dJ[id]));
+        }
+      }
+    }
+
+    R = last ? t[q] * S : (Muelmat{1.0} - t[q]) * S + t[q] * R;
+  }
+
+  return R;
+}
+
+std::pair<Stokvec, Numeric> spectral_radiance::adaptive(
+    const Numeric f,
+    const std::vector<path>& path_points,
+    const Numeric optical_depth,
+    const Numeric source_tolerance,
+    const Numeric cutoff_transmission,
+    const Index max_depth,
+    const Index max_stride) const {
+  ARTS_ASSERT(path_points.size() > 0, "No path points")
+  ARTS_ASSERT(path_points.front().distance == 0.0, "Bad path point")
+  ARTS_ASSERT(max_stride > 0, "Bad stride")
+
+  if (path_points.size() == 1) {
+    return {Iback(f, pos_weights(path_points.front()), path_points.front()),
+            0.0};
+  }
+
+  //! The atmospheric levels end at the background, if there is one
+  Size na = 1;
+  while (na < path_points.size() and
+         path_points[na].point.los_type == PathPositionType::atm) {
+    na++;
+  }
+
+  std::vector<Numeric> s(na, 0.0);
+  for (Size i = 1; i < na; i++) s[i] = s[i - 1] + path_points[i].distance;
+
+  struct level {
+    Propmat K;
+    Stokvec J;
+  };
+
+  std::vector<std::optional<level>> levels(na);
+  const auto get = [&](const Size i) -> const level& {
+    if (not levels[i]) {
+      const auto pos    = pos_weights(path_points[i]);
+      const auto [K, N] = PM(f, pos, path_points[i]);
+      levels[i]         = level{.K = K, .J = inv(K) * N + B(f, pos)};
+    }
+    return *levels[i];
+  };
+
+  //! The transmission and emission of m sublayers of linear K and J
+  const auto layer = [](const level& a,
+                        const level& b,
+                        const Numeric r,
+                        const Index m) {
+    std::pair<Muelmat, Stokvec> out{Muelmat{1.0}, Stokvec{0.0, 0.0, 0.0, 0.0}};
+    const auto x = [m](const Index k) {
+      return static_cast<Numeric>(k) / static_cast<Numeric>(m);
+    };
+
+    for (Index k = 0; k < m; k++) {
+      const Propmat K = avg(mix(a.K, b.K, x(k)), mix(a.K, b.K, x(k + 1)));
+      const Stokvec J = avg(mix(a.J, b.J, x(k)), mix(a.J, b.J, x(k + 1)));
+      const Muelmat t = exp(K, r / static_cast<Numeric>(m));
+
+      out.second += out.first * (Muelmat{1.0} - t) * J;
+      out.first   = out.first * t;
+    }
+
+    return out;
+  };
+
+  Stokvec I{0.0, 0.0, 0.0, 0.0};
+  Muelmat T{1.0};
+  Numeric error = 0.0;
+  Size i        = 0;
+  Size stride   = 1;
+
+  while (i + 1 < na) {
+    const Size j       = std::min(i + stride, na - 1);
+    const level& a     = get(i);
+    const level& b     = get(j);
+    const Numeric r    = s[j] - s[i];
+    Numeric tau        = avg(a.K, b.K).A() * r;
+    Numeric scl        = std::max(std::abs(a.J.I()), std::abs(b.J.I()));
+    const Numeric djmp = std::abs(b.J.I() - a.J.I());
+
+    //! A merged layer must be thin and linear at its midpoint
+    if (j - i > 1) {
+      const Size k    = (i + j) / 2;
+      const level& c  = get(k);
+      const Numeric x = (s[k] - s[i]) / r;
+      tau             = std::max(tau, c.K.A() * r);
+      scl             = std::max(scl, std::abs(c.J.I()));
+
+      if (tau >= optical_depth or
+          std::abs(c.K.A() - mix(a.K, b.K, x).A()) * r > optical_depth or
+          std::abs(c.J.I() - mix(a.J, b.J, x).I()) > source_tolerance * scl) {
+        stride = (j - i) / 2;
+        continue;
+      }
+    }
+
+    auto [t, e] = layer(a, b, r, 1);
+    if (j - i > 1) {
+      error += T(0, 0) * tau * scl;
+    } else if (tau * djmp > source_tolerance * scl) {
+      for (Index m = 2; m <= (Index{1} << max_depth); m *= 2) {
+        auto [tm, em]    = layer(a, b, r, m);
+        const Numeric dx = std::abs(em.I() - e.I()) +
+                           std::abs(tm(0, 0) - t(0, 0)) * scl;
+        t                = tm;
+        e                = em;
+        if (dx <= source_tolerance * scl) break;
+        if (m == (Index{1} << max_depth)) error += T(0, 0) * dx;
+      }
+    }
+
+    //! As the plain operator, the last layer is its source times transmission
+    if (const Muelmat Tj = T * t; Tj(0, 0) < cutoff_transmission) {
+      error += Tj(0, 0) * scl;
+      return {I += Tj * avg(a.J, b.J), error};
+    }
+
+    I += T * e;
+    T  = T * t;
+    i  = j;
+
+    stride = tau < optical_depth
+                 ? std::min<Size>(2 * stride, static_cast<Size>(max_stride))
+                 : 1;
+  }
+
+  if (na < path_points.size()) {
+    const path& pp  = path_points[na];
+    I              += T * Iback(f, pos_weights(pp), pp);
+  }
+
+  return {I, error};
+}
+
 StokvecVector spectral_radiance::operator()(
     const Numeric f,
     const std::vector<path>& path_points,
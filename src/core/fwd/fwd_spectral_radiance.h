@@ -5,6 +5,7 @@
 
 #include <memory>
 #include <iosfwd>
+#include <vector>
 
 #include "atm.h"
 #include "fwd_path.h"
@@ -30,6 +31,22 @@ struct spectral_radiance {
 
   Vector2 ellipsoid;
 
+  //! Doppler shift the absorption of the nodes by their wind, see set_wind_shift
+  bool wind_shift{false};
+
+  //! Atmospheric derivative targets, see set_jacobian
+  std::vector<AtmKeyVal> jacobian_keys;
+  Vector jacobian_perturbations;
+  matpack::matpack_data<propmat, 4> jacobian_pm;
+
+  //! Node tables on a fixed frequency grid, see bake
+  AscendingGrid baked_f;
+  Tensor4 baked_a;
+  Tensor4 baked_s;
+  Tensor4 baked_B;
+  matpack::matpack_data<Complex, 5> baked_zabs;
+  matpack::matpack_data<Complex, 5> baked_zsrc;
+
   struct as_vector {};
 
   struct weighted_position {
@@ -55,10 +72,123 @@ struct spectral_radiance {
                     Numeric ciaextrap = {},
                     Index ciarobust   = {});
 
+  /** Interpolate the CIA and predefined absorption of all atmospheric points
+   *
+   * Removes the tables of bake, as they no longer match the absorption.
+   *
+   * @param[in] range The frequency range [Hz] to interpolate inside
+   * @param[in] tolerance The relative error allowed, non-positive for none
+   * @param[in] start_nodes The number of evenly spaced starting nodes
+   */
+  void set_continuum_cache(const Vector2 range,
+                           const Numeric tolerance,
+                           const Index start_nodes = 33);
+
+  /** Doppler shift the absorption of each node by its wind
+   *
+   * The frequency is scaled by the wind along the line of sight, as in
+   * frequency_gridWindShift, before the absorption of each node is computed.
+   * This is off by default.  Removes the tables of bake.
+   *
+   * @param[in] on Whether to shift the absorption
+   */
+  void set_wind_shift(const bool on);
+
+  /** Prepare derivatives of the spectral radiance by the atmospheric nodes
+   *
+   * Wind derivatives come from the frequency derivative of the Doppler shifted
+   * absorption, so they need set_wind_shift.  Every other target keeps a copy of the absorption models at
+   * all nodes, with the target perturbed, so each such target costs as much
+   * memory as the absorption of the operator itself.
+   *
+   * @param[in] keys The atmospheric targets
+   * @param[in] perturbations The perturbation of each target, ignored for wind
+   */
+  void set_jacobian(const std::vector<AtmKeyVal>& keys,
+                    const Vector& perturbations);
+
+  /** Tabulate the absorption and Planck radiation of all nodes
+   *
+   * The tables are kept as one tensor per quantity, with the frequency as the
+   * outermost dimension.  Frequencies on the grid then only interpolate the
+   * tables along the path, while other frequencies use the absorption models
+   * as before.  Zeeman parts are only kept if any node has them.
+   *
+   * The Doppler shift of the wind depends on the line of sight, so the nodes
+   * may not have any wind if set_wind_shift is on.  Bake after other changes to the absorption, as the
+   * tables are not updated by them.  The setters of the operator remove the
+   * tables, but changes made directly to pm or atm do not.
+   *
+   * Like the setters, this must not be called while other threads compute
+   * with the operator.
+   *
+   * @param[in] frequency_grid The frequencies, empty to remove the tables
+   */
+  void bake(const AscendingGrid& frequency_grid);
+
+  //! Remove the tables of bake
+  void unbake();
+
+  //! The index of the frequency in the baked grid, or -1
+  [[nodiscard]] Index baked_index(const Numeric f) const;
+
   Stokvec operator()(const Numeric f,
                      const std::vector<path>& path_points,
                      const Numeric cutoff_transmission = 1e-6) const;
 
+  /** The spectral radiance and its derivatives by the atmospheric nodes
+   *
+   * The radiative transfer is linearized along the same steps as the radiance
+   * and the level derivatives are spread to the nodes by pos_weights.
+   *
+   * @param[inout] dI Added derivatives of shape (jacobian_keys, node_count())
+   * @param[in] f The frequency
+   * @param[in] path_points The path
+   * @param[in] cutoff_transmission As for the radiance alone
+   * @return The spectral radiance
+   */
+  Stokvec operator()(StokvecMatrixView dI,
+                     const Numeric f,
+                     const std::vector<path>& path_points,
+                     const Numeric cutoff_transmission = 1e-6) const;
+
+  /** The spectral radiance with adaptive steps and an error estimate
+   *
+   * Levels are only evaluated as they are reached.  Layers with an optical
+   * depth below optical_depth are merged so that most levels between them are
+   * never evaluated.  The merged stride doubles as long as the layers stay
+   * thin, up to max_stride levels, and a merge is only kept if the absorption
+   * and source at its middle level are close to linear between its ends.
+   * Layers whose source varies a lot over their optical depth are split into
+   * up to 2^max_depth sublayers of linearly varying absorption and source,
+   * until the change is within source_tolerance.
+   *
+   * The path stops once the transmission drops below the cutoff.  As in the
+   * plain operator, the last layer then adds its average source times the
+   * transmission through it instead of its emission.  Without merging and
+   * splitting, the result is thus that of the plain operator.
+   *
+   * The estimate is the sum of the last split changes, the full emission of
+   * the merged layers, and the source times the transmission at the cutoff.
+   *
+   * @param[in] f The frequency
+   * @param[in] path_points The path
+   * @param[in] optical_depth The optical depth below which layers are merged
+   * @param[in] source_tolerance The error allowed relative to the source
+   * @param[in] cutoff_transmission As for the plain operator
+   * @param[in] max_depth The maximum number of times a layer is split in two
+   * @param[in] max_stride The maximum number of layers merged into one
+   * @return The spectral radiance and its estimated error
+   */
+  [[nodiscard]] std::pair<Stokvec, Numeric> adaptive(
+      const Numeric f,
+      const std::vector<path>& path_points,
+      const Numeric optical_depth,
+      const Numeric source_tolerance,
+      const Numeric cutoff_transmission = 1e-6,
+      const Index max_depth             = 4,
+      const Index max_stride            = 8) const;
+
   StokvecVector operator()(const Numeric f,
                            const std::vector<path>& path_points,
                            spectral_radiance::as_vector) const;
@@ -67,6 +197,18 @@ struct spectral_radiance {
   [[nodiscard]] const AscendingGrid& latitude() const { return lat; }
   [[nodiscard]] const AscendingGrid& longitude() const { return lon; }
 
+  //! The number of atmospheric nodes
+  [[nodiscard]] Index node_count() const {
+    return static_cast<Index>(alt.size() * lat.size() * lon.size());
+  }
+
+  //! The flat index of an atmospheric node, as used by the derivatives
+  [[nodiscard]] Index node_index(const weighted_position& p) const {
+    return (p.i * static_cast<Index>(lat.size()) + p.j) *
+               static_cast<Index>(lon.size()) +
+           p.k;
+  }
+
   friend std::ostream& operator<<(std::ostream&, const spectral_radiance&);
 
   [[nodiscard]] std::vector<path> geometric_planar(const Vector3 pos,
@@ -90,6 +232,34 @@ struct spectral_radiance {
       const Numeric f,
       const std::array<weighted_position, 8>& pos,
       const path& pp) const;
+
+  /** The absorption models of a single node, without the tables of bake
+   *
+   * @param[in] f The frequency
+   * @param[in] p The node, its weight is not applied
+   * @param[in] pp The path point, for the line of sight
+   * @return The propagation matrix and non-LTE source of the node
+   */
+  [[nodiscard]] std::pair<Propmat, Stokvec> node_PM(
+      const Numeric f, const weighted_position& p, const path& pp) const;
+
+  /** The derivatives of PM and B at a single node by all Jacobian targets
+   *
+   * @param[out] dK The propagation matrix derivatives
+   * @param[out] dN The non-LTE source derivatives
+   * @param[out] dB The Planck function derivatives
+   * @param[in] f The frequency
+   * @param[in] p The node, its weight is not applied
+   * @param[in] pp The path point, for the line of sight
+   * @param[in] nominal The node_PM of the node
+   */
+  void dPM(PropmatVectorView dK,
+           StokvecVectorView dN,
+           VectorView dB,
+           const Numeric f,
+           const weighted_position& p,
+           const path& pp,
+           const std::pair<Propmat, Stokvec>& nominal) const;
 };
 }  // namespace fwd
 
@@ -1,5 +1,7 @@
 #include "igrf13.h"
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 
 #include "arts_conversions.h"
@@ -353,26 +355,12 @@ Vector3 geodetic2geocentric(const Vector3 pos, const Vector2 ell) {
   return ecef2geocentric(geodetic2ecef(pos, ell));
 }
 
-/** Perform all computations on pre-allocated local data
- *
- * \param[in,out] out Size-initialized output data
- * \param[in] g The g-coefficients for the Legendre calculations
- * \param[in] h The h-coefficients for the Legendre calculations
- * \param[in] z_field As WSV
- * \param[in] lat_grid As WSV
- * \param[in] lon_grid As WSV
- * \param[in] ell As WSV called refellipsoid
- * \param[in] scale the addition scales with this, set to 1.0 for complete
- * calculations
- */
-Vector3 igrf_impl(const Matrix &g,
-                  const Matrix &h,
-                  const Vector3 pos,
-                  const Vector2 ell) {
+//! The rotation of the spherical field to ENU at the geodetic position
+Vector3 spherical2enu(const Vector3 mag,
+                      const Vector3 pos,
+                      const Vector3 geoc) {
   using Conversion::cosd, Conversion::sind;
 
-  const Vector3 geoc = geodetic2geocentric(pos, ell);
-  const Vector3 mag  = Legendre::schmidt_fieldcalc(g, h, r0, geoc);
   const Numeric ang =
       sind(pos[1]) * sind(90.0 - geoc[1]) - cosd(pos[1]) * cosd(90.0 - geoc[1]);
   const Numeric ca = std::cos(ang);
@@ -383,84 +371,67 @@ Vector3 igrf_impl(const Matrix &g,
           1e-9 * (-sa * mag[1] + ca * mag[0])};
 }
 
-Vector3 igrf(const Vector3 pos, const Vector2 ell, const Time &time) {
-  static const Time y2020("2020-01-01 00:00:00");
-  static const Matrix mg2020{g2020};
-  static const Matrix mh2020{h2020};
-
-  if (time >= y2020) {
-    return igrf_impl(mg2020, mh2020, pos, ell);
-  }
-
-  static const Time y2015("2015-01-01 00:00:00");
-  static const Matrix mg2015{g2015};
-  static const Matrix mh2015{h2015};
-
-  if (time >= y2015) {
-    const Numeric scale = (time.Seconds() - y2015.Seconds()) /
-                          (y2020.Seconds() - y2015.Seconds());
-    ARTS_ASSERT(scale >= 0 and scale < 1)
-
-    Vector3 out  = igrf_impl(mg2020, mh2020, pos, ell);
-    out         *= (1.0 - scale);
-    Vector3 tmp  = igrf_impl(mg2015, mh2015, pos, ell);
-    tmp         *= scale;
-    out         += tmp;
-    return out;
-  }
-
-  static const Time y2010("2010-01-01 00:00:00");
-  static const Matrix mg2010{g2010};
-  static const Matrix mh2010{h2010};
-
-  if (time >= y2010) {
-    const Numeric scale = (time.Seconds() - y2010.Seconds()) /
-                          (y2015.Seconds() - y2010.Seconds());
-    ARTS_ASSERT(scale >= 0 and scale < 1)
-
-    Vector3 out  = igrf_impl(mg2015, mh2015, pos, ell);
-    out         *= (1.0 - scale);
-    Vector3 tmp  = igrf_impl(mg2010, mh2010, pos, ell);
-    tmp         *= scale;
-    out         += tmp;
-    return out;
+std::pair<Matrix, Matrix> coefficients(const Time &time) {
+  static const std::array<Time, 5> t{Time("2000-01-01 00:00:00"),
+                                     Time("2005-01-01 00:00:00"),
+                                     Time("2010-01-01 00:00:00"),
+                                     Time("2015-01-01 00:00:00"),
+                                     Time("2020-01-01 00:00:00")};
+  static const std::array<Matrix, 5> g{
+      Matrix{g2000}, Matrix{g2005}, Matrix{g2010}, Matrix{g2015}, Matrix{g2020}};
+  static const std::array<Matrix, 5> h{
+      Matrix{h2000}, Matrix{h2005}, Matrix{h2010}, Matrix{h2015}, Matrix{h2020}};
+
+  if (time >= t.back()) return {g.back(), h.back()};
+  if (time < t.front()) return {g.front(), h.front()};
+
+  Size i = 0;
+  while (time >= t[i + 1]) i++;
+
+  //! The field is linear in the coefficients, so this is the same as
+  //! weighting the fields of the two epochs
+  const Numeric scale = (time.Seconds() - t[i].Seconds()) /
+                        (t[i + 1].Seconds() - t[i].Seconds());
+  ARTS_ASSERT(scale >= 0 and scale < 1)
+
+  std::pair<Matrix, Matrix> out{g[i + 1], h[i + 1]};
+  out.first  *= 1.0 - scale;
+  out.second *= 1.0 - scale;
+  for (Index n = 0; n < out.first.nrows(); n++) {
+    for (Index m = 0; m < out.first.ncols(); m++) {
+      out.first(n, m)  += scale * g[i](n, m);
+      out.second(n, m) += scale * h[i](n, m);
+    }
   }
+  return out;
+}
 
-  static const Time y2005("2005-01-01 00:00:00");
-  static const Matrix mg2005{g2005};
-  static const Matrix mh2005{h2005};
+Vector3 igrf(const Matrix &g,
+             const Matrix &h,
+             const Vector3 pos,
+             const Vector2 ell) {
+  const Vector3 geoc = geodetic2geocentric(pos, ell);
+  return spherical2enu(Legendre::schmidt_fieldcalc(g, h, r0, geoc), pos, geoc);
+}
 
-  if (time >= y2005) {
-    const Numeric scale = (time.Seconds() - y2005.Seconds()) /
-                          (y2010.Seconds() - y2005.Seconds());
-    ARTS_ASSERT(scale >= 0 and scale < 1)
+Vector3 igrf(const Vector3 pos, const Vector2 ell, const Time &time) {
+  const auto [g, h] = coefficients(time);
+  return igrf(g, h, pos, ell);
+}
 
-    Vector3 out  = igrf_impl(mg2010, mh2010, pos, ell);
-    out         *= (1.0 - scale);
-    Vector3 tmp  = igrf_impl(mg2005, mh2005, pos, ell);
-    tmp         *= scale;
-    out         += tmp;
+std::vector<Vector3> igrf(const std::span<const Vector3> pos,
+                          const Vector2 ell,
+                          const Time &time) {
+  const auto [g, h] = coefficients(time);
 
-    return out;
-  }
+  std::vector<Vector3> geoc(pos.size());
+  std::ranges::transform(
+      pos, geoc.begin(), [ell](auto &x) { return geodetic2geocentric(x, ell); });
 
-  static const Time y2000("2000-01-01 00:00:00");
-  static const Matrix mg2000{g2000};
-  static const Matrix mh2000{h2000};
-
-  if (time >= y2000) {
-    const Numeric scale = (time.Seconds() - y2000.Seconds()) /
-                          (y2005.Seconds() - y2000.Seconds());
-    ARTS_ASSERT(scale >= 0 and scale < 1)
-
-    Vector3 out  = igrf_impl(mg2005, mh2005, pos, ell);
-    out         *= (1.0 - scale);
-    Vector3 tmp  = igrf_impl(mg2000, mh2000, pos, ell);
-    tmp         *= scale;
-    out         += tmp;
-    return out;
+  std::vector<Vector3> out = Legendre::schmidt_fieldcalc(g, h, r0, geoc);
+  for (Size i = 0; i < pos.size(); i++) {
+    out[i] = spherical2enu(out[i], pos[i], geoc[i]);
   }
-
-  return igrf_impl(mg2000, mh2000, pos, ell);
+  return out;
 }
 }  // namespace IGRF
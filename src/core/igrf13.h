@@ -3,6 +3,10 @@
 #include <artstime.h>
 #include <matpack.h>
 
+#include <span>
+#include <utility>
+#include <vector>
+
 namespace IGRF {
 /** Computes the magnetic field based on IGRF13 coefficients
  * 
@@ -18,4 +22,41 @@ namespace IGRF {
  * @return The magnetic field in ENU as described by the MagneticField struct
  */
 Vector3 igrf(const Vector3 pos, const Vector2 ell, const Time& time=Time{});
+
+/** The g and h coefficients of IGRF13 at a time
+ *
+ * Interpolated between the 5-year epochs, with the same time limits as igrf.
+ *
+ * @param[in] time A time stamp
+ * @return The pair of g and h coefficients
+ */
+std::pair<Matrix, Matrix> coefficients(const Time& time);
+
+/** As igrf, but for coefficients from coefficients(time)
+ *
+ * Use this to avoid recomputing the coefficients for many positions.
+ *
+ * @param[in] g The g coefficients
+ * @param[in] h The h coefficients
+ * @param[in] pos The position in [alt, lat, lon] (geodetic)
+ * @param[in] ell The ellipsoid (a, b)
+ * @return The magnetic field in ENU
+ */
+Vector3 igrf(const Matrix& g, const Matrix& h, const Vector3 pos, const Vector2 ell);
+
+/** As igrf, but for many positions, e.g., along a path
+ *
+ * The coefficients are computed once and the longitude terms are shared by
+ * consecutive positions with the same longitude.  The geocentric latitude
+ * changes with altitude, so the Legendre recursion is redone for almost
+ * every position.
+ *
+ * @param[in] pos The positions in [alt, lat, lon] (geodetic)
+ * @param[in] ell The ellipsoid (a, b)
+ * @param[in] time A time stamp
+ * @return The magnetic field in ENU of all positions
+ */
+std::vector<Vector3> igrf(const std::span<const Vector3> pos,
+                          const Vector2 ell,
+                          const Time& time = Time{});
 }  // namespace IGRF
@@ -1,15 +1,20 @@
+#include <arts_omp.h>
 #include <fast_float/fast_float.h>
 #include <hitran_species.h>
 #include <lbl_hitran.h>
 
+#include <algorithm>
+#include <limits>
+#include <string_view>
+
 #include "partfun.h"
 
 namespace lbl {
 struct reader {
-  std::string::const_iterator it;
-  std::string::const_iterator end;
+  std::string_view::const_iterator it;
+  std::string_view::const_iterator end;
 
-  reader(const std::string& s) : it(s.begin()), end(s.end()) {}
+  reader(std::string_view s) : it(s.begin()), end(s.end()) {}
 
   template <typename T>
   constexpr T read_next(Size n) {
@@ -56,7 +61,7 @@ struct reader {
 };
 
 bool read_hitran_par_record(hitran_record& record,
-                            const std::string& linedata,
+                            std::string_view linedata,
                             const Numeric fmin) try {
   using namespace Conversion;
 
@@ -103,8 +108,113 @@ bool read_hitran_par_record(hitran_record& record,
       linedata);
 }
 
-hitran_data read_hitran_par(std::istream& file,
-                            const Vector2& frequency_range) {
+namespace {
+//! The line center of the record, in the unit of the file [cm-1]
+Numeric record_frequency(std::string_view linedata) {
+  if (linedata.size() < 15) return std::numeric_limits<Numeric>::infinity();
+  return reader{linedata.substr(3, 12)}.read_next<Numeric>(12);
+}
+
+/** The start of the first record at or after pos and its line center [Hz]
+ *
+ * If pos is not at the start of a record, the remainder of that record is
+ * skipped.  At the end of the file, the file size and infinity are returned.
+ */
+std::pair<std::streamoff, Numeric> next_record(std::istream& file,
+                                               std::streamoff pos,
+                                               std::streamoff size) {
+  file.clear();
+  file.seekg(pos > 0 ? pos - 1 : 0);
+
+  std::string linedata;
+  if (pos > 0) std::getline(file, linedata);
+
+  const std::streamoff start = file.tellg();
+  if (not std::getline(file, linedata) or start < 0) {
+    return {size, std::numeric_limits<Numeric>::infinity()};
+  }
+
+  return {start, Conversion::kaycm2freq(record_frequency(linedata))};
+}
+
+/** The byte range of the file that holds the frequency range
+ *
+ * The file is sorted in frequency, so the range is found by bisection
+ * of the byte offsets.  The bisection stops when the interval is small
+ * enough to be read, so the range may hold a few records outside the
+ * frequency range.
+ */
+std::pair<std::streamoff, std::streamoff> hitran_byte_range(
+    std::istream& file, const Vector2& frequency_range, std::streamoff size) {
+  constexpr std::streamoff resolution = 1 << 16;
+
+  std::streamoff begin = 0;
+  if (frequency_range[0] > -std::numeric_limits<Numeric>::infinity()) {
+    std::streamoff lo = 0, hi = size;
+    while (hi - lo > resolution) {
+      const std::streamoff mid = lo + (hi - lo) / 2;
+      if (next_record(file, mid, size).second < frequency_range[0]) {
+        lo = mid;
+      } else {
+        hi = mid;
+      }
+    }
+    begin = next_record(file, lo, size).first;
+  }
+
+  std::streamoff end = size;
+  if (frequency_range[1] < std::numeric_limits<Numeric>::infinity()) {
+    std::streamoff lo = begin, hi = size;
+    while (hi - lo > resolution) {
+      const std::streamoff mid = lo + (hi - lo) / 2;
+      if (next_record(file, mid, size).second > frequency_range[1]) {
+        hi = mid;
+      } else {
+        lo = mid;
+      }
+    }
+    end = next_record(file, hi, size).first;
+  }
+
+  return {begin, end};
+}
+
+//! The records of a chunk of the file, and if fmax was exceeded in it
+struct hitran_chunk {
+  hitran_data data{};
+  bool done{false};
+};
+
+hitran_chunk read_hitran_par_chunk(std::string_view buffer,
+                                   const Vector2& frequency_range) {
+  hitran_chunk out;
+
+  bool last_ok = true;
+  while (not buffer.empty()) {
+    const auto n = buffer.find('\n');
+    const std::string_view linedata = buffer.substr(0, n);
+    buffer.remove_prefix(n == std::string_view::npos ? buffer.size() : n + 1);
+    if (linedata.empty()) continue;
+
+    last_ok = read_hitran_par_record(
+        last_ok ? out.data.emplace_back() : out.data.back(),
+        linedata,
+        frequency_range[0]);
+
+    if (last_ok and out.data.back().f0 > frequency_range[1]) {
+      out.data.pop_back();
+      out.done = true;
+      return out;
+    }
+  }
+
+  if (not last_ok) out.data.pop_back();
+
+  return out;
+}
+
+hitran_data read_hitran_par_serial(std::istream& file,
+                                   const Vector2& frequency_range) {
   hitran_data out;
 
   std::string linedata;
@@ -125,6 +235,76 @@ hitran_data read_hitran_par(std::istream& file,
 
   return out;
 }
+}  // namespace
+
+hitran_data read_hitran_par(std::istream& file,
+                            const Vector2& frequency_range) {
+  const std::streamoff start = file.tellg();
+  if (start < 0) return read_hitran_par_serial(file, frequency_range);
+
+  file.seekg(0, std::ios::end);
+  const std::streamoff size = file.tellg();
+  if (size < 0) {
+    file.clear();
+    file.seekg(start);
+    return read_hitran_par_serial(file, frequency_range);
+  }
+
+  auto [begin, end] = hitran_byte_range(file, frequency_range, size);
+  begin             = std::max(begin, start);
+  if (end <= begin) return {};
+
+  std::string buffer(static_cast<std::size_t>(end - begin), '\0');
+  file.clear();
+  file.seekg(begin);
+  file.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+  buffer.resize(static_cast<std::size_t>(file.gcount()));
+
+  //! Split into chunks of whole records, several per thread for balance
+  const Size nchunks = std::max<Size>(
+      1,
+      std::min<Size>(4 * arts_omp_get_max_threads(), buffer.size() >> 16));
+  std::vector<std::string_view> chunks;
+  chunks.reserve(nchunks);
+  const std::string_view all{buffer};
+  for (std::size_t first = 0; first < all.size();) {
+    std::size_t last = std::min(all.size(), first + all.size() / nchunks);
+    last             = std::min(all.size(), all.find('\n', last));
+    chunks.push_back(all.substr(first, last - first));
+    first = last + 1;
+  }
+
+  std::vector<hitran_chunk> results(chunks.size());
+  std::string error{};
+
+#pragma omp parallel for schedule(dynamic) if (not arts_omp_in_parallel())
+  for (Size i = 0; i < chunks.size(); i++) {
+    try {
+      results[i] = read_hitran_par_chunk(chunks[i], frequency_range);
+    } catch (std::exception& e) {
+#pragma omp critical
+      error += var_string(e.what(), '\n');
+    }
+  }
+
+  ARTS_USER_ERROR_IF(not error.empty(), "{}", error)
+
+  //! Concatenate in file order until the first chunk that exceeded fmax
+  Size nlines = 0;
+  Size nused  = 0;
+  while (nused < results.size()) {
+    nlines += results[nused].data.size();
+    if (results[nused++].done) break;
+  }
+
+  hitran_data out;
+  out.reserve(nlines);
+  for (Size i = 0; i < nused; i++) {
+    std::ranges::move(results[i].data, std::back_inserter(out));
+  }
+
+  return out;
+}
 
 hitran_data read_hitran_par(std::istream&& file,
                             const Vector2& frequency_range) {
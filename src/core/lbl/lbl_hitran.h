@@ -25,6 +25,16 @@ struct hitran_record {
 };
 using hitran_data = std::vector<hitran_record>;
 
+/** Reads HITRAN .par records in the frequency range from a sorted file
+ *
+ * Seekable streams are bisected for the byte range of the frequency range,
+ * which is then read in one go and parsed in parallel chunks.  Other streams
+ * are read record by record.
+ *
+ * @param file The stream of 160-character HITRAN records
+ * @param frequency_range The inclusive range of line centers [Hz]
+ * @return The records in file order
+ */
 hitran_data read_hitran_par(std::istream& file, const Vector2& frequency_range);
 hitran_data read_hitran_par(std::istream&& file,
                             const Vector2& frequency_range);
@@ -143,6 +143,8 @@ void calculate(PropmatVectorView pm,
       ARTS_USER_ERROR("No ECS data for isotopologue {}", bnd_key.Isotopologue());
     }
 
+    auto tab = ecs_data.tables.find(bnd_key);
+
     voigt::ecs::calculate(pm,
                           dpm,
                           *voigt_ecs_data,
@@ -151,6 +153,7 @@ void calculate(PropmatVectorView pm,
                           bnd_key,
                           bnd,
                           it->second,
+                          tab == ecs_data.tables.end() ? nullptr : &tab->second,
                           atm,
                           pol,
                           no_negative_absorption);
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <quantum_numbers.h>
+
 #include <iosfwd>
 #include <unordered_map>
 
@@ -29,10 +31,37 @@ struct species_data {
 
 using species_data_map = std::unordered_map<SpeciesEnum, species_data>;
 
+/** Equivalent lines of a band tabulated in temperature and pressure
+ *
+ * The equivalent line strengths and values are in the order of the band
+ * lines, each paired with the line that dominates its eigenvector, so that
+ * grid points interpolate the same quantum numbers.  They are stored as the
+ * pressure-normalized deviation from their zero-pressure limit, the line
+ * strength and line center of the individual lines.  Between grid points the
+ * table is linearly interpolated.  Outside the pressure grid, the
+ * deviation scales linearly with pressure, so that a single pressure gives the
+ * first order pressure scaling of the band.
+ */
+struct equivalent_line_table {
+  AscendingGrid T{};
+  AscendingGrid P{};
+
+  //! [T x P x 1 or broadening species x lines]
+  ComplexTensor4 str{};
+  ComplexTensor4 val{};
+
+  //! The largest relative errors versus full diagonalization between grid points
+  Numeric str_error{};
+  Numeric val_error{};
+};
+
 //! FIXME: Should behave as an unordered map of unordered maps, but isn't one because we don't understand pybind11
 struct isot_map {
   std::unordered_map<SpeciesIsotope, species_data_map> data{};
 
+  //! Tabulated equivalent lines of bands, not stored to file
+  std::unordered_map<QuantumIdentifier, equivalent_line_table> tables{};
+
   species_data_map& operator[](const SpeciesIsotope& key) { return data[key]; }
   [[nodiscard]] auto find(const SpeciesIsotope& key) const {
     return data.find(key);
@@ -43,7 +72,10 @@ struct isot_map {
   [[nodiscard]] auto end() const { return data.end(); }
   [[nodiscard]] auto cbegin() const { return data.cbegin(); }
   [[nodiscard]] auto cend() const { return data.cend(); }
-  void clear() { data.clear(); }
+  void clear() {
+    data.clear();
+    tables.clear();
+  }
   void reserve(const size_t n) { data.reserve(n); }
   [[nodiscard]] std::size_t size() const { return data.size(); }
   [[nodiscard]] bool empty() const { return data.empty(); }
@@ -6,6 +6,11 @@
 #include <Faddeeva.hh>
 #include <algorithm>
 #include <cmath>
+#include <functional>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <tuple>
 
 #include "arts_omp.h"
 #include "atm.h"
@@ -13,6 +18,7 @@
 #include "debug.h"
 #include "isotopologues.h"
 #include "lbl_lineshape_linemixing.h"
+#include "lin_alg.h"
 #include "matpack_math.h"
 #include "partfun.h"
 #include "sorting.h"
@@ -32,9 +38,13 @@ namespace makarov {
  */
 Numeric reduced_dipole(const Rational Ju, const Rational Jl, const Rational N);
 
+relaxation_coupling coupling(const QuantumIdentifier& bnd_qid,
+                             const band_data& bnd);
+
 void relaxation_matrix_offdiagonal(ExhaustiveMatrixView& W,
                                    const QuantumIdentifier& bnd_qid,
                                    const band_data& bnd,
+                                   const relaxation_coupling& coupling,
                                    const ArrayOfIndex& sorting,
                                    const SpeciesEnum broadening_species,
                                    const linemixing::species_data& rovib_data,
@@ -49,9 +59,13 @@ Numeric reduced_dipole(const Rational Jf,
                        const Rational li,
                        const Rational k = 1);
 
+relaxation_coupling coupling(const QuantumIdentifier& bnd_qid,
+                             const band_data& bnd);
+
 void relaxation_matrix_offdiagonal(ExhaustiveMatrixView& W,
                                    const QuantumIdentifier& bnd_qid,
                                    const band_data& bnd,
+                                   const relaxation_coupling& coupling,
                                    const ArrayOfIndex& sorting,
                                    const SpeciesEnum broadening_species,
                                    const linemixing::species_data& rovib_data,
@@ -59,6 +73,176 @@ void relaxation_matrix_offdiagonal(ExhaustiveMatrixView& W,
                                    const AtmPoint& atm);
 }  // namespace hartmann
 
+namespace {
+//! The quantum numbers that the relaxation coupling of a band depends on
+std::vector<Index> coupling_key(const QuantumIdentifier& bnd_qid,
+                                const band_data& bnd) {
+  std::vector<Index> key;
+  key.reserve(5 + 4 * bnd.size());
+  key.push_back(static_cast<Index>(bnd.lineshape));
+
+  const auto add = [&key](const Quantum::Number::ValueList& val,
+                          QuantumNumberType t) {
+    if (val.has(t)) {
+      key.push_back(val[t].upp().toIndex(2));
+      key.push_back(val[t].low().toIndex(2));
+    } else {
+      key.push_back(std::numeric_limits<Index>::lowest());
+    }
+  };
+
+  add(bnd_qid.val, QuantumNumberType::S);
+  add(bnd_qid.val, QuantumNumberType::l2);
+  for (auto& line : bnd) {
+    add(line.qn.val, QuantumNumberType::J);
+    add(line.qn.val, QuantumNumberType::N);
+  }
+
+  return key;
+}
+}  // namespace
+
+std::shared_ptr<const relaxation_coupling> band_coupling(
+    const QuantumIdentifier& bnd_qid, const band_data& bnd) {
+  struct entry {
+    std::shared_ptr<const relaxation_coupling> coupling;
+    Size last_use;
+  };
+
+  static std::mutex mtx;
+  static std::map<std::vector<Index>, entry> cache;
+  static Size uses = 0;
+
+  auto key = coupling_key(bnd_qid, bnd);
+
+  {
+    std::lock_guard lock(mtx);
+    if (auto ptr = cache.find(key); ptr != cache.end()) {
+      ptr->second.last_use = ++uses;
+      return ptr->second.coupling;
+    }
+  }
+
+  std::shared_ptr<const relaxation_coupling> out;
+  if (bnd.lineshape == LineByLineLineshape::VP_ECS_MAKAROV) {
+    out = std::make_shared<const relaxation_coupling>(
+        makarov::coupling(bnd_qid, bnd));
+  } else if (bnd.lineshape == LineByLineLineshape::VP_ECS_HARTMANN) {
+    out = std::make_shared<const relaxation_coupling>(
+        hartmann::coupling(bnd_qid, bnd));
+  } else {
+    ARTS_USER_ERROR("UNKNOWN ECS LINE SHAPE {}", bnd.lineshape)
+  }
+
+  std::lock_guard lock(mtx);
+  if (auto ptr = cache.find(key); ptr != cache.end()) {
+    ptr->second.last_use = ++uses;
+    return ptr->second.coupling;
+  }
+
+  //! Bands in use keep their coupling alive through the returned pointer
+  if (cache.size() >= band_coupling_cache_size) {
+    cache.erase(std::ranges::min_element(cache, {}, [](const auto& x) {
+      return x.second.last_use;
+    }));
+  }
+
+  cache.emplace(std::move(key), entry{out, ++uses});
+  return out;
+}
+
+namespace {
+/** The equivalent lines at zero pressure, in the order of the band lines
+ *
+ * Without collisions the equivalent lines are the lines themselves.
+ */
+void zero_pressure_limit(ComplexVector& str0,
+                         ComplexVector& val0,
+                         const QuantumIdentifier& bnd_qid,
+                         const band_data& bnd,
+                         const Numeric T) {
+  const Size n = bnd.size();
+  str0.resize(n);
+  val0.resize(n);
+
+  const Numeric QT = PartitionFunctions::Q(T, bnd_qid.Isotopologue());
+  for (Size i = 0; i < n; i++) {
+    const auto& line = bnd.lines[i];
+    const Numeric pop = line.gu * exp(-line.e0 / (Constant::k * T)) / QT;
+    const Numeric dip = 0.5 * Constant::c *
+                        std::sqrt(line.a / (Math::pow3(line.f0) * Constant::two_pi));
+    str0[i] = pop * dip * dip;
+    val0[i] = line.f0;
+  }
+}
+
+/** The band line of each equivalent line
+ *
+ * Each eigenvector is paired with the line that dominates it, taking the
+ * largest components first so that every line is paired exactly once.  This
+ * follows the quantum numbers of the lines rather than the order of the
+ * eigenvalues, which may change between atmospheric states.
+ *
+ * @param[in] V The eigenvectors as columns, rows in the order of sort
+ * @param[in] sort The band line of each row
+ * @return The band line of each column
+ */
+ArrayOfIndex dominant_lines(const ExhaustiveConstComplexMatrixView& V,
+                            const ArrayOfIndex& sort) {
+  const Index n = V.nrows();
+
+  std::vector<std::pair<Numeric, Index>> weights;
+  weights.reserve(n * n);
+  for (Index j = 0; j < n; j++) {
+    for (Index i = 0; i < n; i++) {
+      weights.emplace_back(std::norm(V(j, i)), j * n + i);
+    }
+  }
+  std::ranges::sort(weights, std::greater{});
+
+  ArrayOfIndex out(n, -1);
+  std::vector<bool> taken(n, false);
+  for (auto& [w, ji] : weights) {
+    const Index j = ji / n;
+    const Index i = ji % n;
+    if (taken[j] or out[i] >= 0) continue;
+    taken[j] = true;
+    out[i]   = sort[j];
+  }
+  return out;
+}
+
+/** Computes the equivalent lines by full diagonalization
+ *
+ * The equivalent lines are returned in the order of the band lines, see
+ * dominant_lines.
+ */
+void direct_equivalent_lines(ComputeData& com_data,
+                             const QuantumIdentifier& bnd_qid,
+                             const band_data& bnd,
+                             const linemixing::species_data_map& rovib_data,
+                             const AtmPoint& atm,
+                             const bool presorted) {
+  if (bnd.front().ls.one_by_one) {
+    com_data.adapt_multi(bnd_qid, bnd, rovib_data, atm, presorted);
+  } else {
+    com_data.adapt_single(bnd_qid, bnd, rovib_data, atm, presorted);
+  }
+
+  com_data.core_calc_eqv(true);
+}
+
+//! The lower grid index and weight of x, assumes grid.size() > 1
+std::pair<Index, Numeric> linear_weight(const AscendingGrid& grid,
+                                        const Numeric x) {
+  const Index i = std::clamp<Index>(
+      std::distance(grid.begin(), std::upper_bound(grid.begin(), grid.end(), x)) - 1,
+      0,
+      grid.size() - 2);
+  return {i, (x - grid[i]) / (grid[i + 1] - grid[i])};
+}
+}  // namespace
+
 ComputeData::ComputeData(const ExhaustiveConstVectorView& f_grid,
                          const AtmPoint& atm,
                          const Vector2& los,
@@ -82,7 +266,7 @@ void ComputeData::update_zeeman(const Vector2& los,
   npm = zeeman::norm_view(pol, mag, los);
 }
 
-void ComputeData::core_calc_eqv() {
+void ComputeData::core_calc_eqv(const bool by_line) {
   /* FIXME:  (Added 2021-01-19; Richard Larsson)
     * 
     * This function cannot easily be used with partial derivatives
@@ -103,37 +287,61 @@ void ComputeData::core_calc_eqv() {
   const auto n = pop.size();
   const auto m = vmrs.size();
 
+  String error{};
+
+#pragma omp parallel for if (not arts_omp_in_parallel() and m > 1)
   for (Index k = 0; k < m; k++) {
-    auto V = Vs[k];
-    auto W = Ws[k];
-    inplace_transpose(W);
-    auto eqv_str = eqv_strs[k];
-    auto eqv_val = eqv_vals[k];
+    try {
+      auto V = Vs[k];
+      auto W = Ws[k];
+      inplace_transpose(W);
+      auto eqv_str = eqv_strs[k];
+      auto eqv_val = eqv_vals[k];
+
+      diagonalize(V, eqv_val, W);
+
+      // Do the matrix forward multiplication
+      for (Index i = 0; i < n; i++) {
+        for (Index j = 0; j < n; j++) {
+          eqv_str[i] += dip[j] * V(j, i);
+        }
+      }
 
-    diagonalize(V, eqv_val, W);
+      // Pair before the solver overwrites V
+      const ArrayOfIndex line =
+          by_line ? dominant_lines(V, sort) : ArrayOfIndex{};
 
-    // Do the matrix forward multiplication
-    for (Index i = 0; i < n; i++) {
-      for (Index j = 0; j < n; j++) {
-        eqv_str[i] += dip[j] * V(j, i);
+      // Do the matrix backward multiplication, solving V z = pop * dip
+      ComplexVector z(n);
+      for (Index j = 0; j < n; j++) z[j] = pop[j] * dip[j];
+      solve_inplace(z, V);
+      for (Index i = 0; i < n; i++) {
+        eqv_str[i] *= z[i];
       }
-    }
 
-    // Do the matrix backward multiplication
-    inv(V, V);
-    for (Index i = 0; i < n; i++) {
-      Complex z(0, 0);
-      for (Index j = 0; j < n; j++) {
-        z += pop[j] * dip[j] * V(i, j);
+      if (by_line) {
+        const ComplexVector str{eqv_str};
+        const ComplexVector val{eqv_val};
+        for (Index i = 0; i < n; i++) {
+          eqv_str[line[i]] = str[i];
+          eqv_val[line[i]] = val[i];
+        }
       }
-      eqv_str[i] *= z;
+    } catch (std::exception& e) {
+#pragma omp critical
+      error += e.what();
     }
   }
+
+  ARTS_USER_ERROR_IF(not error.empty(), "{}", error)
 }
 
 void ComputeData::core_calc(const ExhaustiveConstVectorView& f_grid) {
   core_calc_eqv();
+  core_calc_shape(f_grid);
+}
 
+void ComputeData::core_calc_shape(const ExhaustiveConstVectorView& f_grid) {
   const auto m = vmrs.size();
   const auto n = f_grid.size();
   shape = 0;
@@ -247,34 +455,60 @@ void ComputeData::adapt_multi(const QuantumIdentifier& bnd_qid,
 
   for (Size i = 0; i < m; i++) {
     const auto spec = bnd.front().ls.single_models[i].species;
+    ARTS_USER_ERROR_IF(not rovib_data.contains(spec),
+                       "No rovib data for species {}",
+                       spec)
+    vmrs[i] = spec == SpeciesEnum::Bath ? 1 - sum(vmrs) : atm[spec];
+  }
 
-    const auto& rovib_data_it = rovib_data.find(spec);
-    ARTS_USER_ERROR_IF(
-        rovib_data_it == rovib_data.end(), "No rovib data for species {}", spec)
+  const auto coupling = band_coupling(bnd_qid, bnd);
 
-    vmrs[i] = spec == SpeciesEnum::Bath ? 1 - sum(vmrs) : atm[spec];
+  String error{};
 
-    Wimag = 0.0;
-    for (Size k = 0; k < n; k++) {
-      Wimag(k, k) = bnd.lines[sort[k]].ls.single_models[i].G0(
-          bnd.lines[sort[k]].ls.T0, atm.temperature, atm.pressure);
-      Ws[i](k, k) = bnd.lines[sort[k]].ls.single_models[i].D0(
-          bnd.lines[sort[k]].ls.T0, atm.temperature, atm.pressure);
-    }
+#pragma omp parallel for if (not arts_omp_in_parallel() and m > 1)
+  for (Size i = 0; i < m; i++) {
+    try {
+      const auto spec = bnd.front().ls.single_models[i].species;
+
+      Matrix W(n, n, 0.0);
+      for (Size k = 0; k < n; k++) {
+        W(k, k) = bnd.lines[sort[k]].ls.single_models[i].G0(
+            bnd.lines[sort[k]].ls.T0, atm.temperature, atm.pressure);
+        Ws[i](k, k) = bnd.lines[sort[k]].ls.single_models[i].D0(
+            bnd.lines[sort[k]].ls.T0, atm.temperature, atm.pressure);
+      }
 
-    if (bnd.lineshape == LineByLineLineshape::VP_ECS_MAKAROV) {
-      makarov::relaxation_matrix_offdiagonal(
-          Wimag, bnd_qid, bnd, sort, spec, rovib_data_it->second, dipr, atm);
-    } else if (bnd.lineshape == LineByLineLineshape::VP_ECS_HARTMANN) {
-      hartmann::relaxation_matrix_offdiagonal(
-          Wimag, bnd_qid, bnd, sort, spec, rovib_data_it->second, dipr, atm);
-    } else {
-      ARTS_USER_ERROR("UNKNOWN ECS LINE SHAPE {}", bnd.lineshape)
-    }
+      if (bnd.lineshape == LineByLineLineshape::VP_ECS_MAKAROV) {
+        makarov::relaxation_matrix_offdiagonal(W,
+                                               bnd_qid,
+                                               bnd,
+                                               *coupling,
+                                               sort,
+                                               spec,
+                                               rovib_data.at(spec),
+                                               dipr,
+                                               atm);
+      } else {
+        hartmann::relaxation_matrix_offdiagonal(W,
+                                                bnd_qid,
+                                                bnd,
+                                                *coupling,
+                                                sort,
+                                                spec,
+                                                rovib_data.at(spec),
+                                                dipr,
+                                                atm);
+      }
 
-    Ws[i].imag() = Wimag;
+      Ws[i].imag() = W;
+    } catch (std::exception& e) {
+#pragma omp critical
+      error += e.what();
+    }
   }
 
+  ARTS_USER_ERROR_IF(not error.empty(), "{}", error)
+
   for (Size i = 0; i < n; i++) {
     Ws(joker, i, i) += bnd.lines[sort[i]].f0;
   }
@@ -371,6 +605,8 @@ void ComputeData::adapt_single(const QuantumIdentifier& bnd_qid,
     ARTS_USER_ERROR_IF(not lines_have_same_species, "Bad species combination")
   }
 
+  const auto coupling = band_coupling(bnd_qid, bnd);
+
   Numeric vmr = 0;
   for (Size i = 0; i < bnd.front().ls.single_models.size(); i++) {
     const auto spec = bnd.front().ls.single_models[i].species;
@@ -389,13 +625,25 @@ void ComputeData::adapt_single(const QuantumIdentifier& bnd_qid,
     }
 
     if (bnd.lineshape == LineByLineLineshape::VP_ECS_MAKAROV) {
-      makarov::relaxation_matrix_offdiagonal(
-          Wimag, bnd_qid, bnd, sort, spec, rovib_data_it->second, dipr, atm);
-    } else if (bnd.lineshape == LineByLineLineshape::VP_ECS_HARTMANN) {
-      hartmann::relaxation_matrix_offdiagonal(
-          Wimag, bnd_qid, bnd, sort, spec, rovib_data_it->second, dipr, atm);
+      makarov::relaxation_matrix_offdiagonal(Wimag,
+                                             bnd_qid,
+                                             bnd,
+                                             *coupling,
+                                             sort,
+                                             spec,
+                                             rovib_data_it->second,
+                                             dipr,
+                                             atm);
     } else {
-      ARTS_USER_ERROR("UNKNOWN ECS LINE SHAPE {}", bnd.lineshape)
+      hartmann::relaxation_matrix_offdiagonal(Wimag,
+                                              bnd_qid,
+                                              bnd,
+                                              *coupling,
+                                              sort,
+                                              spec,
+                                              rovib_data_it->second,
+                                              dipr,
+                                              atm);
     }
 
     for (Size ir = 0; ir < n; ir++) {
@@ -415,6 +663,70 @@ void ComputeData::adapt_single(const QuantumIdentifier& bnd_qid,
   }
 }
 
+void ComputeData::adapt_table(const QuantumIdentifier& bnd_qid,
+                              const band_data& bnd,
+                              const linemixing::equivalent_line_table& table,
+                              const AtmPoint& atm) {
+  const bool one_by_one = bnd.front().ls.one_by_one;
+  const Index n         = bnd.size();
+  const Index m = one_by_one ? bnd.front().ls.single_models.size() : 1;
+
+  ARTS_USER_ERROR_IF(
+      table.str.nrows() != m or table.str.ncols() != n,
+      "The equivalent line table of band {} does not match the band, it must be recomputed",
+      bnd_qid)
+  ARTS_USER_ERROR_IF(
+      atm.temperature < table.T.front() or atm.temperature > table.T.back(),
+      "The temperature {} K is outside the equivalent line table of band {}, [{}, {}] K",
+      atm.temperature,
+      bnd_qid,
+      table.T.front(),
+      table.T.back())
+
+  gd_fac = std::sqrt(Constant::doppler_broadening_const_squared *
+                     atm.temperature / bnd_qid.Isotopologue().mass);
+
+  vmrs.resize(m);
+  if (one_by_one) {
+    vmrs = 0;
+    for (Index k = 0; k < m; k++) {
+      const auto spec = bnd.front().ls.single_models[k].species;
+      vmrs[k] = spec == SpeciesEnum::Bath ? 1 - sum(vmrs) : atm[spec];
+    }
+  } else {
+    vmrs = 1;
+  }
+
+  const auto [it, tw] = linear_weight(table.T, atm.temperature);
+
+  //! The normalized deviation is constant outside the pressure grid
+  Index ip = 0, jp = 0;
+  Numeric pw = 0;
+  if (table.P.size() > 1) {
+    const Numeric p =
+        std::clamp(atm.pressure, table.P.front(), table.P.back());
+    std::tie(ip, pw) = linear_weight(table.P, p);
+    jp               = ip + 1;
+  }
+
+  const auto interp = [&](const ComplexTensor4& x, Index k, Index i) {
+    return (1 - tw) * ((1 - pw) * x(it, ip, k, i) + pw * x(it, jp, k, i)) +
+           tw * ((1 - pw) * x(it + 1, ip, k, i) + pw * x(it + 1, jp, k, i));
+  };
+
+  ComplexVector str0, val0;
+  zero_pressure_limit(str0, val0, bnd_qid, bnd, atm.temperature);
+
+  eqv_strs.resize(m, n);
+  eqv_vals.resize(m, n);
+  for (Index k = 0; k < m; k++) {
+    for (Index i = 0; i < n; i++) {
+      eqv_strs(k, i) = str0[i] + atm.pressure * interp(table.str, k, i);
+      eqv_vals(k, i) = val0[i] + atm.pressure * interp(table.val, k, i);
+    }
+  }
+}
+
 void calculate(PropmatVectorView pm,
                matpack::matpack_view<Propmat, 2, false, true>,
                ComputeData& com_data,
@@ -423,6 +735,7 @@ void calculate(PropmatVectorView pm,
                const QuantumIdentifier& bnd_qid,
                const band_data& bnd,
                const linemixing::species_data_map& rovib_data,
+               const linemixing::equivalent_line_table* table,
                const AtmPoint& atm,
                const zeeman::pol pol,
                const bool no_negative_absorption) {
@@ -439,15 +752,18 @@ void calculate(PropmatVectorView pm,
 
   if (bnd.size() == 0) return;
 
-  const bool one_by_one = bnd.front().ls.one_by_one;
-
-  if (one_by_one) {
-    com_data.adapt_multi(bnd_qid, bnd, rovib_data, atm);
+  if (table) {
+    com_data.adapt_table(bnd_qid, bnd, *table, atm);
+    com_data.core_calc_shape(f_grid);
   } else {
-    com_data.adapt_single(bnd_qid, bnd, rovib_data, atm);
-  }
+    if (bnd.front().ls.one_by_one) {
+      com_data.adapt_multi(bnd_qid, bnd, rovib_data, atm);
+    } else {
+      com_data.adapt_single(bnd_qid, bnd, rovib_data, atm);
+    }
 
-  com_data.core_calc(f_grid);
+    com_data.core_calc(f_grid);
+  }
 
   for (Index i = 0; i < f_grid.size(); ++i) {
     const auto F = Constant::sqrt_ln_2 / Constant::sqrt_pi *
@@ -515,4 +831,116 @@ void equivalent_values(ExhaustiveComplexTensor3View eqv_str,
     }
   }
 }
-}  // namespace lbl::voigt::ecs
\ No newline at end of file
+
+linemixing::equivalent_line_table tabulate(
+    const QuantumIdentifier& bnd_qid,
+    const band_data& bnd,
+    const linemixing::species_data_map& rovib_data,
+    const AtmPoint& atm,
+    const AscendingGrid& T,
+    const AscendingGrid& P) {
+  ARTS_USER_ERROR_IF(bnd.size() == 0, "Band {} has no lines", bnd_qid)
+  ARTS_USER_ERROR_IF(
+      T.size() < 2, "Need at least two temperatures to tabulate band {}", bnd_qid)
+  ARTS_USER_ERROR_IF(P.size() < 1 or P.front() <= 0,
+                     "Need at least one positive pressure to tabulate band {}",
+                     bnd_qid)
+
+  const bool one_by_one = bnd.front().ls.one_by_one;
+  const Index n         = bnd.size();
+  const Index m  = one_by_one ? bnd.front().ls.single_models.size() : 1;
+  const Index nt = T.size();
+  const Index np = P.size();
+
+  linemixing::equivalent_line_table table{.T   = T,
+                                          .P   = P,
+                                          .str = ComplexTensor4(nt, np, m, n),
+                                          .val = ComplexTensor4(nt, np, m, n)};
+
+  //! The sorting of the lines is kept from the reference point
+  ComputeData com_data({}, atm);
+  if (one_by_one) {
+    com_data.adapt_multi(bnd_qid, bnd, rovib_data, atm, false);
+  } else {
+    com_data.adapt_single(bnd_qid, bnd, rovib_data, atm, false);
+  }
+
+  String error{};
+
+#pragma omp parallel for if (not arts_omp_in_parallel()) firstprivate(com_data)
+  for (Index itp = 0; itp < nt * np; itp++) {
+    try {
+      const Index it = itp / np;
+      const Index ip = itp % np;
+
+      AtmPoint atm_copy    = atm;
+      atm_copy.temperature = T[it];
+      atm_copy.pressure    = P[ip];
+      direct_equivalent_lines(
+          com_data, bnd_qid, bnd, rovib_data, atm_copy, true);
+
+      ComplexVector str0, val0;
+      zero_pressure_limit(str0, val0, bnd_qid, bnd, T[it]);
+
+      for (Index k = 0; k < m; k++) {
+        for (Index i = 0; i < n; i++) {
+          table.str(it, ip, k, i) = (com_data.eqv_strs(k, i) - str0[i]) / P[ip];
+          table.val(it, ip, k, i) = (com_data.eqv_vals(k, i) - val0[i]) / P[ip];
+        }
+      }
+    } catch (std::exception& e) {
+#pragma omp critical
+      error += e.what();
+    }
+  }
+
+  ARTS_USER_ERROR_IF(not error.empty(), "{}", error)
+
+  //! The errors are largest between the grid points
+  const Index nte = nt - 1;
+  const Index npe = np == 1 ? 1 : np - 1;
+  Vector str_error(nte * npe), val_error(nte * npe);
+  ComputeData tab_data({}, atm);
+
+#pragma omp parallel for if (not arts_omp_in_parallel()) \
+    firstprivate(com_data, tab_data)
+  for (Index itp = 0; itp < nte * npe; itp++) {
+    try {
+      const Index it = itp / npe;
+      const Index ip = itp % npe;
+
+      AtmPoint atm_copy    = atm;
+      atm_copy.temperature = 0.5 * (T[it] + T[it + 1]);
+      atm_copy.pressure    = np == 1 ? P[0] : 0.5 * (P[ip] + P[ip + 1]);
+      direct_equivalent_lines(
+          com_data, bnd_qid, bnd, rovib_data, atm_copy, true);
+      tab_data.adapt_table(bnd_qid, bnd, table, atm_copy);
+
+      Numeric dstr = 0, str = 0, dval = 0, val = 0;
+      for (Index k = 0; k < m; k++) {
+        for (Index i = 0; i < n; i++) {
+          dstr = std::max(
+              dstr, std::abs(tab_data.eqv_strs(k, i) - com_data.eqv_strs(k, i)));
+          dval = std::max(
+              dval, std::abs(tab_data.eqv_vals(k, i) - com_data.eqv_vals(k, i)));
+          str = std::max(str, std::abs(com_data.eqv_strs(k, i)));
+          val = std::max(val, std::abs(com_data.eqv_vals(k, i).imag()));
+        }
+      }
+
+      str_error[itp] = str > 0 ? dstr / str : dstr;
+      val_error[itp] = val > 0 ? dval / val : dval;
+    } catch (std::exception& e) {
+#pragma omp critical
+      error += e.what();
+    }
+  }
+
+  ARTS_USER_ERROR_IF(not error.empty(), "{}", error)
+
+  table.str_error = max(str_error);
+  table.val_error = max(val_error);
+
+  return table;
+}
+}  // namespace lbl::voigt::ecs
@@ -2,6 +2,9 @@
 
 #include <rtepack.h>
 
+#include <memory>
+#include <vector>
+
 #include "array.h"
 #include "lbl_data.h"
 #include "lbl_lineshape_linemixing.h"
@@ -12,6 +15,83 @@ struct Targets;
 }  // namespace Jacobian
 
 namespace lbl::voigt::ecs {
+/** The temperature-independent part of the off-diagonal relaxation matrix
+ *
+ * The coupling of two lines is a sum over basis rates of order L.  This keeps
+ * the Wigner symbols and the other quantum number factors of each term, for
+ * all pairs of lines in band order.  Only the basis rates have to be computed
+ * per atmospheric point.
+ */
+struct relaxation_coupling {
+  //! The [first, last) terms of a pair of lines, if they are coupled at all
+  struct pair {
+    Size first{};
+    Size last{};
+    bool coupled{false};
+  };
+
+  //! The number of lines
+  Size n{};
+
+  //! The number of basis rates required
+  Index max_order{};
+
+  //! Size of lines x size of lines
+  std::vector<pair> pairs{};
+
+  //! The order L and the constant factor of each term
+  std::vector<Index> order{};
+  std::vector<Numeric> factor{};
+
+  //! The order of the basis rate that scales the couplings from a line
+  std::vector<Index> scale_order{};
+
+  relaxation_coupling() = default;
+  relaxation_coupling(Size nlines, Index maxL)
+      : n(nlines), max_order(maxL), pairs(n * n), scale_order(n) {}
+
+  [[nodiscard]] const pair& operator()(Size i, Size j) const {
+    return pairs[i * n + j];
+  }
+
+  //! Marks line i as coupled to line j, call before add_term for the pair
+  void couple(Size i, Size j) {
+    pairs[i * n + j] = {
+        .first = order.size(), .last = order.size(), .coupled = true};
+  }
+
+  //! Adds a term to the pair of the last call to couple
+  void add_term(Size i, Size j, Index L, Numeric x) {
+    order.push_back(L);
+    factor.push_back(x);
+    pairs[i * n + j].last = order.size();
+  }
+
+  //! The sum of the terms of a pair, weighted by the basis rates
+  [[nodiscard]] Numeric sum(const pair& p, const Vector& rates) const {
+    Numeric out = 0;
+    for (Size k = p.first; k < p.last; k++) out += factor[k] * rates[order[k]];
+    return out;
+  }
+};
+
+//! The number of band couplings kept by band_coupling
+inline constexpr Size band_coupling_cache_size = 256;
+
+/** The relaxation coupling of a band
+ *
+ * Computed on first use and then shared between all calls for bands with
+ * the same line shape and quantum numbers.  Thread-safe.  At most
+ * band_coupling_cache_size couplings are kept, the least recently used one
+ * is dropped first.
+ *
+ * @param[in] bnd_qid The band identifier
+ * @param[in] bnd The band, an ECS band
+ * @return The coupling in band line order
+ */
+std::shared_ptr<const relaxation_coupling> band_coupling(
+    const QuantumIdentifier& bnd_qid, const band_data& bnd);
+
 struct ComputeData {
   Numeric gd_fac{};  //! Doppler broadening factor of a band
 
@@ -52,7 +132,12 @@ struct ComputeData {
                      const Vector3& mag,
                      const zeeman::pol pol);
 
-  void core_calc_eqv();
+  /** Sets eqv_strs and eqv_vals from Ws
+   *
+   * @param[in] by_line Order the equivalent lines by their dominant band line
+   */
+  void core_calc_eqv(const bool by_line = false);
+  void core_calc_shape(const ExhaustiveConstVectorView& f_grid);
   void core_calc(const ExhaustiveConstVectorView& f_grid);
   void adapt_single(const QuantumIdentifier& bnd_qid,
                     const band_data& bnd,
@@ -64,6 +149,12 @@ struct ComputeData {
                    const linemixing::species_data_map& rovib_data,
                    const AtmPoint& atm,
                    const bool presorted = false);
+
+  //! Sets the equivalent lines by interpolation of a table, see tabulate
+  void adapt_table(const QuantumIdentifier& bnd_qid,
+                   const band_data& bnd,
+                   const linemixing::equivalent_line_table& table,
+                   const AtmPoint& atm);
 };
 
 void calculate(PropmatVectorView pm,
@@ -74,6 +165,7 @@ void calculate(PropmatVectorView pm,
                const QuantumIdentifier& bnd_qid,
                const band_data& bnd,
                const linemixing::species_data_map& rovib_data,
+               const linemixing::equivalent_line_table* table,
                const AtmPoint& atm,
                const zeeman::pol pol,
                const bool no_negative_absorption);
@@ -86,4 +178,26 @@ void equivalent_values(ExhaustiveComplexTensor3View eqv_str,
                        const linemixing::species_data_map& rovib_data,
                        const AtmPoint& atm,
                        const Vector& T);
+
+/** Tabulates the equivalent lines of a band
+ *
+ * The full diagonalization is done on all combinations of the temperature
+ * and pressure grids.  It is then repeated between all grid points to find
+ * the errors of the interpolated table.
+ *
+ * @param[in] bnd_qid The band identifier
+ * @param[in] bnd The band, an ECS band
+ * @param[in] rovib_data The ECS data of the isotopologue of the band
+ * @param[in] atm The atmospheric point, for all but temperature and pressure
+ * @param[in] T The temperature grid, at least two points
+ * @param[in] P The pressure grid, at least one point
+ * @return The table
+ */
+linemixing::equivalent_line_table tabulate(
+    const QuantumIdentifier& bnd_qid,
+    const band_data& bnd,
+    const linemixing::species_data_map& rovib_data,
+    const AtmPoint& atm,
+    const AscendingGrid& T,
+    const AscendingGrid& P);
 }  // namespace lbl::voigt::ecs
@@ -3,6 +3,7 @@
 #include "atm.h"
 #include "lbl_data.h"
 #include "lbl_lineshape_linemixing.h"
+#include "lbl_lineshape_voigt_ecs.h"
 
 namespace lbl::voigt::ecs::hartmann {
 #if DO_FAST_WIGNER
@@ -56,9 +57,72 @@ Numeric reduced_dipole(const Rational Jf,
   return +sqrt(2 * Jf + 1) * wigner3j(Jf, k, Ji, li, lf - li, -lf);
 }
 
+relaxation_coupling coupling(const QuantumIdentifier& bnd_qid,
+                             const band_data& bnd) {
+  const Size n = bnd.size();
+
+  // These are constant for a band
+  auto& l2    = bnd_qid.val[QuantumNumberType::l2];
+  Rational li = l2.upp();
+  Rational lf = l2.low();
+
+  using std::swap;
+  const bool swap_order = li > lf;
+  if (swap_order) swap(li, lf);
+  const int sgn = iseven(li + lf + 1) ? -1 : 1;
+
+  const auto maxL = n == 0 ? 0 : temp_init_size(bnd.max(QuantumNumberType::J));
+
+  relaxation_coupling out(n, maxL);
+  if (n == 0 or abs(li - lf) > 1) return out;
+
+  arts_wigner_thread_init(maxL);
+  for (Size i = 0; i < n; i++) {
+    auto& J     = bnd.lines[i].qn.val[QuantumNumberType::J];
+    Rational Ji = J.upp();
+    Rational Jf = J.low();
+    if (swap_order) swap(Ji, Jf);
+
+    out.scale_order[i] = Ji.toIndex();
+
+    for (Size j = 0; j < n; j++) {
+      if (i == j) continue;
+      auto& J_p     = bnd.lines[j].qn.val[QuantumNumberType::J];
+      Rational Ji_p = J_p.upp();
+      Rational Jf_p = J_p.low();
+      if (swap_order) swap(Ji_p, Jf_p);
+
+      // Select upper quantum number
+      if (Jf_p > Jf) continue;
+
+      Index L         = std::max(std::abs((Ji - Ji_p).toIndex()),
+                         std::abs((Jf - Jf_p).toIndex()));
+      L              += L % 2;
+      const Index Lf  = std::min((Ji + Ji_p).toIndex(), (Jf + Jf_p).toIndex());
+
+      const Numeric scl =
+          sgn * Numeric(2 * Ji_p + 1) * sqrt((2 * Jf + 1) * (2 * Jf_p + 1));
+
+      out.couple(i, j);
+      for (; L <= Lf; L += 2) {
+        const Numeric a = wig3(Ji_p, L, Ji, li, 0, -li);
+        const Numeric b = wig3(Jf_p, L, Jf, lf, 0, -lf);
+        const Numeric c = wig6(Ji, Jf, 1, Jf_p, Ji_p, L);
+        out.add_term(i, j, L, scl * a * b * c * Numeric(2 * L + 1));
+      }
+    }
+  }
+  arts_wigner_thread_free();
+
+  ARTS_USER_ERROR_IF(errno == EDOM, "Cannot compute the wigner symbols")
+
+  return out;
+}
+
 void relaxation_matrix_offdiagonal(ExhaustiveMatrixView& W,
                                    const QuantumIdentifier& bnd_qid,
                                    const band_data& bnd,
+                                   const relaxation_coupling& coupling,
                                    const ArrayOfIndex& sorting,
                                    const SpeciesEnum broadening_species,
                                    const linemixing::species_data& rovib_data,
@@ -77,14 +141,13 @@ void relaxation_matrix_offdiagonal(ExhaustiveMatrixView& W,
   using std::swap;
   const bool swap_order = li > lf;
   if (swap_order) swap(li, lf);
-  const int sgn = iseven(li + lf + 1) ? -1 : 1;
   if (abs(li - lf) > 1) return;
 
   const Numeric T = atm.temperature;
 
   const auto erot = erot_selection(bnd_qid.Isotopologue());
 
-  const auto maxL = temp_init_size(bnd.max(QuantumNumberType::J));
+  const auto maxL = coupling.max_order;
 
   const auto Om = [&]() {
     Vector out(maxL);
@@ -100,55 +163,36 @@ void relaxation_matrix_offdiagonal(ExhaustiveMatrixView& W,
     return out;
   }();
 
-  const auto Q = [&]() {
+  //! The basis rates of the terms
+  const auto rates = [&]() {
     Vector out(maxL);
     for (Index i = 0; i < maxL; i++)
-      out[i] = rovib_data.Q(i, atm.temperature, bnd.front().ls.T0, erot(i));
+      out[i] = rovib_data.Q(i, atm.temperature, bnd.front().ls.T0, erot(i)) /
+               Om[i];
     return out;
   }();
 
-  arts_wigner_thread_init(maxL);
   for (Size i = 0; i < n; i++) {
     auto& J     = bnd.lines[sorting[i]].qn.val[QuantumNumberType::J];
-    Rational Ji = J.upp();
-    Rational Jf = J.low();
-    if (swap_order) swap(Ji, Jf);
+    Rational Jf = swap_order ? J.upp() : J.low();
 
     for (Size j = 0; j < n; j++) {
       if (i == j) continue;
-      auto& J_p     = bnd.lines[sorting[j]].qn.val[QuantumNumberType::J];
-      Rational Ji_p = J_p.upp();
-      Rational Jf_p = J_p.low();
-      if (swap_order) swap(Ji_p, Jf_p);
 
-      // Select upper quantum number
-      if (Jf_p > Jf) continue;
+      const auto& pair = coupling(sorting[i], sorting[j]);
+      if (not pair.coupled) continue;
 
-      Index L         = std::max(std::abs((Ji - Ji_p).toIndex()),
-                         std::abs((Jf - Jf_p).toIndex()));
-      L              += L % 2;
-      const Index Lf  = std::min((Ji + Ji_p).toIndex(), (Jf + Jf_p).toIndex());
+      auto& J_p     = bnd.lines[sorting[j]].qn.val[QuantumNumberType::J];
+      Rational Jf_p = swap_order ? J_p.upp() : J_p.low();
 
-      Numeric sum = 0;
-      for (; L <= Lf; L += 2) {
-        const Numeric a  = wig3(Ji_p, L, Ji, li, 0, -li);
-        const Numeric b  = wig3(Jf_p, L, Jf, lf, 0, -lf);
-        const Numeric c  = wig6(Ji, Jf, 1, Jf_p, Ji_p, L);
-        sum             += a * b * c * Numeric(2 * L + 1) * Q[L] / Om[L];
-      }
-      const Numeric ECS = Om[Ji.toIndex()];
-      const Numeric scl = sgn * ECS * Numeric(2 * Ji_p + 1) *
-                          sqrt((2 * Jf + 1) * (2 * Jf_p + 1));
-      sum *= scl;
+      const Numeric sum = coupling.sum(pair, rates) *
+                          Om[coupling.scale_order[sorting[i]]];
 
       // Add to W and rescale to upwards element by the populations
       W(j, i) = sum;
       W(i, j) = sum * std::exp((erot(Jf_p) - erot(Jf)) / kelvin2joule(T));
     }
   }
-  arts_wigner_thread_free();
-
-  ARTS_USER_ERROR_IF(errno == EDOM, "Cannot compute the wigner symbols")
 
   // Undocumented negative absolute sign
   for (Size i = 0; i < n; i++)
@@ -2,6 +2,7 @@
 
 #include "lbl_data.h"
 #include "lbl_lineshape_linemixing.h"
+#include "lbl_lineshape_voigt_ecs.h"
 
 namespace lbl::voigt::ecs::makarov {
 #if DO_FAST_WIGNER
@@ -89,21 +90,8 @@ constexpr Numeric erot(const Rational N, const Rational j = -1) {
   }
 }
 
-void relaxation_matrix_offdiagonal(ExhaustiveMatrixView& W,
-                                   const QuantumIdentifier& bnd_qid,
-                                   const band_data& bnd,
-                                   const ArrayOfIndex& sorting,
-                                   const SpeciesEnum broadening_species,
-                                   const linemixing::species_data& rovib_data,
-                                   const Vector& dipr,
-                                   const AtmPoint& atm) {
-  using Conversion::kelvin2joule;
-
-  ARTS_USER_ERROR_IF(bnd_qid.Isotopologue() != "O2-66"_isot,
-                     "Bad isotopologue: {}", bnd_qid.Isotopologue())
-
-  if (bnd.size() == 0) return;
-
+relaxation_coupling coupling(const QuantumIdentifier& bnd_qid,
+                             const band_data& bnd) {
   const auto bk = [](const Rational& r) -> Numeric { return sqrt(2 * r + 1); };
 
   const auto n = bnd.size();
@@ -112,45 +100,30 @@ void relaxation_matrix_offdiagonal(ExhaustiveMatrixView& W,
   const Rational Si = S.upp();
   const Rational Sf = S.low();
 
-  const auto maxL = temp_init_size(bnd.max(QuantumNumberType::J),
-                                   bnd.max(QuantumNumberType::N));
-
-  const auto Om = [&]() {
-    Vector out(maxL);
-    for (Index i = 0; i < maxL; i++)
-      out[i] = rovib_data.Omega(atm.temperature,
-                                bnd.front().ls.T0,
-                                broadening_species == SpeciesEnum::Bath
-                                    ? atm.mean_mass()
-                                    : atm.mean_mass(broadening_species),
-                                bnd_qid.Isotopologue().mass,
-                                erot(i),
-                                erot(i - 2));
-    return out;
-  }();
+  const auto maxL = n == 0 ? 0
+                           : temp_init_size(bnd.max(QuantumNumberType::J),
+                                            bnd.max(QuantumNumberType::N));
 
-  const auto Q = [&]() {
-    Vector out(maxL);
-    for (Index i = 0; i < maxL; i++)
-      out[i] = rovib_data.Q(i, atm.temperature, bnd.front().ls.T0, erot(i));
-    return out;
-  }();
+  relaxation_coupling out(n, maxL);
+  if (n == 0) return out;
 
   arts_wigner_thread_init(maxL);
   for (Size i = 0; i < n; i++) {
-    auto& J = bnd.lines[sorting[i]].qn.val[QuantumNumberType::J];
-    auto& N = bnd.lines[sorting[i]].qn.val[QuantumNumberType::N];
+    auto& J = bnd.lines[i].qn.val[QuantumNumberType::J];
+    auto& N = bnd.lines[i].qn.val[QuantumNumberType::N];
 
     const Rational Ji = J.upp();
     const Rational Jf = J.low();
     const Rational Ni = N.upp();
     const Rational Nf = N.low();
 
+    out.scale_order[i] = Ni.toIndex();
+
     for (Size j = 0; j < n; j++) {
       if (i == j) continue;
 
-      auto& J_p = bnd.lines[sorting[j]].qn.val[QuantumNumberType::J];
-      auto& N_p = bnd.lines[sorting[j]].qn.val[QuantumNumberType::N];
+      auto& J_p = bnd.lines[j].qn.val[QuantumNumberType::J];
+      auto& N_p = bnd.lines[j].qn.val[QuantumNumberType::N];
 
       const Rational Ji_p = J_p.upp();
       const Rational Jf_p = J_p.low();
@@ -161,23 +134,84 @@ void relaxation_matrix_offdiagonal(ExhaustiveMatrixView& W,
 
       // Tran etal 2006 symbol with modifications:
       //    1) [Ji] * [Ji_p] instead of [Ji_p] ^ 2 in partial accordance with Makarov etal 2013
-      Numeric sum       = 0;
       const Numeric scl = (iseven(Ji_p + Ji + 1) ? 1 : -1) * bk(Ni) * bk(Nf) *
                           bk(Nf_p) * bk(Ni_p) * bk(Jf) * bk(Jf_p) * bk(Ji) *
                           bk(Ji_p);
       const auto [L0, L1] =
           wigner_limits(wigner3j_limits<3>(Ni_p, Ni),
                         {Rational(2), std::numeric_limits<Index>::max()});
+
+      out.couple(i, j);
       for (Rational L = L0; L <= L1; L += 2) {
         const Numeric a = wig3(Ni_p, Ni, L, 0, 0, 0);
         const Numeric b = wig3(Nf_p, Nf, L, 0, 0, 0);
         const Numeric c = wig6(L, Ji, Ji_p, Si, Ni_p, Ni);
         const Numeric d = wig6(L, Jf, Jf_p, Sf, Nf_p, Nf);
         const Numeric e = wig6(L, Ji, Ji_p, 1, Jf_p, Jf);
-        sum += a * b * c * d * e * Numeric(2 * L + 1) * Q[L.toIndex()] /
-               Om[L.toIndex()];
+        out.add_term(
+            i, j, L.toIndex(), scl * a * b * c * d * e * Numeric(2 * L + 1));
       }
-      sum *= scl * Om[Ni.toIndex()];
+    }
+  }
+  arts_wigner_thread_free();
+
+  ARTS_USER_ERROR_IF(errno == EDOM, "Cannot compute the wigner symbols")
+
+  return out;
+}
+
+void relaxation_matrix_offdiagonal(ExhaustiveMatrixView& W,
+                                   const QuantumIdentifier& bnd_qid,
+                                   const band_data& bnd,
+                                   const relaxation_coupling& coupling,
+                                   const ArrayOfIndex& sorting,
+                                   const SpeciesEnum broadening_species,
+                                   const linemixing::species_data& rovib_data,
+                                   const Vector& dipr,
+                                   const AtmPoint& atm) {
+  using Conversion::kelvin2joule;
+
+  ARTS_USER_ERROR_IF(bnd_qid.Isotopologue() != "O2-66"_isot,
+                     "Bad isotopologue: {}", bnd_qid.Isotopologue())
+
+  if (bnd.size() == 0) return;
+
+  const auto n = bnd.size();
+
+  const auto maxL = coupling.max_order;
+
+  const auto Om = [&]() {
+    Vector out(maxL);
+    for (Index i = 0; i < maxL; i++)
+      out[i] = rovib_data.Omega(atm.temperature,
+                                bnd.front().ls.T0,
+                                broadening_species == SpeciesEnum::Bath
+                                    ? atm.mean_mass()
+                                    : atm.mean_mass(broadening_species),
+                                bnd_qid.Isotopologue().mass,
+                                erot(i),
+                                erot(i - 2));
+    return out;
+  }();
+
+  //! The basis rates of the terms
+  const auto rates = [&]() {
+    Vector out(maxL);
+    for (Index i = 0; i < maxL; i++)
+      out[i] = rovib_data.Q(i, atm.temperature, bnd.front().ls.T0, erot(i)) /
+               Om[i];
+    return out;
+  }();
+
+  for (Size i = 0; i < n; i++) {
+    for (Size j = 0; j < n; j++) {
+      if (i == j) continue;
+
+      const auto& pair = coupling(sorting[i], sorting[j]);
+      if (not pair.coupled) continue;
+
+      const Numeric sum = coupling.sum(pair, rates) *
+                          Om[coupling.scale_order[sorting[i]]];
 
       // Add to W and rescale to upwards element by the populations
       W(i, j) = sum;
@@ -186,9 +220,6 @@ void relaxation_matrix_offdiagonal(ExhaustiveMatrixView& W,
                          kelvin2joule(atm.temperature));
     }
   }
-  arts_wigner_thread_free();
-
-  ARTS_USER_ERROR_IF(errno == EDOM, "Cannot compute the wigner symbols")
 
   // Sum rule correction
   for (Size i = 0; i < n; i++) {
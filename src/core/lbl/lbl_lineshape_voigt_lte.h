@@ -377,16 +377,20 @@ struct ComputeData {
   std::vector<Size>
       filter;  //! Filter for line parameters; resized all the time but reserves size of line shapes
 
-  ComplexVector cut{};   //! Size of line shapes
-  ComplexVector dz{};    //! Size of line shapes
-  Vector dz_fac{};       //! Size of line shapes
-  ComplexVector ds{};    //! Size of line shapes
-  ComplexVector dcut{};  //! Size of line shapes
-
-  Vector scl{};            //! Size of frequency
-  Vector dscl{};           //! Size of frequency
-  ComplexVector shape{};   //! Size of frequency
-  ComplexVector dshape{};  //! Size of frequency
+  //! Work arrays below are always written before they are read, so they are not zeroed on resize
+  template <typename T>
+  using work_vector = matpack::uninitialized_data<T, 1>;
+
+  work_vector<Complex> cut{};   //! Size of line shapes
+  work_vector<Complex> dz{};    //! Size of line shapes
+  work_vector<Numeric> dz_fac{};  //! Size of line shapes
+  work_vector<Complex> ds{};    //! Size of line shapes
+  work_vector<Complex> dcut{};  //! Size of line shapes
+
+  work_vector<Numeric> scl{};     //! Size of frequency
+  work_vector<Numeric> dscl{};    //! Size of frequency
+  work_vector<Complex> shape{};   //! Size of frequency
+  work_vector<Complex> dshape{};  //! Size of frequency
 
   Propmat npm{};      //! The orientation of the polarization
   Propmat dnpm_du{};  //! The orientation of the polarization
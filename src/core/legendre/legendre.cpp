@@ -3,6 +3,8 @@
 #include <boost/math/special_functions/legendre.hpp>
 #include <cmath>
 #include <iostream>
+#include <limits>
+#include <tuple>
 
 #include "arts_conversions.h"
 #include "debug.h"
@@ -75,6 +77,52 @@ std::pair<Matrix, Matrix> schmidt(const Numeric theta, const Index nmax) {
   return {P, dP};
 }
 
+namespace {
+//! The longitude terms of the field expansion
+void longitude_terms(std::vector<Numeric>& cosm,
+                     std::vector<Numeric>& sinm,
+                     const Numeric lon) {
+  const Numeric clon = longitude_clamp(lon);
+  for (Size m = 0; m < cosm.size(); ++m) {
+    cosm[m] = Conversion::cosd(static_cast<Numeric>(m) * clon);
+    sinm[m] = Conversion::sind(static_cast<Numeric>(m) * clon);
+  }
+}
+
+//! The field expansion for precomputed Legendre and longitude terms
+Vector3 field_sum(const Matrix& g,
+                  const Matrix& h,
+                  const Matrix& P,
+                  const Matrix& dP,
+                  const std::vector<Numeric>& cosm,
+                  const std::vector<Numeric>& sinm,
+                  const Numeric r_ratio,
+                  const Numeric sin_theta) {
+  const Index N = h.nrows();
+
+  Vector3 B    = {0, 0, 0};
+  Numeric ratn = r_ratio * r_ratio;
+  for (Index n = 1; n < N; ++n) {
+    ratn *= r_ratio;
+    for (Index m = 0; m < n + 1; ++m) {
+      B[0] +=
+          (g(n, m) * cosm[m] + h(n, m) * sinm[m]) * P(n, m) * (n + 1) * ratn;
+      B[1] -= (g(n, m) * cosm[m] + h(n, m) * sinm[m]) * dP(n, m) * ratn;
+      B[2] += (g(n, m) * sinm[m] - h(n, m) * cosm[m]) * P(n, m) * m * ratn;
+    }
+  }
+
+  // Fix the phi component if sin_theta is not zero
+  if (std::abs(sin_theta) > 1e-6) {
+    B[2] /= sin_theta;
+  } else {
+    B[2] = 0.0;
+  }
+
+  return B;
+}
+}  // namespace
+
 Vector3 schmidt_fieldcalc(const Matrix& g,
                           const Matrix& h,
                           const Numeric r0,
@@ -82,7 +130,7 @@ Vector3 schmidt_fieldcalc(const Matrix& g,
   const auto [r, lat, lon] = pos;
 
   ARTS_USER_ERROR_IF(
-      lat < -90 and lat > 90, "Latitude is {} should be in [-90, 90]", lat)
+      lat < -90 or lat > 90, "Latitude is {} should be in [-90, 90]", lat)
 
   const Index N = h.nrows();
 
@@ -96,34 +144,48 @@ Vector3 schmidt_fieldcalc(const Matrix& g,
   // Pre-compute the cosine/sine values
   std::vector<Numeric> cosm(N);
   std::vector<Numeric> sinm(N);
-  const Numeric clon = longitude_clamp(lon);
+  longitude_terms(cosm, sinm, lon);
 
-  for (Index m = 0; m < N; ++m) {
-    cosm[m] = Conversion::cosd(m * clon);
-    sinm[m] = Conversion::sind(m * clon);
-  }
+  return field_sum(g, h, P, dP, cosm, sinm, r0 / r, sin_theta);
+}
 
-  const Numeric r_ratio = r0 / r;
-  Vector3 B             = {0, 0, 0};
-  Numeric ratn          = r_ratio * r_ratio;
-  for (Index n = 1; n < N; ++n) {
-    ratn *= r_ratio;
-    for (Index m = 0; m < n + 1; ++m) {
-      B[0] +=
-          (g(n, m) * cosm[m] + h(n, m) * sinm[m]) * P(n, m) * (n + 1) * ratn;
-      B[1] -= (g(n, m) * cosm[m] + h(n, m) * sinm[m]) * dP(n, m) * ratn;
-      B[2] += (g(n, m) * sinm[m] - h(n, m) * cosm[m]) * P(n, m) * m * ratn;
+std::vector<Vector3> schmidt_fieldcalc(const Matrix& g,
+                                       const Matrix& h,
+                                       const Numeric r0,
+                                       const std::span<const Vector3> pos) {
+  const Index N = h.nrows();
+
+  std::vector<Vector3> out(pos.size());
+
+  std::vector<Numeric> cosm(N);
+  std::vector<Numeric> sinm(N);
+  Matrix P, dP;
+  Numeric sin_theta = 0.0;
+  Numeric last_lat  = std::numeric_limits<Numeric>::quiet_NaN();
+  Numeric last_lon  = std::numeric_limits<Numeric>::quiet_NaN();
+
+  for (Size i = 0; i < pos.size(); i++) {
+    const auto [r, lat, lon] = pos[i];
+
+    ARTS_USER_ERROR_IF(
+        lat < -90 or lat > 90, "Latitude is {} should be in [-90, 90]", lat)
+
+    if (lat != last_lat) {
+      const auto colat = Conversion::deg2rad(90.0 - lat);
+      sin_theta        = std::sin(colat);
+      std::tie(P, dP)  = schmidt(colat, N - 1);
+      last_lat         = lat;
     }
-  }
 
-  // Fix the phi component if sin_theta is not zero
-  if (std::abs(sin_theta) > 1e-6) {
-    B[2] /= sin_theta;
-  } else {
-    B[2] = 0.0;
+    if (lon != last_lon) {
+      longitude_terms(cosm, sinm, lon);
+      last_lon = lon;
+    }
+
+    out[i] = field_sum(g, h, P, dP, cosm, sinm, r0 / r, sin_theta);
   }
 
-  return B;
+  return out;
 }
 #ifndef _MSC_VER
 #pragma GCC diagnostic pop
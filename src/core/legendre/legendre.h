@@ -2,6 +2,9 @@
 
 #include <matpack.h>
 
+#include <span>
+#include <vector>
+
 #include "configtypes.h"
 #include "grids.h"
 
@@ -68,6 +71,25 @@ Vector3 schmidt_fieldcalc(const Matrix& g,
                           const Numeric r0,
                           const Vector3 pos);
 
+/** Computes the spherical field at many positions
+ *
+ * As the single-position version, but the longitude terms are only redone
+ * when the longitude changes, so order the positions so that neighbors share
+ * longitude to benefit.  The Legendre recursion is likewise skipped for
+ * repeated latitudes, but those are rare for geocentric positions made from
+ * geodetic ones, as the geocentric latitude changes with altitude.
+ *
+ * @param[in] g A N x N matrix of g-coefficients
+ * @param[in] h A N x N matrix of h-coefficients
+ * @param[in] r0 The reference radius (spherical)
+ * @param[in] pos The positions [r, lat, lon] (spherical)
+ * @return The spherical fields {Br, Btheta, Bphi} of all positions
+ */
+std::vector<Vector3> schmidt_fieldcalc(const Matrix& g,
+                                       const Matrix& h,
+                                       const Numeric r0,
+                                       const std::span<const Vector3> pos);
+
 /** Computes sum (s[i] P_i(x)) for all s [first is for P_0, second is for P_1, ...]
   * 
   * @param[in] s The coefficients
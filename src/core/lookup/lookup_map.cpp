@@ -3,7 +3,286 @@
 #include <arts_omp.h>
 #include <jacobian.h>
 
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <ranges>
+
 namespace lookup {
+namespace {
+//! The absorption cross-section of the species at all frequencies
+Vector cross_section(const SpeciesEnum& species,
+                     const AtmPoint& atm_point,
+                     const AscendingGrid& f_grid,
+                     const AbsorptionBands& absorption_bands,
+                     const LinemixingEcsData& ecs_data) {
+  PropmatVector pm(f_grid.size());
+  StokvecVector sv(f_grid.size());
+  PropmatMatrix dpm(0, f_grid.size());
+  StokvecMatrix dsv(0, f_grid.size());
+  const JacobianTargets jacobian_targets = {};
+  const Vector2 los                      = {180, 0};
+  const bool no_negative_absorption      = true;
+
+  lbl::calculate(pm,
+                 sv,
+                 dpm,
+                 dsv,
+                 f_grid,
+                 jacobian_targets,
+                 species,
+                 absorption_bands,
+                 ecs_data,
+                 atm_point,
+                 los,
+                 no_negative_absorption);
+
+  const Numeric inv_nd = 1.0 / atm_point.number_density(species);
+  Vector out(f_grid.size());
+  for (Index ifreq = 0; ifreq < f_grid.size(); ++ifreq) {
+    out[ifreq] = pm[ifreq].A() * inv_nd;
+  }
+  return out;
+}
+
+//! All indices of a grid of size n
+std::vector<Index> all_indices(Index n) {
+  std::vector<Index> out(n);
+  std::iota(out.begin(), out.end(), Index{0});
+  return out;
+}
+
+/** Computes the cross-sections of a table at some of its nodes
+ *
+ * All temperature and water perturbations are computed.
+ *
+ * @param[in,out] lut The table, xsec must already have its final shape
+ * @param[in] species The species of the table
+ * @param[in] atmref The reference atmosphere, matching the pressure grid
+ * @param[in] absorption_bands The absorption bands
+ * @param[in] ecs_data The line mixing data
+ * @param[in] p_index The pressure indices to compute
+ * @param[in] f_index The frequency indices to compute
+ */
+void compute_nodes(table& lut,
+                   const SpeciesEnum& species,
+                   const ArrayOfAtmPoint& atmref,
+                   const AbsorptionBands& absorption_bands,
+                   const LinemixingEcsData& ecs_data,
+                   const std::vector<Index>& p_index,
+                   const std::vector<Index>& f_index) {
+  if (p_index.empty() or f_index.empty()) return;
+
+  const bool do_water = lut.do_w();
+
+  const AscendingGrid empty_water({1.0});
+  const AscendingGrid empty_t_pert({0.0});
+  const AscendingGrid& water_vmr_local(do_water ? *lut.w_pert : empty_water);
+  const AscendingGrid& t_pert_local(lut.do_t() ? *lut.t_pert : empty_t_pert);
+
+  const bool all_f = static_cast<Index>(f_index.size()) == lut.f_size();
+  const AscendingGrid f_part =
+      all_f ? AscendingGrid{}
+            : AscendingGrid(f_index.begin(), f_index.end(), [&lut](Index i) {
+                                return (*lut.f_grid)[i];
+                              });
+  const AscendingGrid& f_local = all_f ? *lut.f_grid : f_part;
+
+  String error;
+
+#pragma omp parallel for collapse(3) if (not arts_omp_in_parallel())
+  for (Index it = 0; it < t_pert_local.size(); ++it) {
+    for (Index iw = 0; iw < water_vmr_local.size(); ++iw) {
+      for (Size k = 0; k < p_index.size(); ++k) {
+        try {
+          const Index ip         = p_index[k];
+          AtmPoint atm_point     = atmref[ip];
+          atm_point.temperature += t_pert_local[it];
+          if (do_water) atm_point["H2O"_spec] *= water_vmr_local[iw];
+
+          const Vector x = cross_section(
+              species, atm_point, f_local, absorption_bands, ecs_data);
+          for (Size j = 0; j < f_index.size(); ++j) {
+            lut.xsec(it, iw, ip, f_index[j]) = x[j];
+          }
+        } catch (std::runtime_error& e) {
+#pragma omp critical
+          error += std::format("ERROR:\n{}\n\n", e.what());
+        }
+      }
+    }
+  }
+
+  ARTS_USER_ERROR_IF(not error.empty(), "{}", error)
+}
+
+/** The reference atmosphere at all temperature and water perturbations
+ *
+ * @param[in] atmref The reference atmosphere
+ * @param[in] t_pert The temperature perturbations, may be null or empty
+ * @param[in] w_pert The water perturbations, may be null or empty
+ * @return All the atmospheric points that cross-sections are computed at
+ */
+ArrayOfAtmPoint perturbed_atmospheres(
+    const ArrayOfAtmPoint& atmref,
+    const std::shared_ptr<const AscendingGrid>& t_pert,
+    const std::shared_ptr<const AscendingGrid>& w_pert) {
+  const bool do_temperature = t_pert and not t_pert->empty();
+  const bool do_water       = w_pert and not w_pert->empty();
+
+  const AscendingGrid empty_water({1.0});
+  const AscendingGrid empty_t_pert({0.0});
+  const AscendingGrid& w_pert_local(do_water ? *w_pert : empty_water);
+  const AscendingGrid& t_pert_local(do_temperature ? *t_pert : empty_t_pert);
+
+  ArrayOfAtmPoint out;
+  out.reserve(atmref.size() * t_pert_local.size() * w_pert_local.size());
+  for (const AtmPoint& ref : atmref) {
+    for (const Numeric dt : t_pert_local) {
+      for (const Numeric w : w_pert_local) {
+        AtmPoint& atm_point    = out.emplace_back(ref);
+        atm_point.temperature += dt;
+        if (do_water) atm_point["H2O"_spec] *= w;
+      }
+    }
+  }
+  return out;
+}
+
+/** The largest shift of the line center of a line
+ *
+ * The cutoff is applied around the shifted line center, so this is how far
+ * outside of f0 plus-minus the cutoff the line still contributes.  Both the
+ * pressure shift of the full line shape and of each broadening species alone
+ * are considered, as well as the largest Zeeman splitting.  The Doppler shift
+ * by wind is applied to the frequency grid when the table is used, not to the
+ * stored cross-sections, so it is not part of the shift.
+ *
+ * @param[in] line The line
+ * @param[in] atm_points The atmospheric points to consider
+ * @return The largest absolute shift in Hz
+ */
+Numeric max_line_shift(const lbl::line& line,
+                       const ArrayOfAtmPoint& atm_points) {
+  Numeric splitting = 0.0;
+  if (line.z.on) {
+    for (const auto pol :
+         {lbl::zeeman::pol::sm, lbl::zeeman::pol::pi, lbl::zeeman::pol::sp}) {
+      const Index nz = line.z.size(line.qn.val, pol);
+      for (Index iz = 0; iz < nz; ++iz) {
+        splitting = std::max(
+            splitting, std::abs(line.z.Splitting(line.qn.val, pol, iz)));
+      }
+    }
+  }
+
+  Numeric out = 0.0;
+  for (const AtmPoint& atm : atm_points) {
+    Numeric shift = std::abs(line.ls.D0(atm) + line.ls.DV(atm));
+    for (const auto& model : line.ls.single_models) {
+      shift = std::max(
+          shift,
+          std::abs(model.D0(line.ls.T0, atm.temperature, atm.pressure) +
+                   model.DV(line.ls.T0, atm.temperature, atm.pressure)));
+    }
+
+    if (splitting > 0.0) {
+      shift += splitting * std::hypot(atm.mag[0], atm.mag[1], atm.mag[2]);
+    }
+
+    if (std::isfinite(shift)) out = std::max(out, shift);
+  }
+  return out;
+}
+
+/** The frequency range of the bands of the species
+ *
+ * The range of a band covers its line centers, plus-minus the cutoff and the
+ * largest shift of the line center at any of the atmospheric points.
+ *
+ * @param[in] species The species of the table
+ * @param[in] atm_points The atmospheric points of the table nodes
+ * @param[in] absorption_bands The absorption bands
+ * @return The frequency range of each band of the species
+ */
+std::unordered_map<QuantumIdentifier, Vector2> species_band_ranges(
+    const SpeciesEnum& species,
+    const ArrayOfAtmPoint& atm_points,
+    const AbsorptionBands& absorption_bands) {
+  std::unordered_map<QuantumIdentifier, Vector2> out;
+  for (const auto& [key, band] : absorption_bands) {
+    if (key.Species() != species or band.size() == 0) continue;
+
+    const Numeric cutoff = band.get_cutoff_frequency();
+    Vector2 range{std::numeric_limits<Numeric>::infinity(),
+                  -std::numeric_limits<Numeric>::infinity()};
+    for (const auto& line : band.lines) {
+      const Numeric shift = max_line_shift(line, atm_points);
+      range[0]            = std::min(range[0], line.f0 - shift - cutoff);
+      range[1]            = std::max(range[1], line.f0 + shift + cutoff);
+    }
+    out[key] = range;
+  }
+  return out;
+}
+
+//! Checks that atmref is the reference atmosphere of the table
+void check_atmref(const table& lut, const ArrayOfAtmPoint& atmref) {
+  const Vector& log_p = *lut.log_p_grid;
+  ARTS_USER_ERROR_IF(
+      static_cast<Index>(atmref.size()) != log_p.size(),
+      "The reference atmosphere has {} levels, the table has {}",
+      atmref.size(),
+      log_p.size())
+
+  const bool do_water = lut.do_w();
+  for (Size ip = 0; ip < atmref.size(); ++ip) {
+    const Numeric water = do_water ? atmref[ip]["H2O"_spec] : NAN;
+    ARTS_USER_ERROR_IF(
+        std::log(atmref[ip].pressure) != log_p[ip] or
+            atmref[ip].temperature != lut.t_atmref[ip] or
+            (do_water and water != lut.water_atmref[ip]),
+        R"(Level {} of the reference atmosphere is not that of the table
+  Pressure:    {} Pa, table {} Pa
+  Temperature: {} K, table {} K
+  Water VMR:   {}, table {}
+)",
+        ip,
+        atmref[ip].pressure,
+        std::exp(log_p[ip]),
+        atmref[ip].temperature,
+        lut.t_atmref[ip],
+        water,
+        do_water ? lut.water_atmref[ip] : NAN)
+  }
+}
+
+/** The positions of an old grid in a new grid that contains it
+ *
+ * @param[in] old_grid The old grid
+ * @param[in] new_grid The new grid
+ * @param[in] name The name of the grid, for errors
+ * @return For each element of new_grid, its index in old_grid or -1 if new
+ */
+std::vector<Index> old_positions(const Vector& old_grid,
+                                 const Vector& new_grid,
+                                 const std::string_view name) {
+  std::vector<Index> out(new_grid.size(), -1);
+  Index j = 0;
+  for (Index i = 0; i < old_grid.size(); ++i) {
+    while (j < new_grid.size() and new_grid[j] != old_grid[i]) ++j;
+    ARTS_USER_ERROR_IF(j == new_grid.size(),
+                       "The new {} grid does not contain the old value {}",
+                       name,
+                       old_grid[i])
+    out[j++] = i;
+  }
+  return out;
+}
+}  // namespace
+
 bool table::do_t() const { return t_pert and not t_pert->empty(); }
 
 bool table::do_w() const { return w_pert and not w_pert->empty(); }
@@ -66,57 +345,192 @@ table::table(const SpeciesEnum& species,
         return x.temperature;
       });
 
-  String error;
-  PropmatVector pm(f_grid->size());
-  StokvecVector sv(f_grid->size());
-  PropmatMatrix dpm(0, f_grid->size());
-  StokvecMatrix dsv(0, f_grid->size());
-  const JacobianTargets jacobian_targets = {};
-  const Vector2 los                      = {180, 0};
-  const bool no_negative_absorption      = true;
+  compute_nodes(*this,
+                species,
+                atmref,
+                absorption_bands,
+                ecs_data,
+                all_indices(p_size()),
+                all_indices(f_size()));
 
-  const AscendingGrid empty_water({1.0});
-  const AscendingGrid empty_t_pert({0.0});
-  const AscendingGrid& water_vmr_local(do_water ? *w_pert : empty_water);
-  const AscendingGrid& t_pert_local(do_t() ? *t_pert : empty_t_pert);
+  band_ranges = species_band_ranges(
+      species, perturbed_atmospheres(atmref, t_pert, w_pert), absorption_bands);
+}
+ARTS_METHOD_ERROR_CATCH
 
-#pragma omp parallel for collapse(3) if (not arts_omp_in_parallel()) \
-    firstprivate(pm, sv, dpm, dsv)
-  for (Index it = 0; it < t_pert_local.size(); ++it) {
-    for (Index iw = 0; iw < water_vmr_local.size(); ++iw) {
-      for (Size ip = 0; ip < atmref.size(); ++ip) {
-        try {
-          AtmPoint atm_point     = atmref[ip];
-          atm_point.temperature += t_pert_local[it];
-          if (do_water) atm_point["H2O"_spec] *= water_vmr_local[iw];
+Index table::update_bands(const SpeciesEnum& species,
+                          const ArrayOfAtmPoint& atmref,
+                          const AbsorptionBands& absorption_bands,
+                          const LinemixingEcsData& ecs_data,
+                          const ArrayOfQuantumIdentifier& changed_bands) try {
+  check();
+  check_atmref(*this, atmref);
 
-          pm = 0.0;
-          lbl::calculate(pm,
-                         sv,
-                         dpm,
-                         dsv,
-                         *f_grid,
-                         jacobian_targets,
-                         species,
-                         absorption_bands,
-                         ecs_data,
-                         atm_point,
-                         los,
-                         no_negative_absorption);
-
-          const Numeric inv_nd = 1.0 / atm_point.number_density(species);
-          for (Index ifreq = 0; ifreq < f_grid->size(); ++ifreq) {
-            xsec(it, iw, ip, ifreq) = pm[ifreq].A() * inv_nd;
-          }
-        } catch (std::runtime_error& e) {
-#pragma omp critical
-          error += std::format("ERROR:\n{}\n\n", e.what());
-        }
-      }
+  auto new_ranges = species_band_ranges(
+      species, perturbed_atmospheres(atmref, t_pert, w_pert), absorption_bands);
+
+  std::vector<Vector2> affected;
+  for (const auto& [key, range] : band_ranges) {
+    if (not new_ranges.contains(key)) affected.push_back(range);
+  }
+  for (const auto& [key, range] : new_ranges) {
+    if (not band_ranges.contains(key)) affected.push_back(range);
+  }
+  for (const auto& key : changed_bands) {
+    if (auto ptr = band_ranges.find(key); ptr != band_ranges.end()) {
+      affected.push_back(ptr->second);
+    }
+    if (auto ptr = new_ranges.find(key); ptr != new_ranges.end()) {
+      affected.push_back(ptr->second);
     }
   }
 
-  ARTS_USER_ERROR_IF(not error.empty(), "{}", error)
+  std::vector<Index> f_index;
+  for (Index i = 0; i < f_size(); ++i) {
+    const Numeric f = (*f_grid)[i];
+    if (std::ranges::any_of(affected, [f](const Vector2& range) {
+          return range[0] <= f and f <= range[1];
+        })) {
+      f_index.push_back(i);
+    }
+  }
+
+  compute_nodes(*this,
+                species,
+                atmref,
+                absorption_bands,
+                ecs_data,
+                all_indices(p_size()),
+                f_index);
+
+  band_ranges = std::move(new_ranges);
+  return static_cast<Index>(f_index.size());
+}
+ARTS_METHOD_ERROR_CATCH
+
+Index table::extend_frequency(const SpeciesEnum& species,
+                              const ArrayOfAtmPoint& atmref,
+                              std::shared_ptr<const AscendingGrid> new_f_grid,
+                              const AbsorptionBands& absorption_bands,
+                              const LinemixingEcsData& ecs_data) try {
+  check();
+  check_atmref(*this, atmref);
+  ARTS_USER_ERROR_IF(not new_f_grid, "No new frequency grid")
+
+  const std::vector<Index> old_f =
+      old_positions(*f_grid, *new_f_grid, "frequency");
+
+  // Computed into a new table so that an error leaves this one as it was
+  table next;
+  next.f_grid       = std::move(new_f_grid);
+  next.log_p_grid   = log_p_grid;
+  next.t_pert       = t_pert;
+  next.w_pert       = w_pert;
+  next.water_atmref = water_atmref;
+  next.t_atmref     = t_atmref;
+  next.band_ranges  = band_ranges;
+  next.xsec.resize(next.grid_shape());
+
+  std::vector<Index> f_index;
+  for (Size i = 0; i < old_f.size(); ++i) {
+    if (old_f[i] < 0) {
+      f_index.push_back(i);
+    } else {
+      next.xsec(joker, joker, joker, i) = xsec(joker, joker, joker, old_f[i]);
+    }
+  }
+
+  compute_nodes(next,
+                species,
+                atmref,
+                absorption_bands,
+                ecs_data,
+                all_indices(p_size()),
+                f_index);
+
+  *this = std::move(next);
+  return static_cast<Index>(f_index.size());
+}
+ARTS_METHOD_ERROR_CATCH
+
+Index table::extend_pressure(const SpeciesEnum& species,
+                             const ArrayOfAtmPoint& atmref,
+                             const AbsorptionBands& absorption_bands,
+                             const LinemixingEcsData& ecs_data) try {
+  check();
+
+  auto new_log_p_grid = std::make_shared<const DescendingGrid>(
+      atmref.begin(), atmref.end(), [](const AtmPoint& x) {
+        return std::log(x.pressure);
+      });
+
+  const std::vector<Index> old_p =
+      old_positions(*log_p_grid, *new_log_p_grid, "log-pressure");
+
+  const bool do_water = do_w();
+  for (Size i = 0; i < old_p.size(); ++i) {
+    if (old_p[i] < 0) continue;
+
+    ARTS_USER_ERROR_IF(
+        atmref[i].temperature != t_atmref[old_p[i]],
+        "The temperature at {} Pa differs from the table: {} K vs {} K",
+        atmref[i].pressure,
+        atmref[i].temperature,
+        t_atmref[old_p[i]])
+
+    ARTS_USER_ERROR_IF(
+        do_water and atmref[i]["H2O"_spec] != water_atmref[old_p[i]],
+        "The water VMR at {} Pa differs from the table: {} vs {}",
+        atmref[i].pressure,
+        atmref[i]["H2O"_spec],
+        water_atmref[old_p[i]])
+  }
+
+  // Computed into a new table so that an error leaves this one as it was
+  table next;
+  next.f_grid     = f_grid;
+  next.log_p_grid = std::move(new_log_p_grid);
+  next.t_pert     = t_pert;
+  next.w_pert     = w_pert;
+  next.water_atmref.resize(atmref.size());
+  next.t_atmref.resize(atmref.size());
+  next.xsec.resize(next.grid_shape());
+
+  std::vector<Index> p_index;
+  for (Size i = 0; i < old_p.size(); ++i) {
+    next.water_atmref[i] = do_water ? atmref[i]["H2O"_spec] : NAN;
+    next.t_atmref[i]     = atmref[i].temperature;
+
+    if (old_p[i] < 0) {
+      p_index.push_back(i);
+    } else {
+      next.xsec(joker, joker, i, joker) = xsec(joker, joker, old_p[i], joker);
+    }
+  }
+
+  compute_nodes(next,
+                species,
+                atmref,
+                absorption_bands,
+                ecs_data,
+                p_index,
+                all_indices(f_size()));
+
+  // The new levels may shift the lines further than the old ones did
+  next.band_ranges = species_band_ranges(
+      species, perturbed_atmospheres(atmref, t_pert, w_pert), absorption_bands);
+  for (const auto& [key, range] : band_ranges) {
+    if (auto ptr = next.band_ranges.find(key); ptr != next.band_ranges.end()) {
+      ptr->second = {std::min(range[0], ptr->second[0]),
+                     std::max(range[1], ptr->second[1])};
+    } else {
+      next.band_ranges[key] = range;
+    }
+  }
+
+  *this = std::move(next);
+
+  return static_cast<Index>(p_index.size());
 }
 ARTS_METHOD_ERROR_CATCH
 
@@ -232,6 +646,143 @@ void table::absorption(ExhaustiveVectorView absorption,
 }
 ARTS_METHOD_ERROR_CATCH
 
+namespace {
+using DerivativeLagrange = my_interp::Lagrange<-1, true>;
+}  // namespace
+
+absorption_derivatives::absorption_derivatives(Index nf)
+    : t(nf, 0.0), p(nf, 0.0), f(nf, 0.0), vmr(nf, 0.0), h2o(nf, 0.0) {}
+
+void absorption_derivatives::zero() {
+  t   = 0.0;
+  p   = 0.0;
+  f   = 0.0;
+  vmr = 0.0;
+  h2o = 0.0;
+}
+
+void table::absorption(ExhaustiveVectorView absorption,
+                       absorption_derivatives& derivatives,
+                       const SpeciesEnum& species,
+                       const Index& p_interp_order,
+                       const Index& t_interp_order,
+                       const Index& water_interp_order,
+                       const Index& f_interp_order,
+                       const AtmPoint& atm_point,
+                       const AscendingGrid& frequency_grid,
+                       const Numeric& extpolfac) const try {
+  check();
+
+  const Index nf = frequency_grid.size();
+  ARTS_USER_ERROR_IF(
+      derivatives.t.size() != nf or derivatives.p.size() != nf or
+          derivatives.f.size() != nf or derivatives.vmr.size() != nf or
+          derivatives.h2o.size() != nf,
+      "The derivatives must be of the size of the frequency grid: {}",
+      nf)
+
+  if (xsec.empty()) return;
+
+  const Numeric pressure    = atm_point.pressure;
+  const Numeric temperature = atm_point.temperature;
+
+  // Frequency grid positions
+  const Vector& f_grid_v(*f_grid);
+  const auto flag =
+      my_interp::lagrange_interpolation_list<DerivativeLagrange>(
+          frequency_grid, f_grid_v, f_interp_order, extpolfac, "Frequency");
+
+  // Pressure grid positions, the derivatives are with regards to log(P)
+  const Numeric plog_local = std::log(pressure);
+  const Vector& plog_v(*log_p_grid);
+  DerivativeLagrange::check(
+      plog_v, p_interp_order, plog_local, extpolfac, "Log-Pressure");
+  const DerivativeLagrange plag(0, plog_local, plog_v, p_interp_order);
+
+  // The reference profiles at the pressure, and their log(P) derivatives
+  Numeric t_ref = 0.0, dt_ref = 0.0, w_ref = 0.0, dw_ref = 0.0;
+  for (Index i = 0; i < plag.size(); i++) {
+    t_ref  += plag.lx[i] * t_atmref[plag.pos + i];
+    dt_ref += plag.dlx[i] * t_atmref[plag.pos + i];
+    if (do_w()) {
+      w_ref  += plag.lx[i] * water_atmref[plag.pos + i];
+      dw_ref += plag.dlx[i] * water_atmref[plag.pos + i];
+    }
+  }
+
+  // Optional grid positions, an order 0 interpolation of the single element
+  DerivativeLagrange tlag;
+  if (do_t()) {
+    const Numeric x = temperature - t_ref;
+    const Vector& xi(*t_pert);
+    DerivativeLagrange::check(
+        xi, t_interp_order, x, extpolfac, "Temperature");
+    tlag = DerivativeLagrange(0, x, xi, t_interp_order);
+  }
+
+  DerivativeLagrange wlag;
+  const Numeric water_vmr = do_w() ? atm_point["H2O"_spec] : 0.0;
+  if (do_w()) {
+    const Numeric x = water_vmr / w_ref;
+    const Vector& xi(*w_pert);
+    DerivativeLagrange::check(
+        xi, water_interp_order, x, extpolfac, "Water VMR");
+    wlag = DerivativeLagrange(0, x, xi, water_interp_order);
+  }
+
+  // One pass over the table for the cross-section and its derivatives with
+  // regards to the table coordinates
+  Vector xsec_local(nf, 0.0), dxsec_t(nf, 0.0), dxsec_w(nf, 0.0),
+      dxsec_p(nf, 0.0), dxsec_f(nf, 0.0);
+  for (Index it = 0; it < tlag.size(); it++) {
+    for (Index iw = 0; iw < wlag.size(); iw++) {
+      for (Index ip = 0; ip < plag.size(); ip++) {
+        const auto data =
+            xsec(tlag.pos + it, wlag.pos + iw, plag.pos + ip, joker);
+
+        const Numeric w   = tlag.lx[it] * wlag.lx[iw] * plag.lx[ip];
+        const Numeric w_t = tlag.dlx[it] * wlag.lx[iw] * plag.lx[ip];
+        const Numeric w_w = tlag.lx[it] * wlag.dlx[iw] * plag.lx[ip];
+        const Numeric w_p = tlag.lx[it] * wlag.lx[iw] * plag.dlx[ip];
+
+        for (Index i = 0; i < nf; i++) {
+          Numeric v = 0.0, dv = 0.0;
+          for (Index j = 0; j < flag[i].size(); j++) {
+            v  += flag[i].lx[j] * data[flag[i].pos + j];
+            dv += flag[i].dlx[j] * data[flag[i].pos + j];
+          }
+
+          xsec_local[i] += w * v;
+          dxsec_t[i]    += w_t * v;
+          dxsec_w[i]    += w_w * v;
+          dxsec_p[i]    += w_p * v;
+          dxsec_f[i]    += w * dv;
+        }
+      }
+    }
+  }
+
+  // Chain rule from the table coordinates to the atmospheric state
+  const Numeric nd       = atm_point.number_density(species);
+  const Numeric dnd_dvmr = atm_point.number_density();
+  const Numeric dxt_dp   = -dt_ref / pressure;
+  const Numeric dxw_dh2o = do_w() ? 1.0 / w_ref : 0.0;
+  const Numeric dxw_dp =
+      do_w() ? -water_vmr * dw_ref / (w_ref * w_ref * pressure) : 0.0;
+
+  for (Index i = 0; i < nf; ++i) {
+    absorption[i]      += xsec_local[i] * nd;
+    derivatives.t[i]   += (dxsec_t[i] - xsec_local[i] / temperature) * nd;
+    derivatives.p[i]   += (dxsec_p[i] / pressure + dxsec_t[i] * dxt_dp +
+                           dxsec_w[i] * dxw_dp + xsec_local[i] / pressure) *
+                          nd;
+    derivatives.f[i]   += dxsec_f[i] * nd;
+    derivatives.vmr[i] += xsec_local[i] * dnd_dvmr;
+    derivatives.h2o[i] += dxsec_w[i] * dxw_dh2o * nd;
+  }
+}
+ARTS_METHOD_ERROR_CATCH
+
 void table::check() const {
   ARTS_USER_ERROR_IF(not do_f() or not do_p(),
                      R"(Must have frequency and pressure grids.
@@ -277,6 +828,325 @@ void table::check() const {
                      t_atmref.size());
 }
 
+namespace {
+//! Cross-sections on the candidate grid of adaptive_table, each computed once
+class cross_section_cache {
+  const SpeciesEnum& species;
+  const ArrayOfAtmPoint& atmref;
+  const AscendingGrid& f_grid;
+  const AbsorptionBands& absorption_bands;
+  const LinemixingEcsData& ecs_data;
+  const AscendingGrid& t_pert;
+  const AscendingGrid& w_pert;
+  bool do_water;
+
+  std::map<std::array<Index, 3>, Vector> values;
+
+  //! Every calculation, including those of concurrent misses of the same key
+  Index count{0};
+
+ public:
+  cross_section_cache(const SpeciesEnum& species_,
+                      const ArrayOfAtmPoint& atmref_,
+                      const AscendingGrid& f_grid_,
+                      const AbsorptionBands& absorption_bands_,
+                      const LinemixingEcsData& ecs_data_,
+                      const AscendingGrid& t_pert_,
+                      const AscendingGrid& w_pert_,
+                      bool do_water_)
+      : species(species_),
+        atmref(atmref_),
+        f_grid(f_grid_),
+        absorption_bands(absorption_bands_),
+        ecs_data(ecs_data_),
+        t_pert(t_pert_),
+        w_pert(w_pert_),
+        do_water(do_water_) {}
+
+  //! Thread-safe; map nodes are stable so the reference outlives later inserts
+  const Vector& operator()(Index it, Index iw, Index ip) {
+    const std::array key{it, iw, ip};
+
+    const Vector* found = nullptr;
+#pragma omp critical(lookup_cross_section_cache)
+    {
+      if (auto ptr = values.find(key); ptr != values.end()) {
+        found = &ptr->second;
+      }
+    }
+    if (found) return *found;
+
+    AtmPoint atm_point     = atmref[ip];
+    atm_point.temperature += t_pert[it];
+    if (do_water) atm_point["H2O"_spec] *= w_pert[iw];
+
+    Vector x =
+        cross_section(species, atm_point, f_grid, absorption_bands, ecs_data);
+
+#pragma omp critical(lookup_cross_section_cache)
+    {
+      ++count;
+      found = &values.try_emplace(key, std::move(x)).first->second;
+    }
+    return *found;
+  }
+
+  //! The number of cross-section calculations performed
+  [[nodiscard]] Index calculations() const { return count; }
+};
+
+//! The largest error relative to the largest exact value
+Numeric relative_error(const ConstVectorView& approx,
+                       const ConstVectorView& exact) {
+  Numeric err = 0.0, norm = 0.0;
+  for (Index i = 0; i < exact.size(); i++) {
+    err  = std::max(err, std::abs(approx[i] - exact[i]));
+    norm = std::max(norm, std::abs(exact[i]));
+  }
+  return norm > 0.0 ? err / norm : err;
+}
+
+/** Interpolates the value at candidate m from the values at the nodes
+ *
+ * @param[in] grid The coordinates of all candidates
+ * @param[in] nodes The sorted candidate indices of the nodes
+ * @param[in] order The interpolation order, reduced if there are too few nodes
+ * @param[in] m The candidate index to interpolate to
+ * @param[in] value The value at a candidate index
+ * @return The interpolated value
+ */
+Vector interpolate_nodes(const Vector& grid,
+                         const std::vector<Index>& nodes,
+                         const Index order,
+                         const Index m,
+                         const std::function<const Vector&(Index)>& value) {
+  Vector x(nodes.size());
+  for (Size i = 0; i < nodes.size(); i++) x[i] = grid[nodes[i]];
+
+  const LagrangeInterpolation lag(
+      0, grid[m], x, std::min<Index>(order, x.size() - 1));
+
+  Vector out(value(nodes[lag.pos]).size(), 0.0);
+  for (Index j = 0; j < lag.size(); j++) {
+    const Vector& v = value(nodes[lag.pos + j]);
+    for (Index i = 0; i < out.size(); i++) out[i] += lag.lx[j] * v[i];
+  }
+  return out;
+}
+
+/** Chooses nodes among the candidates of a grid by bisection
+ *
+ * @param[in] grid The coordinates of all candidates
+ * @param[in] order The interpolation order, decides the starting nodes
+ * @param[in] tolerance The largest error allowed
+ * @param[in] error The interpolation error at a candidate from the nodes
+ * @return The sorted candidate indices of the nodes
+ */
+std::vector<Index> refine_nodes(
+    const Vector& grid,
+    const Index order,
+    const Numeric tolerance,
+    const std::function<Numeric(const std::vector<Index>&, Index)>& error) {
+  const Index n     = grid.size();
+  const Index nseed = std::min(n, std::max<Index>(order + 1, 2));
+
+  std::vector<Index> nodes(nseed, 0);
+  for (Index i = 1; i < nseed; i++) nodes[i] = (i * (n - 1)) / (nseed - 1);
+
+  for (;;) {
+    std::vector<Index> middle;
+    for (Size i = 1; i < nodes.size(); i++) {
+      if (nodes[i] - nodes[i - 1] > 1) {
+        middle.push_back((nodes[i] + nodes[i - 1]) / 2);
+      }
+    }
+
+    String err;
+    std::vector<char> fails(middle.size(), 0);
+#pragma omp parallel for if (not arts_omp_in_parallel())
+    for (Size i = 0; i < middle.size(); i++) {
+      try {
+        fails[i] = error(nodes, middle[i]) > tolerance;
+      } catch (std::exception& e) {
+#pragma omp critical
+        err += std::format("ERROR:\n{}\n\n", e.what());
+      }
+    }
+    ARTS_USER_ERROR_IF(not err.empty(), "{}", err)
+
+    const Size nprev = nodes.size();
+    for (Size i = 0; i < middle.size(); i++) {
+      if (fails[i]) nodes.push_back(middle[i]);
+    }
+    if (nodes.size() == nprev) return nodes;
+    std::ranges::sort(nodes);
+  }
+}
+
+//! The index of the candidate closest to x
+Index closest(const Vector& grid, const Numeric x) {
+  Index out = 0;
+  for (Index i = 1; i < grid.size(); i++) {
+    if (std::abs(grid[i] - x) < std::abs(grid[out] - x)) out = i;
+  }
+  return out;
+}
+
+Vector select(const Vector& grid, const std::vector<Index>& nodes) {
+  Vector out(nodes.size());
+  for (Size i = 0; i < nodes.size(); i++) out[i] = grid[nodes[i]];
+  return out;
+}
+}  // namespace
+
+table adaptive_table(adaptive_summary& summary,
+                     const SpeciesEnum& species,
+                     const ArrayOfAtmPoint& atmref,
+                     std::shared_ptr<const AscendingGrid> f_grid,
+                     const AbsorptionBands& absorption_bands,
+                     const LinemixingEcsData& ecs_data,
+                     std::shared_ptr<const AscendingGrid> t_pert,
+                     std::shared_ptr<const AscendingGrid> w_pert,
+                     const Index p_interp_order,
+                     const Index t_interp_order,
+                     const Index water_interp_order,
+                     const Numeric tolerance) try {
+  ARTS_USER_ERROR_IF(not f_grid or f_grid->empty(),
+                     "Frequency grid is not set.")
+  ARTS_USER_ERROR_IF(atmref.empty(), "No reference atmosphere")
+  ARTS_USER_ERROR_IF(
+      tolerance <= 0.0, "Tolerance must be positive: {}", tolerance)
+
+  const bool do_temperature = t_pert and not t_pert->empty();
+  const bool do_water       = w_pert and not w_pert->empty();
+
+  const AscendingGrid empty_water({1.0});
+  const AscendingGrid empty_t_pert({0.0});
+  const AscendingGrid& w_pert_local(do_water ? *w_pert : empty_water);
+  const AscendingGrid& t_pert_local(do_temperature ? *t_pert : empty_t_pert);
+
+  const DescendingGrid log_p(
+      atmref.begin(), atmref.end(), [](const AtmPoint& x) {
+        return std::log(x.pressure);
+      });
+
+  cross_section_cache exact(species,
+                            atmref,
+                            *f_grid,
+                            absorption_bands,
+                            ecs_data,
+                            t_pert_local,
+                            w_pert_local,
+                            do_water);
+
+  const Index it0 = closest(t_pert_local, 0.0);
+  const Index iw0 = closest(w_pert_local, 1.0);
+
+  const std::vector<Index> p_nodes = refine_nodes(
+      log_p, p_interp_order, tolerance, [&](const auto& nodes, Index m) {
+        return relative_error(
+            interpolate_nodes(
+                log_p,
+                nodes,
+                p_interp_order,
+                m,
+                [&](Index ip) -> const Vector& { return exact(it0, iw0, ip); }),
+            exact(it0, iw0, m));
+      });
+
+  const std::vector<Index> t_nodes = refine_nodes(
+      t_pert_local, t_interp_order, tolerance, [&](const auto& nodes, Index m) {
+        Numeric err = 0.0;
+        for (Index ip : p_nodes) {
+          err = std::max(
+              err,
+              relative_error(interpolate_nodes(t_pert_local,
+                                               nodes,
+                                               t_interp_order,
+                                               m,
+                                               [&](Index it) -> const Vector& {
+                                                 return exact(it, iw0, ip);
+                                               }),
+                             exact(m, iw0, ip)));
+        }
+        return err;
+      });
+
+  const std::vector<Index> w_nodes = refine_nodes(
+      w_pert_local,
+      water_interp_order,
+      tolerance,
+      [&](const auto& nodes, Index m) {
+        Numeric err = 0.0;
+        for (Index ip : p_nodes) {
+          err = std::max(
+              err,
+              relative_error(interpolate_nodes(w_pert_local,
+                                               nodes,
+                                               water_interp_order,
+                                               m,
+                                               [&](Index iw) -> const Vector& {
+                                                 return exact(it0, iw, ip);
+                                               }),
+                             exact(it0, m, ip)));
+        }
+        return err;
+      });
+
+  table out;
+  out.f_grid     = std::move(f_grid);
+  out.log_p_grid =
+      std::make_shared<const DescendingGrid>(select(log_p, p_nodes));
+  if (do_temperature) {
+    out.t_pert =
+        std::make_shared<const AscendingGrid>(select(*t_pert, t_nodes));
+  }
+  if (do_water) {
+    out.w_pert =
+        std::make_shared<const AscendingGrid>(select(*w_pert, w_nodes));
+  }
+
+  out.water_atmref.resize(p_nodes.size());
+  out.t_atmref.resize(p_nodes.size());
+  for (Size i = 0; i < p_nodes.size(); i++) {
+    const AtmPoint& atm_point = atmref[p_nodes[i]];
+    out.water_atmref[i]       = do_water ? atm_point["H2O"_spec] : NAN;
+    out.t_atmref[i]           = atm_point.temperature;
+  }
+
+  out.xsec.resize(out.grid_shape());
+  out.band_ranges = species_band_ranges(
+      species, perturbed_atmospheres(atmref, t_pert, w_pert), absorption_bands);
+
+  String error;
+#pragma omp parallel for collapse(3) if (not arts_omp_in_parallel())
+  for (Size it = 0; it < t_nodes.size(); ++it) {
+    for (Size iw = 0; iw < w_nodes.size(); ++iw) {
+      for (Size ip = 0; ip < p_nodes.size(); ++ip) {
+        try {
+          out.xsec(it, iw, ip, joker) =
+              exact(t_nodes[it], w_nodes[iw], p_nodes[ip]);
+        } catch (std::runtime_error& e) {
+#pragma omp critical
+          error += std::format("ERROR:\n{}\n\n", e.what());
+        }
+      }
+    }
+  }
+  ARTS_USER_ERROR_IF(not error.empty(), "{}", error)
+
+  summary.nodes = {static_cast<Index>(t_nodes.size()),
+                   static_cast<Index>(w_nodes.size()),
+                   static_cast<Index>(p_nodes.size())};
+  summary.candidates   = {static_cast<Index>(t_pert_local.size()),
+                          static_cast<Index>(w_pert_local.size()),
+                          static_cast<Index>(log_p.size())};
+  summary.calculations = exact.calculations();
+
+  return out;
+}
+ARTS_METHOD_ERROR_CATCH
+
 void extend_atmosphere(ArrayOfAtmPoint& atm,
                        const InterpolationExtrapolation extrapolation_type,
                        const Numeric new_max_pressure,
@@ -10,6 +10,33 @@
 #include "interp.h"
 
 namespace lookup {
+/** The partial derivatives of absorption from a lookup table
+ *
+ * All vectors are of the size of the frequency grid of the calculations.
+ */
+struct absorption_derivatives {
+  //! With regards to temperature [1 / (m K)]
+  Vector t;
+
+  //! With regards to pressure [1 / (m Pa)]
+  Vector p;
+
+  //! With regards to frequency [1 / (m Hz)]
+  Vector f;
+
+  //! With regards to the VMR of the species of the table [1 / m]
+  Vector vmr;
+
+  //! With regards to the VMR of water [1 / m]
+  Vector h2o;
+
+  absorption_derivatives() = default;
+  explicit absorption_derivatives(Index nf);
+
+  //! Set all derivatives to zero
+  void zero();
+};
+
 struct table {
   //! The frequency grid in Hz
   std::shared_ptr<const AscendingGrid> f_grid{
@@ -34,6 +61,9 @@ struct table {
   */
   Tensor4 xsec;
 
+  //! The bands that contributed to xsec, with the frequency range they affect in Hz, including line center shifts
+  std::unordered_map<QuantumIdentifier, Vector2> band_ranges;
+
   table()                        = default;
   table(const table&)            = default;
   table(table&&)                 = default;
@@ -58,6 +88,77 @@ struct table {
                   const AscendingGrid& frequency_grid,
                   const Numeric& extpolfac) const;
 
+  /** As absorption, but also adds the analytical derivatives
+   *
+   * The derivatives come from the derivatives of the Lagrange weights, so
+   * the value and all derivatives are computed in a single pass over the
+   * table.  The pressure derivative includes the pressure dependency of the
+   * reference temperature and water VMR profiles of the table.
+   */
+  void absorption(ExhaustiveVectorView absorption,
+                  absorption_derivatives& derivatives,
+                  const SpeciesEnum& species,
+                  const Index& p_interp_order,
+                  const Index& t_interp_order,
+                  const Index& water_interp_order,
+                  const Index& f_interp_order,
+                  const AtmPoint& atm_point,
+                  const AscendingGrid& frequency_grid,
+                  const Numeric& extpolfac) const;
+
+  /** Recomputes the frequencies affected by changed bands
+   *
+   * Bands in band_ranges that are no longer in absorption_bands are
+   * removed, bands in absorption_bands that are not in band_ranges are added,
+   * and bands listed in changed_bands are taken as modified.  Only the
+   * frequencies of f_grid inside the old and new ranges of these bands are
+   * recomputed, using all of absorption_bands.
+   *
+   * @param[in] species The species of the table
+   * @param[in] atmref The reference atmosphere the table was created from
+   * @param[in] absorption_bands The new absorption bands
+   * @param[in] ecs_data The line mixing data
+   * @param[in] changed_bands Bands that are modified in place
+   * @return The number of recomputed frequencies
+   */
+  Index update_bands(const SpeciesEnum& species,
+                     const ArrayOfAtmPoint& atmref,
+                     const AbsorptionBands& absorption_bands,
+                     const LinemixingEcsData& ecs_data,
+                     const ArrayOfQuantumIdentifier& changed_bands = {});
+
+  /** Extends the frequency grid, computing only the new frequencies
+   *
+   * The table is unchanged if the computations fail.
+   *
+   * @param[in] species The species of the table
+   * @param[in] atmref The reference atmosphere the table was created from
+   * @param[in] new_f_grid The new frequency grid, containing the old one
+   * @param[in] absorption_bands The absorption bands
+   * @param[in] ecs_data The line mixing data
+   * @return The number of new frequencies
+   */
+  Index extend_frequency(const SpeciesEnum& species,
+                         const ArrayOfAtmPoint& atmref,
+                         std::shared_ptr<const AscendingGrid> new_f_grid,
+                         const AbsorptionBands& absorption_bands,
+                         const LinemixingEcsData& ecs_data);
+
+  /** Extends the pressure grid, computing only the new pressure levels
+   *
+   * The table is unchanged if the computations fail.
+   *
+   * @param[in] species The species of the table
+   * @param[in] atmref The new reference atmosphere, containing the old levels
+   * @param[in] absorption_bands The absorption bands
+   * @param[in] ecs_data The line mixing data
+   * @return The number of new pressure levels
+   */
+  Index extend_pressure(const SpeciesEnum& species,
+                        const ArrayOfAtmPoint& atmref,
+                        const AbsorptionBands& absorption_bands,
+                        const LinemixingEcsData& ecs_data);
+
   [[nodiscard]] bool do_t() const;
   [[nodiscard]] bool do_w() const;
   [[nodiscard]] bool do_p() const;
@@ -94,6 +195,60 @@ struct table {
       const Numeric& extpolation_factor) const;
 };
 
+//! The nodes chosen by adaptive_table, all as [temperature, water, pressure]
+struct adaptive_summary {
+  //! The number of nodes in the table
+  std::array<Index, 3> nodes{};
+
+  //! The number of candidate nodes
+  std::array<Index, 3> candidates{};
+
+  //! The number of cross-section calculations performed
+  Index calculations{};
+};
+
+/** Create a lookup table on nodes chosen adaptively from candidate grids
+ *
+ * The nodes are chosen among the pressure levels of atmref and among the
+ * candidate temperature and water perturbations.  The selection starts with
+ * evenly spread nodes, as many as the interpolation order requires.  Between
+ * each pair of neighbouring nodes, the cross-section at the middle candidate
+ * is calculated and compared with its interpolation from the nodes.  Middle
+ * candidates with a larger relative error than the tolerance become nodes,
+ * until no middle candidate fails.
+ *
+ * Pressure is refined for the unperturbed reference atmosphere, temperature
+ * for all chosen pressure levels, and water for all chosen pressure levels
+ * without temperature perturbation.  All cross-sections are cached so that
+ * none is calculated twice.
+ *
+ * @param[out] summary The nodes used versus the number of candidates
+ * @param[in] species The species of the table
+ * @param[in] atmref The candidate pressure levels, in descending pressure
+ * @param[in] f_grid The frequency grid
+ * @param[in] absorption_bands The absorption bands
+ * @param[in] ecs_data The line mixing data
+ * @param[in] t_pert The candidate temperature perturbations, or nullptr
+ * @param[in] w_pert The candidate water perturbations, or nullptr
+ * @param[in] p_interp_order The pressure interpolation order of the table
+ * @param[in] t_interp_order The temperature interpolation order of the table
+ * @param[in] water_interp_order The water interpolation order of the table
+ * @param[in] tolerance The largest relative interpolation error allowed
+ * @return A lookup table
+ */
+table adaptive_table(adaptive_summary& summary,
+                     const SpeciesEnum& species,
+                     const ArrayOfAtmPoint& atmref,
+                     std::shared_ptr<const AscendingGrid> f_grid,
+                     const AbsorptionBands& absorption_bands,
+                     const LinemixingEcsData& ecs_data,
+                     std::shared_ptr<const AscendingGrid> t_pert,
+                     std::shared_ptr<const AscendingGrid> w_pert,
+                     const Index p_interp_order,
+                     const Index t_interp_order,
+                     const Index water_interp_order,
+                     const Numeric tolerance);
+
 /** Wraps calling Atm::extend_in_pressure but for an atmosphere fitting a lookup table.
  * 
  * Additional checks are performed to ensure that the input fits the ideas of the lookup table.
@@ -2,7 +2,9 @@
 
 #include <fast_float/fast_float.h>
 
+#include <algorithm>
 #include <istream>
+#include <string>
 #include <system_error>
 
 #include "debug.h"
@@ -51,4 +53,85 @@ std::istream& double_imanip::operator>>(const double_imanip&) const {
 const double_imanip& operator>>(std::istream& in, const double_imanip& dm) {
   dm.in = &in;
   return dm;
-}
\ No newline at end of file
+}
+
+namespace {
+//! The size of the blocks read from the stream
+constexpr std::size_t parse_block_size = std::size_t{1} << 16;
+
+constexpr bool is_space(char c) {
+  return c == ' ' or c == '\n' or c == '\t' or c == '\r' or c == '\v' or
+         c == '\f';
+}
+
+std::size_t parse_doubles_per_value(std::istream& is, std::span<double> data) {
+  std::size_t n = 0;
+  for (auto& x : data) {
+    is >> double_imanip() >> x;
+    if (is.fail()) break;
+    n++;
+  }
+  return n;
+}
+}  // namespace
+
+std::size_t parse_doubles(std::istream& is, std::span<double> data) {
+  if (data.empty()) return 0;
+
+#ifdef _WIN32
+  // Relative seeking is not reliable for text-mode files on Windows
+  return parse_doubles_per_value(is, data);
+#else
+  if (is.fail() or is.tellg() == -1) return parse_doubles_per_value(is, data);
+
+  std::string buf(parse_block_size, '\0');
+
+  // The characters in buf[first, last) are read but not yet consumed
+  std::size_t first = 0;
+  std::size_t last  = 0;
+  bool eof          = false;
+
+  const auto refill = [&]() {
+    std::copy(buf.begin() + first, buf.begin() + last, buf.begin());
+    last  -= first;
+    first  = 0;
+
+    // A single token may not fit in the buffer
+    if (last == buf.size()) buf.resize(2 * buf.size());
+
+    is.read(buf.data() + last, static_cast<std::streamsize>(buf.size() - last));
+    last += static_cast<std::size_t>(is.gcount());
+    eof   = is.eof();
+  };
+
+  std::size_t n = 0;
+  while (n < data.size()) {
+    while (first < last and is_space(buf[first])) first++;
+
+    std::size_t stop = first;
+    while (stop < last and not is_space(buf[stop]) and buf[stop] != '<') stop++;
+
+    // The token may continue in the next block
+    if (stop == last and not eof) {
+      refill();
+      continue;
+    }
+
+    if (first == stop) break;
+
+    const auto res = fast_float::from_chars(
+        buf.data() + first, buf.data() + stop, data[n]);
+    if (res.ec == std::errc::invalid_argument) break;
+
+    first = static_cast<std::size_t>(res.ptr - buf.data());
+    n++;
+  }
+
+  // Return what was read but not consumed to the stream
+  is.clear();
+  is.seekg(-static_cast<std::streamoff>(last - first), std::ios_base::cur);
+
+  if (n < data.size()) is.setstate(std::ios_base::failbit);
+  return n;
+#endif
+}
@@ -14,7 +14,10 @@
 #define double_imanip_h
 
 /** Input manipulator class for doubles to enable nan and inf parsing. */
+#include <cstddef>
 #include <iosfwd>
+#include <span>
+
 class double_imanip {
  public:
   const double_imanip& operator>>(double& x) const;
@@ -28,4 +31,20 @@ class double_imanip {
   mutable std::istream* in;
 };
 
+/** Reads whitespace-separated doubles from the stream in bulk
+
+   The stream is read in large blocks and the numbers are converted directly
+   from the block, without going through a string per value.  Characters
+   following the last number are put back into the stream.  Streams that
+   cannot be repositioned are read one value at a time.
+
+   Parsing stops at the first value that cannot be converted, and the
+   failbit of the stream is then set.
+
+   @param[in] in The input stream
+   @param[out] data The values to read
+   @return The number of values that were read
+*/
+std::size_t parse_doubles(std::istream& in, std::span<double> data);
+
 #endif
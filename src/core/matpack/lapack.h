@@ -101,6 +101,16 @@ extern "C" void dgetrs_(char *trans,
                         int *ldb,
                         int *info);
 
+extern "C" void zgetrs_(char *trans,
+                        int *n,
+                        int *nrhs,
+                        std::complex<double> *A,
+                        int *lda,
+                        int *ipiv,
+                        std::complex<double> *b,
+                        int *ldb,
+                        int *info);
+
 //
 //! Matrix inversion.
 /*!
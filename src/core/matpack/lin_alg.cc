@@ -698,3 +698,33 @@ void solve_inplace(ExhaustiveVectorView X, ExhaustiveMatrixView A) {
   solve_workdata wo(A.ncols());
   solve_inplace(X, A, wo);
 }
+
+void solve_inplace(ExhaustiveComplexVectorView X,
+                   ExhaustiveComplexMatrixView A) {
+  const Index n = A.nrows();
+  ARTS_ASSERT(is_size(A, n, n));
+  ARTS_ASSERT(X.size() == n);
+
+  // The row-major A is the transpose of what Lapack sees
+  char trans = 'T';
+  int n_int  = static_cast<int>(n);
+  int info{};
+  int one = 1;
+  std::vector<int> ipiv(n);
+
+  lapack::zgetrf_(
+      &n_int, &n_int, A.data_handle(), &n_int, ipiv.data(), &info);
+  ARTS_USER_ERROR_IF(info not_eq 0,
+                     "Error solving system: Matrix not of full rank.");
+
+  lapack::zgetrs_(&trans,
+                  &n_int,
+                  &one,
+                  A.data_handle(),
+                  &n_int,
+                  ipiv.data(),
+                  X.data_handle(),
+                  &n_int,
+                  &info);
+  ARTS_USER_ERROR_IF(info not_eq 0, "Error solving system.");
+}
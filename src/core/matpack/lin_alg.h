@@ -57,6 +57,14 @@ void solve_inplace(ExhaustiveVectorView X,
 //! As above but allocates WO
 void solve_inplace(ExhaustiveVectorView X, ExhaustiveMatrixView A);
 
+/*! Solves A X = B inplace using zgetrf and zgetrs.
+  *
+  * @param[in,out] X   As equation, on input it is B on output is is X
+  * @param[in]     A   As equation, it is destroyed on output (LU decomposition)
+  * @throws If the system cannot be solved according to Lapack info
+  */
+void solve_inplace(ExhaustiveComplexVectorView X, ExhaustiveComplexMatrixView A);
+
 struct inv_workdata {
   std::size_t N{};
   std::vector<int> ipiv{};
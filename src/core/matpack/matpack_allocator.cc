@@ -0,0 +1,105 @@
+#include "matpack_allocator.h"
+
+#include <algorithm>
+
+namespace matpack {
+namespace {
+std::size_t align_up(std::size_t n, std::size_t align) {
+  return (n + align - 1) / align * align;
+}
+
+constexpr std::align_val_t block_alignment{matpack_alignment};
+}  // namespace
+
+arena::~arena() {
+  for (auto& b : blocks) {
+    ::operator delete(b.data, b.size, block_alignment);
+  }
+}
+
+void* arena::allocate(std::size_t bytes, std::size_t align) {
+  if (bytes == 0) bytes = 1;
+
+  if (not blocks.empty()) {
+    block& b              = blocks[active];
+    const std::size_t pos = align_up(b.used, align);
+    if (pos + bytes <= b.size) {
+      b.used = pos + bytes;
+      return b.data + pos;
+    }
+  }
+
+  //! All blocks after the active one are unused, so any of them that fits
+  //! can be moved up to be next and no block is ever skipped
+  const std::size_t next = blocks.empty() ? 0 : active + 1;
+  auto fits = std::ranges::find_if(
+      blocks.begin() + next, blocks.end(), [bytes](const block& b) {
+        return bytes <= b.size;
+      });
+
+  if (fits == blocks.end()) {
+    std::size_t largest = 0;
+    for (auto& b : blocks) largest = std::max(largest, b.size);
+
+    const std::size_t size =
+        std::max({bytes + align, min_block_size, 2 * largest});
+    auto* data = static_cast<std::byte*>(::operator new(size, block_alignment));
+    system_allocations++;
+
+    fits = blocks.insert(blocks.begin() + next, block{data, size, 0, 0});
+  } else {
+    std::rotate(blocks.begin() + next, fits, fits + 1);
+    fits = blocks.begin() + next;
+  }
+
+  //! The blocks are aligned, so a fresh block needs no padding
+  if (next > 0) blocks[active].tail = blocks[active].size - blocks[active].used;
+  active     = next;
+  fits->used = bytes;
+  return fits->data;
+}
+
+void arena::deallocate(void* p, std::size_t bytes) noexcept {
+  if (blocks.empty()) return;
+
+  block& b = blocks[active];
+  auto* d  = static_cast<std::byte*>(p);
+  if (d >= b.data and d + bytes == b.data + b.used) {
+    b.used = static_cast<std::size_t>(d - b.data);
+  }
+}
+
+arena::marker arena::mark() const noexcept {
+  if (blocks.empty()) return {0, 0};
+  return {active, blocks[active].used};
+}
+
+void arena::release(marker m) noexcept {
+  if (blocks.empty()) return;
+
+  for (std::size_t i = m.block + 1; i < blocks.size(); i++) {
+    blocks[i].used = 0;
+    blocks[i].tail = 0;
+  }
+  active              = m.block;
+  blocks[active].used = m.used;
+  blocks[active].tail = 0;
+}
+
+std::size_t arena::capacity() const noexcept {
+  std::size_t n = 0;
+  for (auto& b : blocks) n += b.size;
+  return n;
+}
+
+std::size_t arena::skipped() const noexcept {
+  std::size_t n = 0;
+  for (auto& b : blocks) n += b.tail;
+  return n;
+}
+
+arena& arena::local() {
+  thread_local arena a;
+  return a;
+}
+}  // namespace matpack
@@ -0,0 +1,196 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace matpack {
+//! The alignment of all storage from the matpack allocators, a cache line
+inline constexpr std::size_t matpack_alignment = 64;
+
+/** An aligned allocator that leaves trivial types uninitialized
+ *
+ * Default construction of elements, as happens on resize, is done by
+ * default-initialization instead of value-initialization.  For arithmetic
+ * and complex types this means that the memory is left as it was given by
+ * the system.  Use this for work arrays that are written before being read.
+ */
+template <typename T>
+struct uninitialized_allocator {
+  using value_type = T;
+
+  static constexpr std::align_val_t alignment{
+      std::max(matpack_alignment, alignof(T))};
+
+  constexpr uninitialized_allocator() noexcept = default;
+
+  template <typename U>
+  constexpr uninitialized_allocator(
+      const uninitialized_allocator<U>&) noexcept {}
+
+  [[nodiscard]] T* allocate(std::size_t n) {
+    return static_cast<T*>(::operator new(n * sizeof(T), alignment));
+  }
+
+  void deallocate(T* p, std::size_t n) noexcept {
+    ::operator delete(p, n * sizeof(T), alignment);
+  }
+
+  template <typename U>
+  void construct(U* p) noexcept(std::is_nothrow_default_constructible_v<U>) {
+    ::new (static_cast<void*>(p)) U;
+  }
+
+  template <typename U, typename... Args>
+  void construct(U* p, Args&&... args) {
+    ::new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+  }
+
+  template <typename U>
+  constexpr bool operator==(const uninitialized_allocator<U>&) const noexcept {
+    return true;
+  }
+};
+
+/** A thread-local bump-allocation arena for scoped temporaries
+ *
+ * Memory is handed out from large blocks that are kept between uses.  Memory
+ * is only reclaimed when the last allocation is freed (stack-like use), or
+ * when an arena_scope ends.  Nothing allocated from the arena may outlive the
+ * arena_scope it was allocated in.
+ *
+ * An allocation that does not fit the rest of the active block moves on to
+ * the first unused block that fits, or to a new block.  The rest of the
+ * previous block stays unused until the scope ends and is counted by
+ * skipped().  Only the owning thread may use the arena.
+ */
+class arena {
+  struct block {
+    std::byte* data;
+    std::size_t size;
+    std::size_t used;
+    std::size_t tail;  //! Left unused when a later block became active
+  };
+
+  std::vector<block> blocks{};
+  std::size_t active{0};
+  std::size_t system_allocations{0};
+
+ public:
+  //! A position in the arena to return to
+  struct marker {
+    std::size_t block;
+    std::size_t used;
+  };
+
+  //! The smallest block the arena will request from the system
+  static constexpr std::size_t min_block_size = std::size_t{1} << 20;
+
+  arena() = default;
+  arena(const arena&)            = delete;
+  arena(arena&&)                 = delete;
+  arena& operator=(const arena&) = delete;
+  arena& operator=(arena&&)      = delete;
+  ~arena();
+
+  //! Get aligned memory of at least bytes size
+  [[nodiscard]] void* allocate(std::size_t bytes, std::size_t align);
+
+  //! Reclaims the memory if it is the last allocation, otherwise does nothing
+  void deallocate(void* p, std::size_t bytes) noexcept;
+
+  //! The current position of the arena
+  [[nodiscard]] marker mark() const noexcept;
+
+  //! Return to a previous position, all later allocations are invalidated
+  void release(marker m) noexcept;
+
+  //! The number of blocks requested from the system over the arena lifetime
+  [[nodiscard]] std::size_t system_allocation_count() const noexcept {
+    return system_allocations;
+  }
+
+  //! The total memory held by the arena
+  [[nodiscard]] std::size_t capacity() const noexcept;
+
+  //! The memory left unused at the end of blocks before the active one
+  [[nodiscard]] std::size_t skipped() const noexcept;
+
+  //! The arena of the calling thread
+  [[nodiscard]] static arena& local();
+};
+
+/** Marks a scope of the thread-local arena
+ *
+ * All arena allocations made by this thread during the lifetime of this
+ * object are released when it is destroyed.
+ */
+class arena_scope {
+  arena* a;
+  arena::marker m;
+
+ public:
+  arena_scope() : a(&arena::local()), m(a->mark()) {}
+  arena_scope(const arena_scope&)            = delete;
+  arena_scope(arena_scope&&)                 = delete;
+  arena_scope& operator=(const arena_scope&) = delete;
+  arena_scope& operator=(arena_scope&&)      = delete;
+  ~arena_scope() { a->release(m); }
+};
+
+/** An allocator using the thread-local arena
+ *
+ * Like uninitialized_allocator, elements are default-initialized.  The
+ * allocator remembers the arena of the thread that created it, so storage
+ * may be read by other threads but must be freed before the enclosing
+ * arena_scope of the creating thread ends.  Only the creating thread may
+ * allocate.  Storage freed by another thread is left to that arena_scope, as
+ * the arena is not synchronized.
+ */
+template <typename T>
+struct arena_allocator {
+  using value_type = T;
+
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap            = std::true_type;
+
+  static constexpr std::size_t alignment =
+      std::max(matpack_alignment, alignof(T));
+
+  arena* a;
+
+  arena_allocator() noexcept : a(&arena::local()) {}
+
+  template <typename U>
+  constexpr arena_allocator(const arena_allocator<U>& other) noexcept
+      : a(other.a) {}
+
+  [[nodiscard]] T* allocate(std::size_t n) {
+    return static_cast<T*>(a->allocate(n * sizeof(T), alignment));
+  }
+
+  void deallocate(T* p, std::size_t n) noexcept {
+    if (a == &arena::local()) a->deallocate(p, n * sizeof(T));
+  }
+
+  template <typename U>
+  void construct(U* p) noexcept(std::is_nothrow_default_constructible_v<U>) {
+    ::new (static_cast<void*>(p)) U;
+  }
+
+  template <typename U, typename... Args>
+  void construct(U* p, Args&&... args) {
+    ::new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+  }
+
+  template <typename U>
+  constexpr bool operator==(const arena_allocator<U>& other) const noexcept {
+    return a == other.a;
+  }
+};
+}  // namespace matpack
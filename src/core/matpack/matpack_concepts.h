@@ -4,6 +4,7 @@
 
 #include <array>
 #include <complex>
+#include <memory>
 #include <type_traits>
 #include <vector>
 
@@ -31,7 +32,7 @@ template <typename T, Index N, bool constant, bool strided>
 class matpack_view;
 
 //! The basic data type
-template <typename T, Index N>
+template <typename T, Index N, typename Alloc = std::allocator<T>>
 class matpack_data;
 
 //! The constexpr view type
@@ -434,9 +435,9 @@ template <typename U>
 concept any_matpack_view = rankable<U> and ranked_matpack_view<U, matpack_value_type<U>, rank<U>()>;
 
 
-//! Test that the type U is exactly matpack_data<T, N> (w/o qualifiers)
+//! Test that the type U is exactly matpack_data<T, N, Alloc> (w/o qualifiers) for any allocator
 template <typename U, typename T, Index N>
-concept ranked_matpack_data = std::same_as<std::remove_cvref_t<U>, matpack_data<T, N>>;
+concept ranked_matpack_data = std::same_as<std::remove_cvref_t<U>, matpack_data<T, N, typename std::remove_cvref_t<U>::allocator_type>>;
 
 //! Test that the type U is exactly matpack_data<U::value_type, N> (w/o qualifiers)
 template <typename U, Index N>
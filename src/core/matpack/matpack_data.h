@@ -4,6 +4,7 @@
 #include <exception>
 #include <tuple>
 
+#include "matpack_allocator.h"
 #include "matpack_concepts.h"
 #include "matpack_view.h"
 
@@ -44,10 +45,10 @@ auto get_last(rest&&... r)
 }
 
 //! The basic data type
-template <typename T, Index N>
+template <typename T, Index N, typename Alloc>
 class matpack_data {
   //! Allocates all the data
-  std::vector<T> data;
+  std::vector<T, Alloc> data;
 
   //! The basic type of which we view this data
   using view_type = matpack_view<T, N, false, false>;
@@ -72,7 +73,7 @@ class matpack_data {
   using any_view = matpack_view<T, N, c, s>;
 
   //! Allow all other matpack_data to view private information about this type
-  template <typename U, Index M>
+  template <typename U, Index M, typename B>
   friend class matpack_data;
 
   //! Allow all matpack views to view private information about this class
@@ -83,17 +84,27 @@ class matpack_data {
   constexpr operator view_type&() { return view; }
   constexpr operator const view_type&() const { return view; }
 
+  /** @brief Core constructor
+   *
+   * The elements are default constructed by the allocator.  For the default
+   * std::allocator, this means that they are value-initialized to T{}.
+   * 
+   * @param[in] sz The size object determining the extent of each dimension
+   */
+  constexpr matpack_data(const std::array<Index, N>& sz = {})
+      : data(mdsize<N>(sz)), view(data.data(), sz) {}
+
   /** @brief Core constructor
    * 
    * @param[in] sz The size object determining the extent of each dimension
    * @param[in] x The default value of all input
    */
-  constexpr matpack_data(const std::array<Index, N>& sz = {}, const T& x = {})
+  constexpr matpack_data(const std::array<Index, N>& sz, const T& x)
       : data(mdsize<N>(sz), x), view(data.data(), sz) {}
 
   /** Variadic input of the size of this object
    *
-   * The object is default initialized to T{}
+   * The object is default constructed by the allocator, see core constructor
    * 
    * @param[in] sz Sizes to determine the extent of each dimension
    */
@@ -165,7 +176,7 @@ class matpack_data {
    * @param[in] x An old matpack view object that is smaller
    */
   template <Index M>
-  explicit constexpr matpack_data(const matpack::matpack_data<T, M>& x)
+  explicit constexpr matpack_data(const matpack::matpack_data<T, M, Alloc>& x)
     requires(M < N)
       : matpack_data(upview<N, M>(x.shape())) {
     view = view_type{x};
@@ -266,7 +277,7 @@ class matpack_data {
     }
   }
 
-  //! Resize this object and default constructs the new one IF the new size is different
+  //! Resize this object and default constructs the new one IF the new size is different (by the allocator)
   template <integral... inds, Index M = sizeof...(inds)>
   constexpr void resize(inds&&... sz)
     requires(M == N)
@@ -314,13 +325,13 @@ class matpack_data {
 
   //! Reshape this object to another size of matpack data.  The new object must have the same size as the old one had
   template <Index M>
-  constexpr matpack_data<T, M> reshape(const std::array<Index, M>& sz) && {
-    using other_view_type = typename matpack_data<T, M>::view_type;
+  constexpr matpack_data<T, M, Alloc> reshape(const std::array<Index, M>& sz) && {
+    using other_view_type = typename matpack_data<T, M, Alloc>::view_type;
 
     if (size() != mdsize<M>(sz)) std::terminate();
     ARTS_ASSERT(size() == mdsize<M>(sz), "{} vs {}", size(), mdsize<M>(sz))
 
-    matpack_data<T, M> out;
+    matpack_data<T, M, Alloc> out;
     out.data = std::move(data);
     out.view.secret_set(other_view_type{out.data.data(), sz});
 
@@ -376,7 +387,7 @@ class matpack_data {
   }
 
   //! Return this object as a 1-dimensional object
-  constexpr matpack_data<T, 1> flatten() && {
+  constexpr matpack_data<T, 1, Alloc> flatten() && {
     return std::move(*this).reshape(size());
   }
 
@@ -445,6 +456,9 @@ class matpack_data {
   //! The value type of this matpack data is public information
   using value_type = T;
 
+  //! The allocator type of this matpack data is public information
+  using allocator_type = Alloc;
+
   //! Return the rank of this object
   [[nodiscard]] static constexpr auto rank() { return N; }
 
@@ -679,19 +693,23 @@ class matpack_data {
     view /= x;
     return *this;
   }
-  constexpr matpack_data& operator+=(const matpack_data& x) {
+  template <typename B>
+  constexpr matpack_data& operator+=(const matpack_data<T, N, B>& x) {
     view += x.view;
     return *this;
   }
-  constexpr matpack_data& operator-=(const matpack_data& x) {
+  template <typename B>
+  constexpr matpack_data& operator-=(const matpack_data<T, N, B>& x) {
     view -= x.view;
     return *this;
   }
-  constexpr matpack_data& operator*=(const matpack_data& x) {
+  template <typename B>
+  constexpr matpack_data& operator*=(const matpack_data<T, N, B>& x) {
     view *= x.view;
     return *this;
   }
-  constexpr matpack_data& operator/=(const matpack_data& x) {
+  template <typename B>
+  constexpr matpack_data& operator/=(const matpack_data<T, N, B>& x) {
     view /= x.view;
     return *this;
   }
@@ -765,7 +783,7 @@ class matpack_data {
   }
 
   //! Allow a specialization to construct this object from a standard vector
-  constexpr matpack_data(std::vector<T>&& a)
+  constexpr matpack_data(std::vector<T, Alloc>&& a)
     requires(N == 1)
       : data(std::move(a)),
         view(data.data(),
@@ -774,7 +792,7 @@ class matpack_data {
   //! Allow a specialization to construct this object from a standard initializer list
   constexpr matpack_data(std::initializer_list<T> a)
     requires(N == 1)
-      : matpack_data(std::vector<T>{a}) {}
+      : matpack_data(std::vector<T, Alloc>(a)) {}
 
   //! Return that this object is always exhaustive
   static constexpr bool is_always_exhaustive() noexcept { return true; }
@@ -785,12 +803,20 @@ class matpack_data {
  * @param m Any matpack_data type
  * @return std::string of the description
  */
-template <typename T, Index N>
-std::string describe(const matpack_data<T, N>& m) {
+template <typename T, Index N, typename Alloc>
+std::string describe(const matpack_data<T, N, Alloc>& m) {
   using namespace matpack;
   return var_string(
       "matpack_data of rank ", N, " of shape ", m.shape());
 }
+
+//! Matpack data with aligned storage that is not initialized on construction or resize
+template <typename T, Index N>
+using uninitialized_data = matpack_data<T, N, uninitialized_allocator<T>>;
+
+//! Matpack data with uninitialized storage from the thread-local arena, must not outlive its arena_scope
+template <typename T, Index N>
+using arena_data = matpack_data<T, N, arena_allocator<T>>;
 }  // namespace matpack
 
 //! A vector of Numeric
@@ -829,8 +855,8 @@ using ComplexTensor4 = matpack::matpack_data<Complex, 4>;
 //! A vector of Index
 using IndexVector = matpack::matpack_data<Index, 1>;
 
-template <typename T, Index N>
-struct std::formatter<matpack::matpack_data<T, N>> {
+template <typename T, Index N, typename Alloc>
+struct std::formatter<matpack::matpack_data<T, N, Alloc>> {
   std::formatter<matpack::matpack_view<T, N, true, false>> fmt;
 
   [[nodiscard]] constexpr auto& inner_fmt() { return fmt.inner_fmt(); }
@@ -842,7 +868,7 @@ struct std::formatter<matpack::matpack_data<T, N>> {
   }
 
   template <class FmtContext>
-  FmtContext::iterator format(const matpack::matpack_data<T, N>& v,
+  FmtContext::iterator format(const matpack::matpack_data<T, N, Alloc>& v,
                               FmtContext& ctx) const {
     return fmt.format(v, ctx);
   }
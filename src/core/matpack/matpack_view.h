@@ -365,7 +365,7 @@ class matpack_view {
   view_type view;
 
   //! Allow any matpack data type to access the private parts of this object
-  template <typename U, Index M>
+  template <typename U, Index M, typename B>
   friend class matpack_data;
 
   //! Allow any other matpack view type to access the private parts of this object
@@ -409,14 +409,15 @@ class matpack_view {
     requires(constant and strided)
       : view(x.view) {}
 
-  //! Construct this from the same size data view
-  constexpr matpack_view(const data_t& x) noexcept
+  //! Construct this from the same size data view, regardless of allocator
+  template <typename Alloc>
+  constexpr matpack_view(const matpack_data<T, N, Alloc>& x) noexcept
     requires(strided or constant)
       : matpack_view(x.view) {}
 
   //! Construct this from a smaller view by upping the rank with padded 1-extents to the right
-  template <Index M>
-  explicit constexpr matpack_view(const matpack_data<T, M>& x)
+  template <Index M, typename Alloc>
+  explicit constexpr matpack_view(const matpack_data<T, M, Alloc>& x)
     requires(N > M)
       : matpack_view(x.data_handle(), upview<N, M>(x.shape())) {}
 
@@ -463,6 +464,13 @@ class matpack_view {
     *this = x.view;
     return *this;
   }
+  template <typename Alloc>
+  constexpr matpack_view& operator=(const matpack_data<T, N, Alloc>& x)
+    requires(not constant)
+  {
+    *this = x.view;
+    return *this;
+  }
   constexpr matpack_view& operator=(const me_view& x)
     requires(not constant)
   {
@@ -1126,8 +1134,8 @@ class matpack_view {
                      [](auto a, auto b) { return a + b; });
     return *this;
   }
-  template <arithmetic_addition_with<T> U>
-  constexpr matpack_view& operator+=(const matpack_data<U, N>& x)
+  template <arithmetic_addition_with<T> U, typename Alloc>
+  constexpr matpack_view& operator+=(const matpack_data<U, N, Alloc>& x)
     requires(not constant)
   {
     *this += x.view;
@@ -1148,8 +1156,8 @@ class matpack_view {
                      [](auto a, auto b) { return a - b; });
     return *this;
   }
-  template <arithmetic_subtraction_with<T> U>
-  constexpr matpack_view& operator-=(const matpack_data<U, N>& x)
+  template <arithmetic_subtraction_with<T> U, typename Alloc>
+  constexpr matpack_view& operator-=(const matpack_data<U, N, Alloc>& x)
     requires(not constant)
   {
     *this -= x.view;
@@ -1170,8 +1178,8 @@ class matpack_view {
                      [](auto a, auto b) { return a * b; });
     return *this;
   }
-  template <arithmetic_multiplication_with<T> U>
-  constexpr matpack_view& operator*=(const matpack_data<U, N>& x)
+  template <arithmetic_multiplication_with<T> U, typename Alloc>
+  constexpr matpack_view& operator*=(const matpack_data<U, N, Alloc>& x)
     requires(not constant)
   {
     *this *= x.view;
@@ -1192,8 +1200,8 @@ class matpack_view {
                      [](auto a, auto b) { return a / b; });
     return *this;
   }
-  template <arithmetic_division_with<T> U>
-  constexpr matpack_view& operator/=(const matpack_data<U, N>& x)
+  template <arithmetic_division_with<T> U, typename Alloc>
+  constexpr matpack_view& operator/=(const matpack_data<U, N, Alloc>& x)
     requires(not constant)
   {
     *this /= x.view;
@@ -8,7 +8,17 @@
 
 #include "nlte.h"
 
+#include <lapack.h>
+#include <lin_alg.h>
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <limits>
+#include <string>
+
 #include "arts_constants.h"
+#include "arts_omp.h"
 #include "interp.h"
 #include "quantum_numbers.h"
 
@@ -296,3 +306,270 @@ std::pair<Numeric, Numeric> VibrationalEnergyLevels::lower_upper(
     const Key& key) const {
   return {at(key.LowerLevel()), at(key.UpperLevel())};
 }
+
+namespace {
+//! LU factorization in place of the transpose of a row-major square matrix
+int lu_factor(MatrixView LU, int* ipiv) {
+  int n = static_cast<int>(LU.nrows());
+  int info;
+  lapack::dgetrf_(&n, &n, LU.data_handle(), &n, ipiv, &info);
+  return info;
+}
+
+//! Solves A x = b in place, where LU is the factorization of A by lu_factor
+void lu_solve(MatrixView LU, int* ipiv, Vector& x) {
+  char trans = 'T';
+  int n      = static_cast<int>(LU.nrows());
+  int one    = 1;
+  int info;
+  lapack::dgetrs_(
+      &trans, &n, &one, LU.data_handle(), &n, ipiv, x.data_handle(), &n, &info);
+}
+
+Numeric max_abs(const ConstVectorView& x) {
+  Numeric out = 0.0;
+  for (auto& v : x) out = std::max(out, std::abs(v));
+  return out;
+}
+
+/** Iterative refinement of A x = b with the factorization of a nearby matrix
+ *
+ * @param[in,out] x The right-hand side b on input, the solution on output
+ * @return Whether the relative residual reached the tolerance
+ */
+bool refine(Vector& x,
+            const ConstMatrixView& A,
+            MatrixView LU,
+            int* ipiv,
+            const Index max_steps,
+            const Numeric tolerance) {
+  const Vector b{x};
+  const Numeric scale = norm_inf(A);
+  const Numeric bmax  = max_abs(b);
+
+  lu_solve(LU, ipiv, x);
+
+  Vector r(x.size());
+  for (Index i = 0;; i++) {
+    r = b;
+    mult(r, A, x, -1.0, 1.0);
+
+    const Numeric rmax = max_abs(r);
+    if (not std::isfinite(rmax)) return false;
+    if (rmax <= tolerance * (scale * max_abs(x) + bmax)) return true;
+    if (i == max_steps) return false;
+
+    lu_solve(LU, ipiv, r);
+    x += r;
+  }
+}
+}  // namespace
+
+StatisticalEquilibriumSolver::StatisticalEquilibriumSolver(Vector Aij_,
+                                                           Vector Bij_,
+                                                           Vector Bji_,
+                                                           ArrayOfIndex upper_,
+                                                           ArrayOfIndex lower_,
+                                                           Index nstates_)
+    : Aij(std::move(Aij_)),
+      Bij(std::move(Bij_)),
+      Bji(std::move(Bji_)),
+      upper(std::move(upper_)),
+      lower(std::move(lower_)),
+      nstates(nstates_),
+      conservation_row(find_first_unique_in_lower(upper, lower)) {
+  const Index nlines = Aij.size();
+
+  ARTS_USER_ERROR_IF(static_cast<Index>(Bij.size()) != nlines or
+                         static_cast<Index>(Bji.size()) != nlines or
+                         static_cast<Index>(upper.size()) != nlines or
+                         static_cast<Index>(lower.size()) != nlines,
+                     "Must have the same number of Aij ({}), Bij ({}), "
+                     "Bji ({}), upper ({}), and lower ({}) elements",
+                     Aij.size(),
+                     Bij.size(),
+                     Bji.size(),
+                     upper.size(),
+                     lower.size())
+
+  for (Index iline = 0; iline < nlines; iline++) {
+    ARTS_USER_ERROR_IF(upper[iline] < 0 or upper[iline] >= nstates or
+                           lower[iline] < 0 or lower[iline] >= nstates,
+                       "Line {} has states ({}, {}) outside of the {} states",
+                       iline,
+                       upper[iline],
+                       lower[iline],
+                       nstates)
+  }
+
+  ARTS_USER_ERROR_IF(conservation_row < 0 or conservation_row >= nstates,
+                     "Cannot find a state to hold the total number count")
+}
+
+void StatisticalEquilibriumSolver::set_collisions(Matrix Cij_, Matrix Cji_) {
+  ARTS_USER_ERROR_IF(Cij_.shape() != Cji_.shape() or
+                         Cij_.ncols() != static_cast<Index>(Aij.size()),
+                     "The collisional rates must be of shape [level, line] "
+                     "with {} lines, got {:B,} and {:B,}",
+                     Aij.size(),
+                     Cij_.shape(),
+                     Cji_.shape())
+
+  Cij = std::move(Cij_);
+  Cji = std::move(Cji_);
+
+  lu.resize(nlevels(), nstates, nstates);
+  pivots.assign(nlevels() * nstates, 0);
+  factored.assign(nlevels(), 0);
+}
+
+Index StatisticalEquilibriumSolver::solve(MatrixView x,
+                                          const ConstMatrixView& Jij,
+                                          const Numeric total_number_count) {
+  return solve_all(x, Jij, nullptr, total_number_count);
+}
+
+Index StatisticalEquilibriumSolver::solve(MatrixView x,
+                                          const ConstMatrixView& Jij,
+                                          const ConstMatrixView& Lambda,
+                                          const Numeric total_number_count) {
+  ARTS_USER_ERROR_IF(Lambda.shape() != Jij.shape(),
+                     "Lambda must be of the shape of the radiation field, "
+                     "got {:B,} and {:B,}",
+                     Lambda.shape(),
+                     Jij.shape())
+  return solve_all(x, Jij, &Lambda, total_number_count);
+}
+
+Index StatisticalEquilibriumSolver::solve_all(
+    MatrixView x,
+    const ConstMatrixView& Jij,
+    const ConstMatrixView* Lambda,
+    const Numeric total_number_count) {
+  const Index nlev = nlevels();
+
+  ARTS_USER_ERROR_IF(Jij.nrows() != nlev or Jij.ncols() != Cij.ncols(),
+                     "The radiation field must be of shape [{}, {}], got {:B,}",
+                     nlev,
+                     Cij.ncols(),
+                     Jij.shape())
+  ARTS_USER_ERROR_IF(x.nrows() != nlev or x.ncols() != nstates,
+                     "The ratios must be of shape [{}, {}], got {:B,}",
+                     nlev,
+                     nstates,
+                     x.shape())
+
+  std::string error{};
+  Index nfactored = 0;
+
+#pragma omp parallel for if (not arts_omp_in_parallel()) reduction(+ : nfactored)
+  for (Index ilev = 0; ilev < nlev; ilev++) {
+    try {
+      Matrix A(nstates, nstates);
+      Vector b(nstates, 0.0);
+
+      if (Lambda) {
+        dampened_statistical_equilibrium_equation(A,
+                                                  x[ilev],
+                                                  Aij,
+                                                  Bij,
+                                                  Bji,
+                                                  Cij[ilev],
+                                                  Cji[ilev],
+                                                  Jij[ilev],
+                                                  (*Lambda)[ilev],
+                                                  upper,
+                                                  lower,
+                                                  total_number_count);
+      } else {
+        statistical_equilibrium_equation(A,
+                                         Aij,
+                                         Bij,
+                                         Bji,
+                                         Cij[ilev],
+                                         Cji[ilev],
+                                         Jij[ilev],
+                                         upper,
+                                         lower);
+      }
+      set_constant_statistical_equilibrium_matrix(
+          A, b, total_number_count, conservation_row);
+
+      MatrixView LU = lu[ilev];
+      int* ipiv     = pivots.data() + ilev * nstates;
+
+      Vector y{b};
+      if (not(factored[ilev] and
+              refine(y, A, LU, ipiv, max_refinements, refinement_tolerance))) {
+        factored[ilev] = 0;
+
+        LU             = A;
+        const int info = lu_factor(LU, ipiv);
+        ARTS_USER_ERROR_IF(info != 0,
+                           "The statistical equilibrium equation of level {} "
+                           "is singular",
+                           ilev)
+
+        factored[ilev] = 1;
+        nfactored++;
+
+        y = b;
+        lu_solve(LU, ipiv, y);
+      }
+
+      x[ilev] = y;
+    } catch (const std::exception& e) {
+#pragma omp critical
+      error += std::string(e.what()) + '\n';
+    }
+  }
+
+  ARTS_USER_ERROR_IF(not error.empty(), "{}", error)
+
+  return nfactored;
+}
+
+bool NgAcceleration::operator()(MatrixView x) {
+  if (count > 0 and previous[0].shape() != x.shape()) count = 0;
+
+  if (count < 3) {
+    std::rotate(previous.begin(), previous.begin() + 2, previous.end());
+    previous[0] = Matrix(x);
+    count++;
+    return false;
+  }
+
+  for (Index ilev = 0; ilev < x.nrows(); ilev++) {
+    VectorView x0       = x[ilev];
+    ConstVectorView x1 = previous[0][ilev];
+    ConstVectorView x2 = previous[1][ilev];
+    ConstVectorView x3 = previous[2][ilev];
+
+    Numeric a1 = 0.0, b1 = 0.0, c1 = 0.0, b2 = 0.0, c2 = 0.0;
+    for (Index i = 0; i < x.ncols(); i++) {
+      const Numeric w  = x0[i] == 0.0 ? 1.0 : 1.0 / Math::pow2(x0[i]);
+      const Numeric d0 = x0[i] - x1[i];
+      const Numeric q1 = d0 - (x1[i] - x2[i]);
+      const Numeric q2 = d0 - (x2[i] - x3[i]);
+
+      a1 += w * q1 * q1;
+      b1 += w * q1 * q2;
+      c1 += w * q1 * d0;
+      b2 += w * q2 * q2;
+      c2 += w * q2 * d0;
+    }
+
+    //! Skip levels where the extrapolation is ill-conditioned
+    const Numeric det = a1 * b2 - b1 * b1;
+    if (not(det > std::numeric_limits<Numeric>::epsilon() * a1 * b2)) continue;
+
+    const Numeric a = (c1 * b2 - c2 * b1) / det;
+    const Numeric b = (c2 * a1 - c1 * b1) / det;
+    for (Index i = 0; i < x.ncols(); i++) {
+      x0[i] = (1.0 - a - b) * x0[i] + a * x1[i] + b * x2[i];
+    }
+  }
+
+  count = 0;
+  return true;
+}
@@ -12,7 +12,9 @@
 #include <absorptionlines.h>
 #include <matpack.h>
 
+#include <array>
 #include <unordered_map>
+#include <vector>
 
 #include "quantum_numbers.h"
 
@@ -214,6 +216,119 @@ Index find_first_unique_in_lower(const ArrayOfIndex& upper,
 void check_collision_line_identifiers(
     const ArrayOfQuantumIdentifier& collision_line_identifiers);
 
+/** Solves the statistical equilibrium equation for many atmospheric levels
+ *
+ * The small systems of all levels are assembled into one contiguous block
+ * and factored in parallel.  The LU factorizations are kept between calls.
+ * In an iteration where only the radiation field changes, the kept
+ * factorization is used with iterative refinement for the new system, and a
+ * level is only factored anew if the refinement does not converge.  Changing
+ * the collisional rates invalidates all factorizations.
+ */
+class StatisticalEquilibriumSolver {
+  Vector Aij;
+  Vector Bij;
+  Vector Bji;
+  ArrayOfIndex upper;
+  ArrayOfIndex lower;
+  Index nstates;
+  Index conservation_row;
+
+  //! The collisional rates as [level, line]
+  Matrix Cij;
+  Matrix Cji;
+
+  //! The LU factorizations of the transposed systems as [level, state, state]
+  Tensor3 lu;
+  std::vector<int> pivots;
+  std::vector<char> factored;
+
+  Index solve_all(MatrixView x,
+                  const ConstMatrixView& Jij,
+                  const ConstMatrixView* Lambda,
+                  const Numeric total_number_count);
+
+ public:
+  //! The maximum number of refinement steps before a level is factored anew
+  Index max_refinements{4};
+
+  //! The relative residual accepted by iterative refinement
+  Numeric refinement_tolerance{1e-12};
+
+  /** Set up the solver for a set of lines
+   *
+   * @param[in] Aij Einstein coefficient for spontaneuos emission of all lines
+   * @param[in] Bij Einstein coefficient for induced emission of all lines
+   * @param[in] Bji Einstein coefficient for induced absorption of all lines
+   * @param[in] upper Index list for upper state levels for each line
+   * @param[in] lower Index list for lower state levels for each line
+   * @param[in] nstates The number of states
+   */
+  StatisticalEquilibriumSolver(Vector Aij,
+                               Vector Bij,
+                               Vector Bji,
+                               ArrayOfIndex upper,
+                               ArrayOfIndex lower,
+                               Index nstates);
+
+  /** Set the collisional rates of all levels
+   *
+   * @param[in] Cij Collisional rate of change from upper to lower state as [level, line]
+   * @param[in] Cji Collisional rate of change from lower to upper state as [level, line]
+   */
+  void set_collisions(Matrix Cij, Matrix Cji);
+
+  /** Solve the statistical equilibrium equation of all levels
+   *
+   * @param[out] x Ratio of molecules for each state as [level, state]
+   * @param[in] Jij Radiation field for each line as [level, line]
+   * @param[in] total_number_count The sum of the ratios
+   * @return The number of levels that had to be factored anew
+   */
+  Index solve(MatrixView x,
+              const ConstMatrixView& Jij,
+              const Numeric total_number_count = 1.0);
+
+  /** Solve the dampened statistical equilibrium equation of all levels
+   *
+   * @param[in,out] x Ratio of molecules for each state as [level, state], the previous iterate on input
+   * @param[in] Jij Radiation field for each line as [level, line]
+   * @param[in] Lambda Transmission for each line as [level, line]
+   * @param[in] total_number_count The sum of the ratios
+   * @return The number of levels that had to be factored anew
+   */
+  Index solve(MatrixView x,
+              const ConstMatrixView& Jij,
+              const ConstMatrixView& Lambda,
+              const Numeric total_number_count = 1.0);
+
+  //! The number of atmospheric levels
+  [[nodiscard]] Index nlevels() const { return Cij.nrows(); }
+};
+
+/** Ng acceleration of an iteration of level populations
+ *
+ * Keeps the previous iterates and, once four iterates are known, replaces the
+ * newest by the extrapolation that minimizes the weighted change between
+ * iterates, per atmospheric level (Ng, 1974, as formulated by Auer, 1987).
+ * The history is cleared after each extrapolation.
+ */
+class NgAcceleration {
+  std::array<Matrix, 3> previous;
+  Index count{0};
+
+ public:
+  /** Add an iterate and extrapolate it if enough iterates are known
+   *
+   * @param[in,out] x The newest iterate as [level, state]
+   * @return Whether x was extrapolated
+   */
+  bool operator()(MatrixView x);
+
+  //! Forget all previous iterates
+  void reset() { count = 0; }
+};
+
 template <>
 struct std::formatter<VibrationalEnergyLevels> {
   format_tags tags;
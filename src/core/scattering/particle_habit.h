@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <optional>
 #include <variant>
 
@@ -80,21 +81,26 @@ using ScatteringData = std::variant<
  *
  * Represents a set of particles that can be used to infer bulk scattering
  * properties at a given point in the atmosphere.
+ *
+ * The particle data is held in a shared buffer.  Copies of a habit share the
+ * same data, so that one habit database can be used by several species,
+ * threads and Python objects at once.  The data is only copied when a
+ * particle is appended to a habit whose data is shared (copy-on-write).
  */
 class ParticleHabit {
 
   public:
-  static ParticleHabit from_legacy_tro(std::vector<::SingleScatteringData> ssd_,
-                                       std::vector<::ScatteringMetaData> meta_) {
+  static ParticleHabit from_legacy_tro(const std::vector<::SingleScatteringData>& ssd_,
+                                       const std::vector<::ScatteringMetaData>& meta_) {
     std::vector<SingleScatteringData<Numeric, Format::TRO, Representation::Gridded, 4>> ssd;
     ssd.reserve(ssd_.size());
     for (auto ind = 0; ind < Index(ssd_.size()); ++ind) {
       ssd.push_back(SingleScatteringData<Numeric, Format::TRO, Representation::Gridded, 4>::from_legacy_tro(ssd_[ind], meta_[ind]));
     }
-    return ParticleHabit(ssd);
+    return ParticleHabit(std::move(ssd));
   }
 
-  ParticleHabit() {}
+  ParticleHabit() : scattering_data(std::make_shared<ScatteringData>()) {}
 
   /** Create particle habit from TRO scattering data.
    *
@@ -111,24 +117,69 @@ class ParticleHabit {
    */
    template<Format format, Representation representation, Index stokes_dim>
      ParticleHabit(std::vector<SingleScatteringData<Numeric, format, representation, stokes_dim>> scattering_data_)
-      : scattering_data(scattering_data_) {}
+      : scattering_data(std::make_shared<ScatteringData>(std::move(scattering_data_))) {}
 
 
+  /** Append a particle to the habit
+   *
+   * All particles of a habit must have the same format, representation and
+   * Stokes dimension, except that the first particle of an empty habit
+   * may be of any type.
+   *
+   * The data is copied first if it is shared with another habit.  Whether it
+   * is shared is only known from the use count, which another thread may
+   * change at any time, so a habit must not be copied by one thread while
+   * another thread appends to it.
+   */
   template <Format format, Representation repr, Index stokes_dim>
     void append_particle(const SingleScatteringData<Numeric, format, repr, stokes_dim> &ssd) {
-    auto append = [&ssd](auto vec) {vec.push_back(ssd);};
-    std::visit(append, scattering_data);
+    using SSD = SingleScatteringData<Numeric, format, repr, stokes_dim>;
+
+    if (scattering_data.use_count() > 1) {
+      scattering_data = std::make_shared<ScatteringData>(*scattering_data);
+    }
+
+    if (size() == 0) *scattering_data = std::vector<SSD>{};
+
+    auto* particles = std::get_if<std::vector<SSD>>(scattering_data.get());
+    ARTS_USER_ERROR_IF(not particles,
+                       "All particles of a habit must have the same format, "
+                       "representation and Stokes dimension")
+    particles->push_back(ssd);
+  }
+
+  Index size() const {
+    return std::visit([](const auto& vec) { return static_cast<Index>(vec.size()); },
+                      *scattering_data);
   }
 
-  Index size() {
-    return std::visit([](auto vec){return vec.size();}, scattering_data);
+  const ScatteringData& get_scattering_data() const { return *scattering_data; }
+
+  /** The single scattering data of a particle, without copying
+   *
+   * @tparam SSD The single scattering data type of the habit
+   * @param ind The index of the particle
+   */
+  template <typename SSD>
+  const SSD& get(Index ind) const {
+    const auto* particles = std::get_if<std::vector<SSD>>(scattering_data.get());
+    ARTS_USER_ERROR_IF(not particles,
+                       "The particles of the habit are of a different type")
+    ARTS_USER_ERROR_IF(ind < 0 or ind >= size(),
+                       "Particle index {} is out of range for a habit of {} particles",
+                       ind,
+                       size())
+    return (*particles)[ind];
   }
 
-  ParticleData operator[](Index ind) {
-    return std::visit([&ind](auto vec){return ParticleData(vec[ind]);}, scattering_data);
+  //! A copy of the single scattering data of a particle
+  ParticleData operator[](Index ind) const {
+    return std::visit(
+        [ind](const auto& vec) { return ParticleData(vec[ind]); },
+        *scattering_data);
   }
 
  private:
-  ScatteringData scattering_data;
+  std::shared_ptr<ScatteringData> scattering_data;
 };
 }  // namespace scattering
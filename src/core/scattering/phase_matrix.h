@@ -714,11 +714,27 @@ class PhaseMatrixData<Scalar, Format::TRO, Representation::Gridded, stokes_dim>
 
     PhaseMatrixDataSpectral result(t_grid_, f_grid_, sht);
 
+    //! All slices are transformed in one batch
+    const Index n_batch = n_temps_ * n_freqs_ * n_stokes_coeffs;
+    Tensor3 spatial(n_batch, 1, n_za_scat_);
+    ComplexMatrix spectral(n_batch, sht->get_n_spectral_coeffs());
+
+    Index i_batch = 0;
+    for (Index i_t = 0; i_t < n_temps_; ++i_t) {
+      for (Index i_f = 0; i_f < n_freqs_; ++i_f) {
+        for (Index i_s = 0; i_s < n_stokes_coeffs; ++i_s) {
+          spatial(i_batch++, 0, joker) = this->operator()(i_t, i_f, joker, i_s);
+        }
+      }
+    }
+
+    sht->transform(spectral, spatial);
+
+    i_batch = 0;
     for (Index i_t = 0; i_t < n_temps_; ++i_t) {
       for (Index i_f = 0; i_f < n_freqs_; ++i_f) {
         for (Index i_s = 0; i_s < n_stokes_coeffs; ++i_s) {
-          result(i_t, i_f, joker, i_s) =
-              sht->transform(this->operator()(i_t, Range(i_f, 1), joker, i_s));
+          result(i_t, i_f, joker, i_s) = spectral[i_batch++];
         }
       }
     }
@@ -1097,11 +1113,29 @@ class PhaseMatrixData<Scalar, Format::TRO, repr, stokes_dim>
     auto za_grid = std::make_shared<ZenithAngleGrid>(sht_->get_zenith_angle_grid());
     PhaseMatrixDataGridded result(t_grid_, f_grid_, za_grid);
 
+    //! All slices are synthesized in one batch
+    const Index n_batch = n_temps_ * n_freqs_ * n_stokes_coeffs;
+    ComplexMatrix spectral(n_batch, n_spectral_coeffs_);
+    Tensor3 spatial(n_batch,
+                    sht_->get_n_azimuth_angles(),
+                    sht_->get_n_zenith_angles());
+
+    Index i_batch = 0;
     for (Index i_t = 0; i_t < n_temps_; ++i_t) {
       for (Index i_f = 0; i_f < n_freqs_; ++i_f) {
         for (Index i_s = 0; i_s < n_stokes_coeffs; ++i_s) {
-          result(i_t, i_f, joker, i_s) = sht_->synthesize(
-              this->operator()(i_t, i_f, joker, i_s))(0, joker);
+          spectral[i_batch++] = this->operator()(i_t, i_f, joker, i_s);
+        }
+      }
+    }
+
+    sht_->synthesize(spatial, spectral);
+
+    i_batch = 0;
+    for (Index i_t = 0; i_t < n_temps_; ++i_t) {
+      for (Index i_f = 0; i_f < n_freqs_; ++i_f) {
+        for (Index i_s = 0; i_s < n_stokes_coeffs; ++i_s) {
+          result(i_t, i_f, joker, i_s) = spatial(i_batch++, 0, joker);
         }
       }
     }
@@ -1385,12 +1419,31 @@ class PhaseMatrixData<Scalar, Format::ARO, Representation::Gridded, stokes_dim>
 
     PhaseMatrixDataSpectral result(t_grid_, f_grid_, za_inc_grid_, sht);
 
+    //! All slices are transformed in one batch
+    const Index n_batch = n_temps_ * n_freqs_ * n_za_inc_ * n_stokes_coeffs;
+    Tensor3 spatial(n_batch, n_delta_aa_, n_za_scat_);
+    ComplexMatrix spectral(n_batch, sht->get_n_spectral_coeffs());
+
+    Index i_batch = 0;
+    for (Index i_t = 0; i_t < n_temps_; ++i_t) {
+      for (Index i_f = 0; i_f < n_freqs_; ++i_f) {
+        for (Index i_za_inc = 0; i_za_inc < n_za_inc_; ++i_za_inc) {
+          for (Index i_s = 0; i_s < n_stokes_coeffs; ++i_s) {
+            spatial[i_batch++] =
+                this->operator()(i_t, i_f, i_za_inc, joker, joker, i_s);
+          }
+        }
+      }
+    }
+
+    sht->transform(spectral, spatial);
+
+    i_batch = 0;
     for (Index i_t = 0; i_t < n_temps_; ++i_t) {
       for (Index i_f = 0; i_f < n_freqs_; ++i_f) {
         for (Index i_za_inc = 0; i_za_inc < n_za_inc_; ++i_za_inc) {
           for (Index i_s = 0; i_s < n_stokes_coeffs; ++i_s) {
-            result(i_t, i_f, i_za_inc, joker, i_s) = sht->transform(
-                this->operator()(i_t, i_f, i_za_inc, joker, joker, i_s));
+            result(i_t, i_f, i_za_inc, joker, i_s) = spectral[i_batch++];
           }
         }
       }
@@ -1901,12 +1954,33 @@ class PhaseMatrixData<Scalar, Format::ARO, Representation::Spectral, stokes_dim>
                                   sht_->get_aa_grid_ptr(),
                                   sht_->get_za_grid_ptr());
 
+    //! All slices are synthesized in one batch
+    const Index n_batch = n_temps_ * n_freqs_ * n_za_inc_ * n_stokes_coeffs;
+    ComplexMatrix spectral(n_batch, n_spectral_coeffs_);
+    Tensor3 spatial(n_batch,
+                    sht_->get_n_azimuth_angles(),
+                    sht_->get_n_zenith_angles());
+
+    Index i_batch = 0;
+    for (Index i_t = 0; i_t < n_temps_; ++i_t) {
+      for (Index i_f = 0; i_f < n_freqs_; ++i_f) {
+        for (Index i_za_inc = 0; i_za_inc < n_za_inc_; ++i_za_inc) {
+          for (Index i_s = 0; i_s < n_stokes_coeffs; ++i_s) {
+            spectral[i_batch++] =
+                this->operator()(i_t, i_f, i_za_inc, joker, i_s);
+          }
+        }
+      }
+    }
+
+    sht_->synthesize(spatial, spectral);
+
+    i_batch = 0;
     for (Index i_t = 0; i_t < n_temps_; ++i_t) {
       for (Index i_f = 0; i_f < n_freqs_; ++i_f) {
         for (Index i_za_inc = 0; i_za_inc < n_za_inc_; ++i_za_inc) {
           for (Index i_s = 0; i_s < n_stokes_coeffs; ++i_s) {
-            result(i_t, i_f, i_za_inc, joker, joker, i_s) = sht_->synthesize(
-                this->operator()(i_t, i_f, i_za_inc, joker, i_s));
+            result(i_t, i_f, i_za_inc, joker, joker, i_s) = spatial[i_batch++];
           }
         }
       }
@@ -1,5 +1,13 @@
 #include "scattering_species.h"
 
+#include <algorithm>
+#include <numeric>
+
+#include "cloudbox.h"
+#include "interpolation.h"
+#include "logic.h"
+#include "microphysics.h"
+
 namespace scattering {
 
   std::ostream& operator<<(std::ostream& os,
@@ -8,4 +16,432 @@ namespace scattering {
     return os;
 }
 
-}  // namespace Scattering
+ScatteringHabit::ScatteringHabit(ParticleHabit particle_habit_,
+                                 PSD psd_,
+                                 ParticulateProperty size_parameter_)
+    : particle_habit(std::move(particle_habit_)),
+      psd(std::move(psd_)),
+      size_parameter(size_parameter_) {
+  ARTS_USER_ERROR_IF(size_parameter != ParticulateProperty::DVeq and
+                         size_parameter != ParticulateProperty::DMax,
+                     "The size parameter must be DVeq or DMax, not {}",
+                     size_parameter)
+}
+
+void ScatteringHabit::prepare_scattering_data(const ScatteringDataSpec& spec) {
+  ARTS_USER_ERROR_IF(not spec.t_grid or not spec.f_grid or not spec.za_scat_grid,
+                     "All grids must be given to prepare scattering data")
+  ARTS_USER_ERROR_IF(spec.t_grid->empty() or spec.f_grid->empty(),
+                     "The temperature and frequency grids may not be empty")
+  ARTS_USER_ERROR_IF(not is_increasing(*spec.t_grid),
+                     "The temperature grid must be strictly increasing:\n{}",
+                     *spec.t_grid)
+
+  std::visit([&](const auto& data) { prepare(data, spec); },
+             particle_habit.get_scattering_data());
+}
+
+template <Format format, Representation repr, Index stokes_dim>
+void ScatteringHabit::prepare(
+    const std::vector<SingleScatteringData<Numeric, format, repr, stokes_dim>>&
+        data,
+    const ScatteringDataSpec& spec) {
+  if constexpr (format != Format::TRO or repr != Representation::Gridded) {
+    ARTS_USER_ERROR(
+        "Only gridded data of totally random orientation is supported by "
+        "scattering habits")
+  } else {
+    using PM = PhaseMatrixData<Numeric, format, repr, stokes_dim>;
+    using EM = ExtinctionMatrixData<Numeric, format, repr, stokes_dim>;
+    using AV = AbsorptionVectorData<Numeric, format, repr, stokes_dim>;
+
+    const Index np = static_cast<Index>(data.size());
+    ARTS_USER_ERROR_IF(
+        np < 2, "A scattering habit needs at least two particles, got {}", np)
+
+    Vector size(np), mass(np);
+    for (Index i = 0; i < np; i++) {
+      ARTS_USER_ERROR_IF(not data[i].properties,
+                         "Particle {} of the habit has no particle properties",
+                         i)
+      ARTS_USER_ERROR_IF(not data[i].phase_matrix,
+                         "Particle {} of the habit has no phase matrix data",
+                         i)
+      size[i] = size_parameter == ParticulateProperty::DMax
+                    ? data[i].properties->d_max
+                    : data[i].properties->d_veq;
+      mass[i] = data[i].properties->mass;
+    }
+
+    //! The PSD is integrated over the particles in order of size
+    std::vector<Index> order(np);
+    std::iota(order.begin(), order.end(), 0);
+    std::ranges::sort(order, {}, [&size](Index i) { return size[i]; });
+
+    Vector sorted_sizes(np);
+    for (Index i = 0; i < np; i++) sorted_sizes[i] = size[order[i]];
+    ARTS_USER_ERROR_IF(not is_increasing(sorted_sizes),
+                       "The particle sizes of the habit must be unique:\n{}",
+                       sorted_sizes)
+
+    Vector weights(np);
+    bin_quadweights(weights, sorted_sizes);
+
+    Numeric a, b;
+    derive_scat_species_a_and_b(
+        a, b, size, mass, sorted_sizes[0], sorted_sizes[np - 1]);
+
+    const Index nt  = spec.t_grid->size();
+    const Index nf  = spec.f_grid->size();
+    const Index nza = grid_size(*spec.za_scat_grid);
+
+    Tensor3 pm_data(nt, np, nf * nza * PM::n_stokes_coeffs);
+    Tensor3 em_data(nt, np, nf * EM::n_stokes_coeffs);
+    Tensor3 av_data(nt, np, nf * AV::n_stokes_coeffs);
+
+    const auto [f_min, f_max] = std::ranges::minmax(*spec.f_grid);
+    const ScatteringDataGrids grids{spec.t_grid, spec.f_grid, spec.za_scat_grid};
+    for (Index ip = 0; ip < np; ip++) {
+      const auto& ssd = data[order[ip]];
+
+      PM pm       = *ssd.phase_matrix;
+      EM em       = ssd.extinction_matrix;
+      AV av       = ssd.absorption_vector;
+      auto t_old  = pm.get_t_grid();
+      auto f_old  = pm.get_f_grid();
+      auto za_old = pm.get_za_scat_grid();
+
+      ARTS_USER_ERROR_IF(
+          f_min < f_old->front() or f_max > f_old->back(),
+          "The frequencies [{}, {}] Hz are outside the [{}, {}] Hz of particle {}",
+          f_min,
+          f_max,
+          f_old->front(),
+          f_old->back(),
+          order[ip])
+
+      //! Data at a single temperature or frequency is made constant over two
+      //! grid points so that it can be regridded
+      if (t_old->size() == 1 or f_old->size() == 1) {
+        const auto pad = [](const std::shared_ptr<const Vector>& x) {
+          return x->size() > 1 ? x
+                               : std::make_shared<const Vector>(
+                                     Vector{x->front(), x->front() + 1.0});
+        };
+
+        const auto t_pad = pad(t_old);
+        const auto f_pad = pad(f_old);
+        PM pm_pad(t_pad, f_pad, za_old);
+        EM em_pad(t_pad, f_pad);
+        AV av_pad(t_pad, f_pad);
+        for (Index it = 0; it < t_pad->size(); it++) {
+          const Index jt = std::min<Index>(it, t_old->size() - 1);
+          for (Index iv = 0; iv < f_pad->size(); iv++) {
+            const Index jv = std::min<Index>(iv, f_old->size() - 1);
+            pm_pad(it, iv, joker, joker) = pm(jt, jv, joker, joker);
+            em_pad(it, iv, joker)        = em(jt, jv, joker);
+            av_pad(it, iv, joker)        = av(jt, jv, joker);
+          }
+        }
+
+        pm    = std::move(pm_pad);
+        em    = std::move(em_pad);
+        av    = std::move(av_pad);
+        t_old = t_pad;
+        f_old = f_pad;
+      }
+
+      //! Temperatures and angles outside the data use the edge values
+      auto t_new = std::make_shared<Vector>(*spec.t_grid);
+      for (auto& t : *t_new) t = std::clamp(t, t_old->front(), t_old->back());
+
+      const ConstVectorView za_old_grid = grid_vector(*za_old);
+      Vector za_clamped(grid_vector(*spec.za_scat_grid));
+      for (auto& za : za_clamped) {
+        za = std::clamp(za, za_old_grid.front(), za_old_grid.back());
+      }
+      auto za_new = std::make_shared<const ZenithAngleGrid>(
+          IrregularZenithAngleGrid(za_clamped));
+
+      const auto regrid_weights = calc_regrid_weights(
+          t_old,
+          f_old,
+          nullptr,
+          nullptr,
+          nullptr,
+          za_old,
+          ScatteringDataGrids{t_new, spec.f_grid, za_new});
+
+      const PM pm_new = pm.regrid(grids, regrid_weights);
+      const EM em_new = em.regrid(grids, regrid_weights);
+      const AV av_new = av.regrid(grids, regrid_weights);
+
+      for (Index it = 0; it < nt; it++) {
+        Index i = 0;
+        for (Index iv = 0; iv < nf; iv++) {
+          for (Index iza = 0; iza < nza; iza++) {
+            for (Index is = 0; is < PM::n_stokes_coeffs; is++) {
+              pm_data(it, ip, i++) = pm_new(it, iv, iza, is);
+            }
+          }
+        }
+
+        i = 0;
+        for (Index iv = 0; iv < nf; iv++) {
+          for (Index is = 0; is < EM::n_stokes_coeffs; is++) {
+            em_data(it, ip, i++) = em_new(it, iv, is);
+          }
+        }
+
+        i = 0;
+        for (Index iv = 0; iv < nf; iv++) {
+          for (Index is = 0; is < AV::n_stokes_coeffs; is++) {
+            av_data(it, ip, i++) = av_new(it, iv, is);
+          }
+        }
+      }
+    }
+
+    prepared = std::make_shared<const PreparedData>(
+        PreparedData{.sizes                      = std::move(sorted_sizes),
+                     .size_weights               = std::move(weights),
+                     .mass_size_a                = a,
+                     .mass_size_b                = b,
+                     .t_grid                     = spec.t_grid,
+                     .f_grid                     = spec.f_grid,
+                     .za_scat_grid               = spec.za_scat_grid,
+                     .phase_matrix_data          = std::move(pm_data),
+                     .extinction_matrix_data     = std::move(em_data),
+                     .absorption_vector_data     = std::move(av_data),
+                     .n_phase_matrix_coeffs      = PM::n_stokes_coeffs,
+                     .n_extinction_matrix_coeffs = EM::n_stokes_coeffs,
+                     .n_absorption_vector_coeffs = AV::n_stokes_coeffs});
+  }
+}
+
+void ScatteringHabit::check_prepared(const Vector& f_grid_) const {
+  ARTS_USER_ERROR_IF(not is_prepared(),
+                     "The scattering habit has not been prepared, call "
+                     "prepare_scattering_data with the simulation grids first")
+
+  const auto& data = *prepared;
+  ARTS_USER_ERROR_IF(not std::ranges::equal(f_grid_, *data.f_grid),
+                     "The frequency grid:\n{}\n"
+                     "is not the one the scattering habit was prepared for:\n{}",
+                     f_grid_,
+                     *data.f_grid)
+}
+
+Vector ScatteringHabit::particle_number_density(
+    const AtmPoint& atm_point) const {
+  ARTS_USER_ERROR_IF(not is_prepared(),
+                     "The scattering habit has not been prepared, call "
+                     "prepare_scattering_data with the simulation grids first")
+
+  const auto& data = *prepared;
+
+  Vector pnd = std::visit(
+      [&](const auto& x) {
+        return x.evaluate(
+            atm_point, data.sizes, data.mass_size_a, data.mass_size_b);
+      },
+      psd);
+  pnd *= data.size_weights;
+  return pnd;
+}
+
+template <Index stokes_dim>
+BulkScatteringProperties<Format::TRO, Representation::Gridded, stokes_dim>
+ScatteringHabit::bulk_scattering_properties(const AtmPoint& atm_point) const {
+  using PM = PhaseMatrixData<Numeric, Format::TRO, Representation::Gridded, stokes_dim>;
+  using EM = ExtinctionMatrixData<Numeric, Format::TRO, Representation::Gridded, stokes_dim>;
+  using AV = AbsorptionVectorData<Numeric, Format::TRO, Representation::Gridded, stokes_dim>;
+
+  const auto& data = *prepared;
+  ARTS_USER_ERROR_IF(
+      PM::n_stokes_coeffs > data.n_phase_matrix_coeffs or
+          EM::n_stokes_coeffs > data.n_extinction_matrix_coeffs or
+          AV::n_stokes_coeffs > data.n_absorption_vector_coeffs,
+      "The particle data has too few Stokes components for a "
+      "Stokes dimension of {}",
+      stokes_dim)
+
+  const Vector pnd = particle_number_density(atm_point);
+
+  //! Linear interpolation in temperature, constant outside the grid
+  const Numeric t = atm_point[AtmKey::t];
+  Index it        = 0;
+  Numeric w_l     = 1.0;
+  Numeric w_r     = 0.0;
+  if (data.t_grid->size() > 1) {
+    GridPos gp;
+    gridpos(gp,
+            *data.t_grid,
+            std::clamp(t, data.t_grid->front(), data.t_grid->back()));
+    it  = gp.idx;
+    w_l = gp.fd[1];
+    w_r = gp.fd[0];
+  }
+
+  //! The PSD-weighted sum over all particles
+  const auto sum = [&](const Tensor3& table) {
+    Vector x(table.ncols());
+    mult(x, transpose(table[it]), pnd, w_l);
+    if (w_r != 0.0) mult(x, transpose(table[it + 1]), pnd, w_r, 1.0);
+    return x;
+  };
+
+  const Vector pm_sum = sum(data.phase_matrix_data);
+  const Vector em_sum = sum(data.extinction_matrix_data);
+  const Vector av_sum = sum(data.absorption_vector_data);
+
+  const auto t_ptr = std::make_shared<const Vector>(Vector{t});
+  PM pm(t_ptr, data.f_grid, data.za_scat_grid);
+  EM em(t_ptr, data.f_grid);
+  AV av(t_ptr, data.f_grid);
+
+  const Index nf  = data.f_grid->size();
+  const Index nza = grid_size(*data.za_scat_grid);
+  for (Index iv = 0; iv < nf; iv++) {
+    for (Index iza = 0; iza < nza; iza++) {
+      for (Index is = 0; is < PM::n_stokes_coeffs; is++) {
+        pm(0, iv, iza, is) =
+            pm_sum[(iv * nza + iza) * data.n_phase_matrix_coeffs + is];
+      }
+    }
+
+    for (Index is = 0; is < EM::n_stokes_coeffs; is++) {
+      em(0, iv, is) = em_sum[iv * data.n_extinction_matrix_coeffs + is];
+    }
+
+    for (Index is = 0; is < AV::n_stokes_coeffs; is++) {
+      av(0, iv, is) = av_sum[iv * data.n_absorption_vector_coeffs + is];
+    }
+  }
+
+  return BulkScatteringProperties<Format::TRO, Representation::Gridded, stokes_dim>{
+      pm, em, av};
+}
+
+template <Index stokes_dim>
+BulkScatteringProperties<Format::TRO, Representation::Gridded, stokes_dim>
+ScatteringHabit::get_bulk_scattering_properties_tro_gridded(
+    const AtmPoint& atm_point,
+    const Vector& f_grid_,
+    std::shared_ptr<ZenithAngleGrid> za_scat_grid_) const {
+  check_prepared(f_grid_);
+
+  const auto& data = *prepared;
+  ARTS_USER_ERROR_IF(
+      not std::ranges::equal(grid_vector(*za_scat_grid_),
+                             grid_vector(*data.za_scat_grid)),
+      "The scattering zenith angle grid is not the one the scattering habit "
+      "was prepared for")
+
+  return bulk_scattering_properties<stokes_dim>(atm_point);
+}
+
+template <Index stokes_dim>
+BulkScatteringProperties<Format::TRO, Representation::Spectral, stokes_dim>
+ScatteringHabit::get_bulk_scattering_properties_tro_spectral(
+    const AtmPoint& atm_point, const Vector& f_grid_, Index degree) const {
+  check_prepared(f_grid_);
+
+  const auto& data = *prepared;
+
+  auto sht_ptr = sht::provider.get_instance_lm(degree, 0);
+  ARTS_USER_ERROR_IF(
+      not std::ranges::equal(grid_vector(*sht_ptr->get_za_grid_ptr()),
+                             grid_vector(*data.za_scat_grid)),
+      "The scattering habit must be prepared for the zenith angle grid of "
+      "the spherical harmonics transform of degree {}",
+      degree)
+
+  auto bsp = bulk_scattering_properties<stokes_dim>(atm_point);
+  return BulkScatteringProperties<Format::TRO, Representation::Spectral, stokes_dim>{
+      bsp.phase_matrix->to_spectral(sht_ptr),
+      bsp.extinction_matrix.to_spectral(),
+      bsp.absorption_vector.to_spectral()};
+}
+
+template <Index stokes_dim>
+BulkScatteringProperties<Format::ARO, Representation::Gridded, stokes_dim>
+ScatteringHabit::get_bulk_scattering_properties_aro_gridded(
+    const AtmPoint& atm_point,
+    const Vector& f_grid_,
+    const Vector& za_inc_grid,
+    const Vector& delta_aa_grid,
+    std::shared_ptr<ZenithAngleGrid> za_scat_grid_) const {
+  check_prepared(f_grid_);
+
+  auto bsp_tro = bulk_scattering_properties<stokes_dim>(atm_point);
+  return bsp_tro.to_lab_frame(std::make_shared<Vector>(za_inc_grid),
+                              std::make_shared<Vector>(delta_aa_grid),
+                              za_scat_grid_);
+}
+
+template <Index stokes_dim>
+BulkScatteringProperties<Format::ARO, Representation::Spectral, stokes_dim>
+ScatteringHabit::get_bulk_scattering_properties_aro_spectral(
+    const AtmPoint& atm_point,
+    const Vector& f_grid_,
+    const Vector& za_inc_grid,
+    Index degree,
+    Index order) const {
+  check_prepared(f_grid_);
+
+  auto sht_ptr = sht::provider.get_instance(degree, order);
+  auto aa_scat_grid_ptr = sht_ptr->get_aa_grid_ptr();
+  auto za_scat_grid_ptr =
+      std::make_shared<ZenithAngleGrid>(sht_ptr->get_zenith_angle_grid());
+  auto bsp_tro = bulk_scattering_properties<stokes_dim>(atm_point);
+  auto bsp_aro = bsp_tro.to_lab_frame(
+      std::make_shared<Vector>(za_inc_grid), aa_scat_grid_ptr, za_scat_grid_ptr);
+  return bsp_aro.to_spectral(degree, order);
+}
+
+std::ostream& operator<<(std::ostream& os, const ScatteringHabit& habit) {
+  os << "ScatteringHabit(" << habit.particle_habit.size() << " particles";
+  if (habit.is_prepared()) {
+    os << ", prepared for " << habit.prepared->t_grid->size()
+       << " temperatures, " << habit.prepared->f_grid->size()
+       << " frequencies and " << grid_size(*habit.prepared->za_scat_grid)
+       << " scattering angles";
+  }
+  return os << ")";
+}
+
+#define INSTANTIATE_SCATTERING_HABIT(STOKES_DIM)                            \
+  template BulkScatteringProperties<Format::TRO,                            \
+                                    Representation::Gridded,                \
+                                    STOKES_DIM>                             \
+  ScatteringHabit::get_bulk_scattering_properties_tro_gridded<STOKES_DIM>(  \
+      const AtmPoint&, const Vector&, std::shared_ptr<ZenithAngleGrid>)     \
+      const;                                                                \
+  template BulkScatteringProperties<Format::TRO,                            \
+                                    Representation::Spectral,               \
+                                    STOKES_DIM>                             \
+  ScatteringHabit::get_bulk_scattering_properties_tro_spectral<STOKES_DIM>( \
+      const AtmPoint&, const Vector&, Index) const;                         \
+  template BulkScatteringProperties<Format::ARO,                            \
+                                    Representation::Gridded,                \
+                                    STOKES_DIM>                             \
+  ScatteringHabit::get_bulk_scattering_properties_aro_gridded<STOKES_DIM>(  \
+      const AtmPoint&,                                                      \
+      const Vector&,                                                        \
+      const Vector&,                                                        \
+      const Vector&,                                                        \
+      std::shared_ptr<ZenithAngleGrid>) const;                              \
+  template BulkScatteringProperties<Format::ARO,                            \
+                                    Representation::Spectral,               \
+                                    STOKES_DIM>                             \
+  ScatteringHabit::get_bulk_scattering_properties_aro_spectral<STOKES_DIM>( \
+      const AtmPoint&, const Vector&, const Vector&, Index, Index) const;
+
+INSTANTIATE_SCATTERING_HABIT(1)
+INSTANTIATE_SCATTERING_HABIT(2)
+INSTANTIATE_SCATTERING_HABIT(3)
+INSTANTIATE_SCATTERING_HABIT(4)
+
+#undef INSTANTIATE_SCATTERING_HABIT
+}  // namespace scattering
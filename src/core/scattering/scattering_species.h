@@ -8,7 +8,9 @@
 #include <cmath>
 #include <format>
 #include <iostream>
+#include <memory>
 #include <variant>
+#include <vector>
 
 #include "properties.h"
 #include "bulk_scattering_properties.h"
@@ -21,24 +23,140 @@ namespace scattering {
 using PSD = std::variant<MGDSingleMoment>;
 
 
+/** The simulation grids that scattering data is prepared for
+ *
+ * Scattering species that hold tabulated single scattering data regrid it
+ * onto these grids once, so that bulk properties can later be computed
+ * without any interpolation in frequency or scattering angle.
+ */
+struct ScatteringDataSpec {
+  std::shared_ptr<const Vector> t_grid;
+  std::shared_ptr<const Vector> f_grid;
+  std::shared_ptr<const ZenithAngleGrid> za_scat_grid;
+};
+
 /*** A scattering habit
  *
  * A scattering habit combines a particle habit with an additional PSD
  * and thus defines a mapping between atmospheric scattering species properties
  * and corresponding bulk skattering properties.
+ *
+ * The particle data must be gridded and of totally random orientation.  It
+ * is regridded onto the simulation grids by prepare_scattering_data, after
+ * which the bulk properties at an atmospheric point are the PSD-weighted sum
+ * over the particles, interpolated linearly in temperature.
  */
 class ScatteringHabit {
  public:
-  ScatteringHabit(){};
+  ScatteringHabit() = default;
+
+  /** Create a scattering habit
+   *
+   * @param particle_habit_ The particles of the habit
+   * @param psd_ The particle size distribution
+   * @param size_parameter_ The size that the PSD is defined over, either
+   * ParticulateProperty::DVeq or ParticulateProperty::DMax
+   */
+  ScatteringHabit(ParticleHabit particle_habit_,
+                  PSD psd_,
+                  ParticulateProperty size_parameter_ = ParticulateProperty::DVeq);
+
+  /** Regrid the particle data onto the simulation grids
+   *
+   * Frequencies must be inside the frequency range of all particles.
+   * Temperatures and scattering angles outside the data of a particle use the
+   * data at the closest edge.
+   *
+   * @param spec The simulation grids
+   */
+  void prepare_scattering_data(const ScatteringDataSpec& spec);
+
+  //! Whether prepare_scattering_data has been called
+  bool is_prepared() const { return prepared != nullptr; }
+
+  //! The particle number density of each particle, sorted by size [m^-3]
+  Vector particle_number_density(const AtmPoint& atm_point) const;
+
+  template <Index stokes_dim>
+  BulkScatteringProperties<Format::TRO, Representation::Gridded, stokes_dim>
+  get_bulk_scattering_properties_tro_gridded(
+      const AtmPoint& atm_point,
+      const Vector& f_grid,
+      std::shared_ptr<ZenithAngleGrid> za_scat_grid) const;
+
+  template <Index stokes_dim>
+  BulkScatteringProperties<Format::TRO, Representation::Spectral, stokes_dim>
+  get_bulk_scattering_properties_tro_spectral(const AtmPoint& atm_point,
+                                              const Vector& f_grid,
+                                              Index degree) const;
+
+  template <Index stokes_dim>
+  BulkScatteringProperties<Format::ARO, Representation::Gridded, stokes_dim>
+  get_bulk_scattering_properties_aro_gridded(
+      const AtmPoint& atm_point,
+      const Vector& f_grid,
+      const Vector& za_inc_grid,
+      const Vector& delta_aa_grid,
+      std::shared_ptr<ZenithAngleGrid> za_scat_grid) const;
+
+  template <Index stokes_dim>
+  BulkScatteringProperties<Format::ARO, Representation::Spectral, stokes_dim>
+  get_bulk_scattering_properties_aro_spectral(const AtmPoint& atm_point,
+                                              const Vector& f_grid,
+                                              const Vector& za_inc_grid,
+                                              Index degree,
+                                              Index order) const;
+
+  friend std::ostream& operator<<(std::ostream& os,
+                                  const ScatteringHabit& habit);
 
  private:
+  template <Format format, Representation repr, Index stokes_dim>
+  void prepare(
+      const std::vector<SingleScatteringData<Numeric, format, repr, stokes_dim>>&
+          data,
+      const ScatteringDataSpec& spec);
+
+  void check_prepared(const Vector& f_grid_) const;
+
+  template <Index stokes_dim>
+  BulkScatteringProperties<Format::TRO, Representation::Gridded, stokes_dim>
+  bulk_scattering_properties(const AtmPoint& atm_point) const;
+
   ParticleHabit particle_habit;
   PSD psd;
-};
+  ParticulateProperty size_parameter{ParticulateProperty::DVeq};
 
-struct ScatteringDataSpec {};
+  //! The particle data prepared for the simulation grids
+  struct PreparedData {
+    //! The particle sizes in increasing order, and their quadrature weights
+    Vector sizes;
+    Vector size_weights;
 
-using Species = std::variant<HenyeyGreensteinScatterer>;
+    //! The mass-size relationship of the particles, mass = a * size^b
+    Numeric mass_size_a;
+    Numeric mass_size_b;
+
+    std::shared_ptr<const Vector> t_grid;
+    std::shared_ptr<const Vector> f_grid;
+    std::shared_ptr<const ZenithAngleGrid> za_scat_grid;
+
+    //! The regridded data as [temperature, particle, (frequency, angle, stokes)]
+    Tensor3 phase_matrix_data;
+    Tensor3 extinction_matrix_data;
+    Tensor3 absorption_vector_data;
+
+    //! The number of stokes coefficients of the particle data
+    Index n_phase_matrix_coeffs;
+    Index n_extinction_matrix_coeffs;
+    Index n_absorption_vector_coeffs;
+  };
+
+  //! Shared by copies of the habit, it is replaced but never modified
+  std::shared_ptr<const PreparedData> prepared;
+};
+
+using Species = std::variant<HenyeyGreensteinScatterer, ScatteringHabit>;
 
 }  // namespace scattering
 
@@ -58,7 +176,21 @@ class ArrayOfScatteringSpecies : std::vector<scattering::Species> {
  public:
 
   void add(const scattering::Species& species) { push_back(species); }
-  void prepare_scattering_data(scattering::ScatteringDataSpec) {}
+
+  /** Prepare the scattering data of all species for the simulation grids
+   *
+   * @param spec The simulation grids
+   */
+  void prepare_scattering_data(const scattering::ScatteringDataSpec& spec) {
+    for (auto& species : *this) {
+      std::visit(
+          [&spec](auto& s) {
+            if constexpr (requires { s.prepare_scattering_data(spec); })
+              s.prepare_scattering_data(spec);
+          },
+          species);
+    }
+  }
 
   template <Index stokes_dim>
   BulkScatteringProperties<scattering::Format::TRO, scattering::Representation::Gridded, stokes_dim>
@@ -70,7 +202,7 @@ class ArrayOfScatteringSpecies : std::vector<scattering::Species> {
     auto bsp = std::visit([&](const auto& spec) {return spec.template get_bulk_scattering_properties_tro_gridded<stokes_dim>(atm_point, f_grid, za_scat_grid);},
                           scat_spec);
     for (Index ind = 1; ind < size(); ++ind) {
-      auto scat_spec = this->operator[](ind);
+      const auto& scat_spec = this->operator[](ind);
       bsp += std::visit([&](const auto& spec) {return spec.template get_bulk_scattering_properties_tro_gridded<stokes_dim>(atm_point, f_grid, za_scat_grid);},
                         scat_spec);
 
@@ -88,7 +220,7 @@ class ArrayOfScatteringSpecies : std::vector<scattering::Species> {
     auto bsp = std::visit([&](const auto& spec) {return spec.template get_bulk_scattering_properties_tro_spectral<stokes_dim>(atm_point, f_grid, degree);},
                           scat_spec);
     for (Index ind = 1; ind < size(); ++ind) {
-      auto scat_spec = this->operator[](ind);
+      const auto& scat_spec = this->operator[](ind);
       bsp += std::visit([&](const auto& spec) {return spec.template get_bulk_scattering_properties_tro_spectral<stokes_dim>(atm_point, f_grid, degree);},
                         scat_spec);
     }
@@ -107,7 +239,7 @@ class ArrayOfScatteringSpecies : std::vector<scattering::Species> {
     auto bsp = std::visit([&](const auto& spec) {return spec.template get_bulk_scattering_properties_aro_gridded<stokes_dim>(atm_point, f_grid, za_inc_grid, delta_aa_grid, za_scat_grid);},
                           scat_spec);
     for (Index ind = 1; ind < size(); ++ind) {
-      auto scat_spec = this->operator[](ind);
+      const auto& scat_spec = this->operator[](ind);
       bsp += std::visit([&](const auto& spec) {return spec.template get_bulk_scattering_properties_aro_gridded<stokes_dim>(atm_point, f_grid, za_inc_grid, delta_aa_grid, za_scat_grid);},
                         scat_spec);
     }
@@ -126,7 +258,7 @@ class ArrayOfScatteringSpecies : std::vector<scattering::Species> {
     auto bsp = std::visit([&](const auto& spec) {return spec.template get_bulk_scattering_properties_aro_spectral<stokes_dim>(atm_point, f_grid, za_inc_grid, degree, order);},
                           scat_spec);
     for (Index ind = 1; ind < size(); ++ind) {
-      auto scat_spec = this->operator[](ind);
+      const auto& scat_spec = this->operator[](ind);
       bsp += std::visit([&](const auto& spec) {return spec.template get_bulk_scattering_properties_aro_spectral<stokes_dim>(atm_point, f_grid, za_inc_grid, degree, order);},
                         scat_spec);
     }
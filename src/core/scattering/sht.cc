@@ -18,7 +18,8 @@ ComplexVector SHT::transform(const ConstMatrixView &view [[maybe_unused]]) {
   }
   set_spatial_coeffs(view);
   auto shtns = ShtnsHandle::get(l_max_, m_max_, n_aa_, n_za_);
-  spat_to_SH(shtns, spatial_coeffs_, spectral_coeffs_);
+  auto &buf  = buffers();
+  spat_to_SH(shtns, buf.spatial_coeffs, buf.spectral_coeffs);
   return static_cast<ComplexVector>(get_spectral_coeffs());
 #endif
 }
@@ -35,11 +36,72 @@ ComplexVector SHT::transform_cmplx(const ConstComplexMatrixView &view
   }
   set_spatial_coeffs(view);
   auto shtns = ShtnsHandle::get(l_max_, m_max_, n_aa_, n_za_);
-  spat_cplx_to_SH(shtns, spatial_coeffs_cmplx_, spectral_coeffs_cmplx_);
+  auto &buf  = buffers();
+  spat_cplx_to_SH(shtns, buf.spatial_coeffs_cmplx, buf.spectral_coeffs_cmplx);
   return static_cast<ComplexVector>(get_spectral_coeffs_cmplx());
 #endif
 }
 
+void SHT::transform(ComplexMatrixView spectral [[maybe_unused]],
+                    const ConstTensor3View &spatial [[maybe_unused]]) {
+#ifdef ARTS_NO_SHTNS
+  ARTS_USER_ERROR("Not compiled with SHTNS or FFTW support.");
+#else
+  const Index n = spatial.npages();
+  ARTS_USER_ERROR_IF(spectral.nrows() != n or
+                         spectral.ncols() != n_spectral_coeffs_ or
+                         spatial.nrows() != n_aa_ or spatial.ncols() != n_za_,
+                     "Bad shapes for batched transform: {:B,} -> {:B,}",
+                     spatial.shape(),
+                     spectral.shape())
+
+  if (is_trivial_) {
+    for (Index i = 0; i < n; ++i) spectral(i, 0) = spatial(i, 0, 0);
+    return;
+  }
+
+  auto shtns = ShtnsHandle::get(l_max_, m_max_, n_aa_, n_za_);
+
+#pragma omp parallel for
+  for (Index i = 0; i < n; ++i) {
+    auto &buf = buffers();
+    set_spatial_coeffs(spatial[i]);
+    spat_to_SH(shtns, buf.spatial_coeffs, buf.spectral_coeffs);
+    spectral[i] = get_spectral_coeffs();
+  }
+#endif
+}
+
+void SHT::synthesize(Tensor3View spatial [[maybe_unused]],
+                     const ConstComplexMatrixView &spectral [[maybe_unused]]) {
+#ifdef ARTS_NO_SHTNS
+  ARTS_USER_ERROR("Not compiled with SHTNS or FFTW support.");
+#else
+  const Index n = spectral.nrows();
+  ARTS_USER_ERROR_IF(spatial.npages() != n or
+                         spectral.ncols() != n_spectral_coeffs_ or
+                         spatial.nrows() != n_aa_ or spatial.ncols() != n_za_,
+                     "Bad shapes for batched synthesis: {:B,} -> {:B,}",
+                     spectral.shape(),
+                     spatial.shape())
+
+  if (is_trivial_) {
+    for (Index i = 0; i < n; ++i) spatial(i, 0, 0) = spectral(i, 0).real();
+    return;
+  }
+
+  auto shtns = ShtnsHandle::get(l_max_, m_max_, n_aa_, n_za_);
+
+#pragma omp parallel for
+  for (Index i = 0; i < n; ++i) {
+    auto &buf = buffers();
+    set_spectral_coeffs(spectral[i]);
+    SH_to_spat(shtns, buf.spectral_coeffs, buf.spatial_coeffs);
+    spatial[i] = get_spatial_coeffs();
+  }
+#endif
+}
+
 Matrix SHT::synthesize(const ConstComplexVectorView &view [[maybe_unused]]) {
 #ifdef ARTS_NO_SHTNS
   ARTS_USER_ERROR("Not compiled with SHTNS or FFTW support.");
@@ -51,7 +113,8 @@ Matrix SHT::synthesize(const ConstComplexVectorView &view [[maybe_unused]]) {
   }
   set_spectral_coeffs(view);
   auto shtns = ShtnsHandle::get(l_max_, m_max_, n_aa_, n_za_);
-  SH_to_spat(shtns, spectral_coeffs_, spatial_coeffs_);
+  auto &buf  = buffers();
+  SH_to_spat(shtns, buf.spectral_coeffs, buf.spatial_coeffs);
   return static_cast<Matrix>(get_spatial_coeffs());
 #endif
 }
@@ -68,7 +131,8 @@ ComplexMatrix SHT::synthesize_cmplx(const ConstComplexVectorView &view
   }
   set_spectral_coeffs_cmplx(view);
   auto shtns = ShtnsHandle::get(l_max_, m_max_, n_aa_, n_za_);
-  SH_to_spat_cplx(shtns, spectral_coeffs_cmplx_, spatial_coeffs_cmplx_);
+  auto &buf  = buffers();
+  SH_to_spat_cplx(shtns, buf.spectral_coeffs_cmplx, buf.spatial_coeffs_cmplx);
   return static_cast<ComplexMatrix>(get_spatial_coeffs_cmplx());
 #endif
 }
@@ -84,7 +148,7 @@ Numeric SHT::evaluate(const ConstComplexVectorView &view [[maybe_unused]],
   }
   set_spectral_coeffs(view);
   auto shtns = ShtnsHandle::get(l_max_, m_max_, n_aa_, n_za_);
-  return SH_to_point(shtns, spectral_coeffs_, cos(theta), phi);
+  return SH_to_point(shtns, buffers().spectral_coeffs, cos(theta), phi);
 #endif
 }
 
@@ -102,9 +166,10 @@ Vector SHT::evaluate(const ComplexVectorView &view [[maybe_unused]],
   auto n_points = points.nrows();
   Vector result(n_points);
   auto shtns = ShtnsHandle::get(l_max_, m_max_, n_aa_, n_za_);
+  auto &buf  = buffers();
   for (auto i = 0; i < n_points; ++i) {
-    result[i] =
-        SH_to_point(shtns, spectral_coeffs_, cos(points(i, 1)), points(i, 0));
+    result[i] = SH_to_point(
+        shtns, buf.spectral_coeffs, cos(points(i, 1)), points(i, 0));
   }
   return result;
 #endif
@@ -127,8 +192,9 @@ Vector SHT::evaluate(const ConstComplexVectorView &view [[maybe_unused]],
   auto n_points = thetas.size();
   Vector result(n_points);
   auto shtns = ShtnsHandle::get(l_max_, m_max_, n_aa_, n_za_);
+  auto &buf  = buffers();
   for (auto i = 0; i < n_points; ++i) {
-    result[i] = SH_to_point(shtns, spectral_coeffs_, cos(thetas[i]), 0.0);
+    result[i] = SH_to_point(shtns, buf.spectral_coeffs, cos(thetas[i]), 0.0);
   }
   return result;
 #endif
@@ -169,25 +235,33 @@ shtns_cfg ShtnsHandle::get(Index l_max [[maybe_unused]],
 #ifdef ARTS_NO_SHTNS
   ARTS_USER_ERROR("Not compiled with SHTNS or FFTW support.");
 #else
-  std::array<Index, 4> config = {l_max, m_max, n_aa, n_za};
-  if (config == current_config_) {
-    return shtns_;
-  } else {
-    shtns_reset();
-    shtns_          = shtns_init(sht_reg_fast,
-                        static_cast<int>(l_max),
-                        static_cast<int>(m_max),
-                        1,
-                        static_cast<int>(n_za),
-                        static_cast<int>(n_aa));
-    current_config_ = config;
+  const std::array<Index, 4> config = {l_max, m_max, n_aa, n_za};
+
+  //! The last configuration used by this thread, looked up without locking
+  thread_local std::array<Index, 4> last_config{-1, -1, -1, -1};
+  thread_local shtns_cfg last_shtns = nullptr;
+  if (config == last_config) return last_shtns;
+
+  //! shtns initialization is not thread safe, it is done once per configuration
+  std::lock_guard lock(mutex_);
+  shtns_cfg &shtns = configs_[config];
+  if (shtns == nullptr) {
+    shtns = shtns_init(sht_reg_fast,
+                       static_cast<int>(l_max),
+                       static_cast<int>(m_max),
+                       1,
+                       static_cast<int>(n_za),
+                       static_cast<int>(n_aa));
   }
-  return shtns_;
+
+  last_config = config;
+  last_shtns  = shtns;
+  return shtns;
 #endif
 }
 
-shtns_cfg ShtnsHandle::shtns_                     = nullptr;
-std::array<Index, 4> ShtnsHandle::current_config_ = {-1, -1, -1, -1};
+std::mutex ShtnsHandle::mutex_{};
+std::map<std::array<Index, 4>, shtns_cfg> ShtnsHandle::configs_{};
 
 ////////////////////////////////////////////////////////////////////////////////
 // SHT
@@ -208,19 +282,28 @@ SHT::SHT(Index l_max, Index m_max, Index n_aa, Index n_za)
     shtns_use_threads(0);
     n_spectral_coeffs_       = calc_n_spectral_coeffs(l_max, m_max);
     n_spectral_coeffs_cmplx_ = calc_n_spectral_coeffs_cmplx(l_max, m_max);
-    spectral_coeffs_ =
-        sht::FFTWArray<std::complex<double> >(n_spectral_coeffs_);
-    spectral_coeffs_cmplx_ =
-        sht::FFTWArray<std::complex<double> >(n_spectral_coeffs_cmplx_);
-    spatial_coeffs_ = sht::FFTWArray<double>(n_aa * n_za);
-    spatial_coeffs_cmplx_ =
-        sht::FFTWArray<std::complex<double> >(n_aa * n_za);
     za_grid_ = std::make_shared<ZenithAngleGrid>(get_zenith_angle_grid());
     aa_grid_ = std::make_shared<Vector>(get_azimuth_angle_grid());
   }
 #endif
 }
 
+SHT::Buffers &SHT::buffers() const {
+  thread_local std::map<std::array<Index, 4>, Buffers> thread_buffers;
+
+  auto [ptr, inserted] =
+      thread_buffers.try_emplace({l_max_, m_max_, n_aa_, n_za_});
+  if (inserted and not is_trivial_) {
+    auto &buf                = ptr->second;
+    buf.spectral_coeffs      = FFTWArray<std::complex<double>>(n_spectral_coeffs_);
+    buf.spectral_coeffs_cmplx =
+        FFTWArray<std::complex<double>>(n_spectral_coeffs_cmplx_);
+    buf.spatial_coeffs       = FFTWArray<double>(n_aa_ * n_za_);
+    buf.spatial_coeffs_cmplx = FFTWArray<std::complex<double>>(n_aa_ * n_za_);
+  }
+  return ptr->second;
+}
+
 SHT::SHT(Index l_max, Index m_max)
     : SHT(l_max,
           m_max,
@@ -41,7 +41,9 @@
 #include <iostream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <numbers>
+#include <shared_mutex>
 
 typedef struct shtns_info *shtns_cfg;
 
@@ -67,13 +69,20 @@ class FFTWArray {
   std::shared_ptr<Numeric> ptr_ = nullptr;
 };
 
+/** Cache of shtns configurations
+ *
+ * Each configuration is initialized once and kept for the lifetime of the
+ * program, so that transforms with different configurations may run
+ * concurrently.  Lookups of the configuration last used by a thread do not
+ * lock.
+ */
 class ShtnsHandle {
  public:
   static shtns_cfg get(Index l_max, Index m_max, Index n_aa, Index n_za);
 
  private:
-  static std::array<Index, 4> current_config_;
-  static shtns_cfg shtns_;
+  static std::mutex mutex_;
+  static std::map<std::array<Index, 4>, shtns_cfg> configs_;
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -97,12 +106,10 @@ class ShtnsHandle {
  * - n_za: The number of points in the zenith-angle grid. Must satisfy
  *     n_za > 2 * l_max + 1
  *
- * Note that the underlying shtns library only support one active configuration
- * at a time. Performing transforms with to distinct SHT objects therefore requires
- * reinitialization of shtns. Efficient use of the interface should therefore try
- * to minimize switching between different SHT configurations.
- *
- * NOTE: This interface is not thread safe.
+ * The shtns configurations are shared between all SHT objects of the same
+ * configuration and the coefficient arrays used for the transforms are
+ * allocated once per thread and configuration.  Transforms may therefore be
+ * performed concurrently from multiple threads.
  */
 class SHT {
  public:
@@ -317,13 +324,14 @@ class SHT {
       const matpack::matpack_view<T, 2, true, true> &view) const {
     ARTS_ASSERT(view.nrows() == n_aa_);
     ARTS_ASSERT(view.ncols() == n_za_);
+    auto &buf   = buffers();
     Index index = 0;
     for (int i = 0; i < view.nrows(); ++i) {
       for (int j = 0; j < view.ncols(); ++j) {
         if constexpr (matpack::complex_type<T>) {
-          spatial_coeffs_cmplx_[index] = view(i, j);
+          buf.spatial_coeffs_cmplx[index] = view(i, j);
         } else {
-          spatial_coeffs_[index] = view(i, j);
+          buf.spatial_coeffs[index] = view(i, j);
         }
         ++index;
       }
@@ -342,9 +350,10 @@ class SHT {
       const matpack::matpack_view<Complex, 1, true, true> &view) const {
     // Input size must match number of spectral coefficients of SHT.
     ARTS_ASSERT(view.size() == n_spectral_coeffs_);
+    auto &buf   = buffers();
     Index index = 0;
     for (auto &x : view) {
-      spectral_coeffs_[index] = x;
+      buf.spectral_coeffs[index] = x;
       ++index;
     }
   }
@@ -360,9 +369,10 @@ class SHT {
       const matpack::matpack_view<Complex, 1, true, true> &view) const {
     // Input size must match number of spectral coefficients of SHT.
     ARTS_ASSERT(view.size() == n_spectral_coeffs_cmplx_);
+    auto &buf   = buffers();
     Index index = 0;
     for (auto &x : view) {
-      spectral_coeffs_cmplx_[index] = x;
+      buf.spectral_coeffs_cmplx[index] = x;
       ++index;
     }
   }
@@ -376,7 +386,7 @@ class SHT {
    * angle).
    */
   ExhaustiveConstMatrixView get_spatial_coeffs() const {
-    return ExhaustiveConstMatrixView(spatial_coeffs_, {n_aa_, n_za_});
+    return ExhaustiveConstMatrixView(buffers().spatial_coeffs, {n_aa_, n_za_});
   }
 
   /**
@@ -388,7 +398,7 @@ class SHT {
    *
    */
   ExhaustiveConstComplexMatrixView get_spatial_coeffs_cmplx() const {
-    return ExhaustiveConstComplexMatrixView(spatial_coeffs_cmplx_,
+    return ExhaustiveConstComplexMatrixView(buffers().spatial_coeffs_cmplx,
                                             {n_aa_, n_za_});
   }
 
@@ -427,7 +437,7 @@ class SHT {
    * representing the data.
    */
   ExhaustiveConstComplexVectorView get_spectral_coeffs() const {
-    return ExhaustiveConstComplexVectorView(spectral_coeffs_,
+    return ExhaustiveConstComplexVectorView(buffers().spectral_coeffs,
                                             {n_spectral_coeffs_});
   }
 
@@ -439,7 +449,7 @@ class SHT {
    * representing the data.
    */
   ExhaustiveConstComplexVectorView get_spectral_coeffs_cmplx() const {
-    return ExhaustiveConstComplexVectorView(spectral_coeffs_cmplx_,
+    return ExhaustiveConstComplexVectorView(buffers().spectral_coeffs_cmplx,
                                             {n_spectral_coeffs_cmplx_});
   }
 
@@ -460,6 +470,16 @@ class SHT {
    */
   ComplexVector transform_cmplx(const ConstComplexMatrixView &view);
 
+  /** Apply forward SHT Transform to a batch of fields
+   *
+   * The fields are transformed in parallel over the available threads.
+   *
+   * @param[out] spectral Row i holds the spherical harmonics coefficients of field i.
+   * @param[in] spatial Page i holds field i. Row indices should correspond to
+   * azimuth angles and columns to zenith angles.
+   */
+  void transform(ComplexMatrixView spectral, const ConstTensor3View &spatial);
+
   /** Apply inverse SHT Transform
    *
    * Transforms discrete spherical data given in spherical harmonics
@@ -482,6 +502,16 @@ class SHT {
    */
   ComplexMatrix synthesize_cmplx(const ConstComplexVectorView &view);
 
+  /** Apply inverse SHT Transform to a batch of fields
+   *
+   * The fields are synthesized in parallel over the available threads.
+   *
+   * @param[out] spatial Page i holds field i. Row indices correspond to
+   * azimuth angles and columns to zenith angles.
+   * @param[in] spectral Row i holds the spherical harmonics coefficients of field i.
+   */
+  void synthesize(Tensor3View spatial, const ConstComplexMatrixView &spectral);
+
   /** Evaluate spectral representation at given point.
    *
    * @param view Spectral coefficient vector containing the SH coefficients.
@@ -533,20 +563,31 @@ class SHT {
       const matpack::matpack_view<T, 2, constant_2, strided_2> &w);
 
  private:
+  //! The coefficient arrays that are passed to shtns
+  struct Buffers {
+    sht::FFTWArray<std::complex<double>> spectral_coeffs, spectral_coeffs_cmplx,
+        spatial_coeffs_cmplx;
+    sht::FFTWArray<double> spatial_coeffs;
+  };
+
+  /** The coefficient arrays of the calling thread for this configuration
+   *
+   * Allocated on first use by each thread.
+   */
+  Buffers &buffers() const;
+
   bool is_trivial_;
   Index l_max_, m_max_, n_aa_, n_za_, n_spectral_coeffs_,
       n_spectral_coeffs_cmplx_;
 
-  sht::FFTWArray<std::complex<double>> spectral_coeffs_, spectral_coeffs_cmplx_,
-      spatial_coeffs_cmplx_;
-  sht::FFTWArray<double> spatial_coeffs_;
   std::shared_ptr<Vector> aa_grid_;
   std::shared_ptr<ZenithAngleGrid> za_grid_;
 };
 
 /** SHT instance provider.
  *
- * Simple cache for SHT instances.
+ * Thread-safe cache for SHT instances.  Lookups of existing instances share a
+ * read lock, and each instance is constructed exactly once.
  */
 class SHTProvider {
  public:
@@ -561,11 +602,19 @@ class SHTProvider {
    * @return shared pointer to SHT instance.
    */
   std::shared_ptr<SHT> get_instance(SHTParams params) {
-    if (sht_instances_.count(params) == 0) {
-      sht_instances_[params] =
-          std::make_shared<SHT>(params[0], params[1], params[2], params[3]);
+    {
+      std::shared_lock lock(mutex_);
+      if (auto ptr = sht_instances_.find(params); ptr != sht_instances_.end()) {
+        return ptr->second;
+      }
+    }
+
+    std::unique_lock lock(mutex_);
+    auto &ptr = sht_instances_[params];
+    if (not ptr) {
+      ptr = std::make_shared<SHT>(params[0], params[1], params[2], params[3]);
     }
-    return sht_instances_[params];
+    return ptr;
   }
 
   std::shared_ptr<SHT> get_instance(Index n_aa, Index n_za) {
@@ -577,6 +626,7 @@ class SHTProvider {
   }
 
  protected:
+  std::shared_mutex mutex_;
   std::map<SHTParams, std::shared_ptr<SHT>> sht_instances_;
 };
 
@@ -8,17 +8,32 @@
 
 #include "tmatrix.h"
 
+#include <algorithm>
+#include <cerrno>
 #include <cmath>
+#include <cstdint>
 #include <cstring>
+#include <functional>
 #include <iostream>
+#include <span>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 #include "arts_constants.h"
+#include "arts_omp.h"
+#include "debug.h"
 #include "math_funcs.h"
 #include "matpack_complex.h"
 #include "matpack_data.h"
 #include "optproperties.h"
 
+#ifndef _WIN32
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 void calc_phamat(Matrix& z,
                  const Index& nmax,
                  const Numeric& lam,
@@ -962,6 +977,193 @@ void tmatrix_fixed_orientation(Numeric& cext,
   }
 }
 
+namespace {
+//! A failed computation of a frequency and temperature combination
+struct tmatrix_failure {
+  Index f_index;
+  Index T_index;
+  String message;
+};
+
+//! The flat data of a tensor
+template <typename T>
+auto flat(T& x) {
+  return std::span{x.data_handle(), static_cast<std::size_t>(x.size())};
+}
+
+#ifndef _WIN32
+void write_all(int fd, const void* data, std::size_t n) {
+  const char* ptr = static_cast<const char*>(data);
+  while (n > 0) {
+    const ssize_t k = ::write(fd, ptr, n);
+    if (k < 0) {
+      if (errno == EINTR) continue;
+      ::_exit(EXIT_FAILURE);
+    }
+    ptr += k;
+    n   -= static_cast<std::size_t>(k);
+  }
+}
+
+bool read_all(int fd, void* data, std::size_t n) {
+  char* ptr = static_cast<char*>(data);
+  while (n > 0) {
+    const ssize_t k = ::read(fd, ptr, n);
+    if (k < 0 and errno == EINTR) continue;
+    if (k <= 0) return false;
+    ptr += k;
+    n   -= static_cast<std::size_t>(k);
+  }
+  return true;
+}
+#endif
+
+/** Computes all frequency and temperature combinations
+
+ The Fortran T-Matrix code keeps its state in common blocks, so it must not
+ run in several threads at the same time.  With more than one process, the
+ combinations are instead shared by forked worker processes, each with its
+ own copy of the common blocks.  The workers run the same code as the serial
+ loop, so the results are identical.
+
+ The workers are only forked outside of OpenMP parallel regions, and never
+ start parallel regions of their own, as libgomp does not survive a fork
+ with active teams.  Workers leave by _exit so that no parent state is
+ destroyed twice.
+
+ \param[in] nf         Number of frequencies
+ \param[in] nT         Number of temperatures
+ \param[in,out] out    All data set by compute, the two outer dimensions of
+                       each must be frequency and temperature
+ \param[in] compute    Computes one combination, throws on failure
+ \param[in] processes  Maximum number of worker processes
+ \return The failed combinations, in frequency and temperature order
+*/
+std::vector<tmatrix_failure> tmatrix_compute_all(
+    const Index nf,
+    const Index nT,
+    const std::vector<std::span<Numeric>>& out,
+    const std::function<void(Index, Index)>& compute,
+    const Index processes) {
+  const Index n = nf * nT;
+
+  std::vector<tmatrix_failure> failures;
+
+  const auto serial = [&]() {
+    // The common blocks of the Fortran code are not threadsafe.
+#pragma omp critical(tmatrix_ssp)
+    for (Index i = 0; i < n; i++) {
+      try {
+        compute(i / nT, i % nT);
+      } catch (const std::runtime_error& e) {
+        failures.push_back({i / nT, i % nT, e.what()});
+      }
+    }
+  };
+
+  const Index nproc = std::min(processes, n);
+  if (nproc < 2 or arts_omp_in_parallel()) {
+    serial();
+    return failures;
+  }
+
+#ifdef _WIN32
+  serial();
+#else
+  std::vector<std::size_t> slice(out.size());
+  for (Size k = 0; k < out.size(); k++) slice[k] = out[k].size() / n;
+
+  std::vector<pid_t> pids(nproc, -1);
+  std::vector<int> fds(nproc, -1);
+  for (Index w = 0; w < nproc; w++) {
+    int pipefd[2];
+    ARTS_USER_ERROR_IF(
+        ::pipe(pipefd) != 0, "Cannot create pipe: {}", std::strerror(errno))
+
+    const pid_t pid = ::fork();
+    ARTS_USER_ERROR_IF(pid < 0, "Cannot fork: {}", std::strerror(errno))
+
+    //! The worker computes its share before sending anything, so that all
+    //! workers compute at the same time
+    if (pid == 0) {
+      ::close(pipefd[0]);
+      for (Index j = 0; j < w; j++) ::close(fds[j]);
+
+      std::vector<String> messages;
+      for (Index i = w; i < n; i += nproc) {
+        try {
+          compute(i / nT, i % nT);
+          messages.emplace_back();
+        } catch (const std::exception& e) {
+          messages.emplace_back(e.what());
+          if (messages.back().empty()) messages.back() = "Unknown error";
+        }
+      }
+
+      Size j = 0;
+      for (Index i = w; i < n; i += nproc, j++) {
+        const std::int64_t len = messages[j].size();
+        write_all(pipefd[1], &len, sizeof(len));
+        if (len) {
+          write_all(pipefd[1], messages[j].data(), messages[j].size());
+        } else {
+          for (Size k = 0; k < out.size(); k++) {
+            write_all(pipefd[1],
+                      out[k].data() + i * slice[k],
+                      sizeof(Numeric) * slice[k]);
+          }
+        }
+      }
+
+      ::close(pipefd[1]);
+      ::_exit(EXIT_SUCCESS);
+    }
+
+    ::close(pipefd[1]);
+    pids[w] = pid;
+    fds[w]  = pipefd[0];
+  }
+
+  String errors;
+  for (Index w = 0; w < nproc; w++) {
+    for (Index i = w; i < n; i += nproc) {
+      std::int64_t len = 0;
+      if (not read_all(fds[w], &len, sizeof(len))) {
+        errors += std::format("T-Matrix worker {} died without reporting\n", w);
+        break;
+      }
+
+      if (len) {
+        String msg(static_cast<std::size_t>(len), ' ');
+        read_all(fds[w], msg.data(), msg.size());
+        failures.push_back({i / nT, i % nT, msg});
+      } else {
+        for (Size k = 0; k < out.size(); k++) {
+          read_all(fds[w], out[k].data() + i * slice[k], sizeof(Numeric) * slice[k]);
+        }
+      }
+    }
+
+    ::close(fds[w]);
+  }
+
+  for (auto pid : pids) {
+    int wstatus = 0;
+    while (::waitpid(pid, &wstatus, 0) < 0 and errno == EINTR) {
+    }
+  }
+
+  ARTS_USER_ERROR_IF(not errors.empty(), "{}", errors)
+
+  std::ranges::sort(failures, {}, [](auto& x) {
+    return std::pair{x.f_index, x.T_index};
+  });
+#endif
+
+  return failures;
+}
+}  // namespace
+
 void calcSingleScatteringDataProperties(SingleScatteringData& ssd,
                                         ConstMatrixView ref_index_real,
                                         ConstMatrixView ref_index_imag,
@@ -971,7 +1173,8 @@ void calcSingleScatteringDataProperties(SingleScatteringData& ssd,
                                         const Numeric precision,
                                         const Index ndgs,
                                         const Index robust,
-                                        const Index quiet) {
+                                        const Index quiet,
+                                        const Index processes) {
   const Index nf = ssd.f_grid.nelem();
   const Index nT = ssd.T_grid.nelem();
 
@@ -1007,79 +1210,73 @@ void calcSingleScatteringDataProperties(SingleScatteringData& ssd,
       ssd.ext_mat_data = NAN;
       ssd.abs_vec_data = NAN;
 
-      // Output variables
-      Numeric cext = NAN;
-      Numeric csca = NAN;
-      Vector f11;
-      Vector f22;
-      Vector f33;
-      Vector f44;
-      Vector f12;
-      Vector f34;
-      Matrix mono_pha_mat_data(nza, 6, NAN);
+      const auto compute = [&](const Index f_index, const Index T_index) {
+        Numeric cext = NAN;
+        Numeric csca = NAN;
+        Vector f11;
+        Vector f22;
+        Vector f33;
+        Vector f44;
+        Vector f12;
+        Vector f34;
+        Matrix mono_pha_mat_data(nza, 6, NAN);
+
+        tmatrix_random_orientation(cext,
+                                   csca,
+                                   f11,
+                                   f22,
+                                   f33,
+                                   f44,
+                                   f12,
+                                   f34,
+                                   equiv_radius,
+                                   aspect_ratio,
+                                   np,
+                                   lam[f_index],
+                                   ref_index_real(f_index, T_index),
+                                   ref_index_imag(f_index, T_index),
+                                   precision,
+                                   nza,
+                                   ndgs,
+                                   quiet);
+
+        mono_pha_mat_data(joker, 0) = f11;
+        mono_pha_mat_data(joker, 1) = f12;
+        mono_pha_mat_data(joker, 2) = f22;
+        mono_pha_mat_data(joker, 3) = f33;
+        mono_pha_mat_data(joker, 4) = f34;
+        mono_pha_mat_data(joker, 5) = f44;
+
+        mono_pha_mat_data *= csca / 4. / PI;
+        ssd.pha_mat_data(f_index, T_index, joker, 0, 0, 0, joker) =
+            mono_pha_mat_data;
+
+        ssd.ext_mat_data(f_index, T_index, 0, 0, 0) = cext;
+        ssd.abs_vec_data(f_index, T_index, 0, 0, 0) = cext - csca;
+      };
+
+      const auto failures = tmatrix_compute_all(
+          nf,
+          nT,
+          {flat(ssd.pha_mat_data), flat(ssd.ext_mat_data), flat(ssd.abs_vec_data)},
+          compute,
+          processes);
 
       std::ostringstream os;
       os << "Calculation of SingleScatteringData properties failed for\n\n";
-      bool anyfailed = false;
-#pragma omp critical(tmatrix_ssp)
-      for (Index f_index = 0; f_index < nf; ++f_index)
-        for (Index T_index = 0; T_index < nT; ++T_index) {
-          bool thisfailed = false;
-          try {
-            tmatrix_random_orientation(cext,
-                                       csca,
-                                       f11,
-                                       f22,
-                                       f33,
-                                       f44,
-                                       f12,
-                                       f34,
-                                       equiv_radius,
-                                       aspect_ratio,
-                                       np,
-                                       lam[f_index],
-                                       ref_index_real(f_index, T_index),
-                                       ref_index_imag(f_index, T_index),
-                                       precision,
-                                       nza,
-                                       ndgs,
-                                       quiet);
-          } catch (const std::runtime_error& e) {
-            //ostringstream os;
-            //os << "Calculation of SingleScatteringData properties failed for\n"
-            os << "f_grid[" << f_index << "] = " << ssd.f_grid[f_index] << "\n"
-               << "T_grid[" << T_index << "] = " << ssd.T_grid[T_index]
-               << "\n\n";
-            //<< e.what();
-            //throw std::runtime_error(os.str());
-            thisfailed = true;
-            anyfailed = true;
-            std::cout << "\n\n";
-          }
-
-          if (!thisfailed) {
-            mono_pha_mat_data(joker, 0) = f11;
-            mono_pha_mat_data(joker, 1) = f12;
-            mono_pha_mat_data(joker, 2) = f22;
-            mono_pha_mat_data(joker, 3) = f33;
-            mono_pha_mat_data(joker, 4) = f34;
-            mono_pha_mat_data(joker, 5) = f44;
-
-            mono_pha_mat_data *= csca / 4. / PI;
-            ssd.pha_mat_data(f_index, T_index, joker, 0, 0, 0, joker) =
-                mono_pha_mat_data;
+      for (auto& failure : failures) {
+        os << "f_grid[" << failure.f_index
+           << "] = " << ssd.f_grid[failure.f_index] << "\n"
+           << "T_grid[" << failure.T_index
+           << "] = " << ssd.T_grid[failure.T_index] << "\n\n";
+        std::cout << "\n\n";
+      }
 
-            ssd.ext_mat_data(f_index, T_index, 0, 0, 0) = cext;
-            ssd.abs_vec_data(f_index, T_index, 0, 0, 0) = cext - csca;
-          }
-        }
-      if (anyfailed)
+      if (failures.size()) {
         if (robust)
           std::cout << os.str();
         else
           throw std::runtime_error(os.str());
-      else {
-        os << "None\n";
       }
 
       break;
@@ -1096,171 +1293,177 @@ void calcSingleScatteringDataProperties(SingleScatteringData& ssd,
       ssd.pha_mat_data = NAN;
       ssd.abs_vec_data = NAN;
 
-      // Output variables
-      Numeric cext = NAN;
-      Numeric csca = NAN;
-      Index nmax = -1;
-
       Tensor5 csca_data(nf, nT, nza, 1, 2);
 
-#pragma omp critical(tmatrix_ssp)
-      for (Index f_index = 0; f_index < nf; ++f_index) {
+      const auto compute = [&](const Index f_index, const Index T_index) {
+        // Output variables
+        Numeric cext = NAN;
+        Numeric csca = NAN;
+        Index nmax = -1;
+
         const Numeric lam_f = lam[f_index];
 
-        for (Index T_index = 0; T_index < nT; ++T_index) {
-          try {
-            tmatrix_fixed_orientation(cext,
-                                      csca,
-                                      nmax,
-                                      equiv_radius,
-                                      aspect_ratio,
-                                      np,
-                                      lam_f,
-                                      ref_index_real(f_index, T_index),
-                                      ref_index_imag(f_index, T_index),
-                                      precision);
-          } catch (const std::runtime_error& e) {
-            std::ostringstream os;
-            os << "Calculation of SingleScatteringData properties failed for\n"
-               << "f_grid[" << f_index << "] = " << ssd.f_grid[f_index] << "\n"
-               << "T_grid[" << T_index << "] = " << ssd.T_grid[T_index] << "\n"
-               << e.what();
-            throw std::runtime_error(os.str());
-          }
+        try {
+          tmatrix_fixed_orientation(cext,
+                                    csca,
+                                    nmax,
+                                    equiv_radius,
+                                    aspect_ratio,
+                                    np,
+                                    lam_f,
+                                    ref_index_real(f_index, T_index),
+                                    ref_index_imag(f_index, T_index),
+                                    precision);
+        } catch (const std::runtime_error& e) {
+          std::ostringstream os;
+          os << "Calculation of SingleScatteringData properties failed for\n"
+             << "f_grid[" << f_index << "] = " << ssd.f_grid[f_index] << "\n"
+             << "T_grid[" << T_index << "] = " << ssd.T_grid[T_index] << "\n"
+             << e.what();
+          throw std::runtime_error(os.str());
+        }
 
-          Matrix phamat;
-          for (Index za_scat_index = 0; za_scat_index < nza; ++za_scat_index)
-            for (Index aa_index = 0; aa_index < naa; ++aa_index)
-              for (Index za_inc_index = 0; za_inc_index < nza; ++za_inc_index) {
-                if (aspect_ratio < 1.0) {
-                  // Phase matrix for prolate particles
-                  integrate_phamat_alpha10(phamat,
-                                           nmax,
-                                           lam_f,
-                                           ssd.za_grid[za_inc_index],
-                                           ssd.za_grid[za_scat_index],
-                                           0.0,
-                                           ssd.aa_grid[aa_index],
-                                           90.0,
-                                           0.0,
-                                           180.0);
-                  phamat /= 180.;
-                } else {
-                  // Phase matrix for oblate particles
-                  calc_phamat(phamat,
-                              nmax,
-                              lam_f,
-                              ssd.za_grid[za_inc_index],
-                              ssd.za_grid[za_scat_index],
-                              0.0,
-                              ssd.aa_grid[aa_index],
-                              0.0,
-                              0.0);
-                }
-
-                ssd.pha_mat_data(f_index,
-                                 T_index,
-                                 za_scat_index,
-                                 aa_index,
-                                 za_inc_index,
-                                 0,
-                                 Range(0, 4)) = phamat(0, joker);
-                ssd.pha_mat_data(f_index,
-                                 T_index,
-                                 za_scat_index,
-                                 aa_index,
-                                 za_inc_index,
-                                 0,
-                                 Range(4, 4)) = phamat(1, joker);
-                ssd.pha_mat_data(f_index,
-                                 T_index,
-                                 za_scat_index,
-                                 aa_index,
-                                 za_inc_index,
-                                 0,
-                                 Range(8, 4)) = phamat(2, joker);
-                ssd.pha_mat_data(f_index,
-                                 T_index,
-                                 za_scat_index,
-                                 aa_index,
-                                 za_inc_index,
-                                 0,
-                                 Range(12, 4)) = phamat(3, joker);
+        Matrix phamat;
+        for (Index za_scat_index = 0; za_scat_index < nza; ++za_scat_index)
+          for (Index aa_index = 0; aa_index < naa; ++aa_index)
+            for (Index za_inc_index = 0; za_inc_index < nza; ++za_inc_index) {
+              if (aspect_ratio < 1.0) {
+                // Phase matrix for prolate particles
+                integrate_phamat_alpha10(phamat,
+                                         nmax,
+                                         lam_f,
+                                         ssd.za_grid[za_inc_index],
+                                         ssd.za_grid[za_scat_index],
+                                         0.0,
+                                         ssd.aa_grid[aa_index],
+                                         90.0,
+                                         0.0,
+                                         180.0);
+                phamat /= 180.;
+              } else {
+                // Phase matrix for oblate particles
+                calc_phamat(phamat,
+                            nmax,
+                            lam_f,
+                            ssd.za_grid[za_inc_index],
+                            ssd.za_grid[za_scat_index],
+                            0.0,
+                            ssd.aa_grid[aa_index],
+                            0.0,
+                            0.0);
               }
 
-          // Csca integral
-          for (Index za_scat_index = 0; za_scat_index < nza; ++za_scat_index) {
-            Matrix csca_integral;
-            if (aspect_ratio < 1.0) {
-              // Csca for prolate particles
-              integrate_phamat_theta0_phi_alpha6(csca_integral,
-                                                 nmax,
-                                                 lam_f,
-                                                 0,
-                                                 180,
-                                                 ssd.za_grid[za_scat_index],
-                                                 0.,
-                                                 0.,
-                                                 180.,
-                                                 90.,
-                                                 0.,
-                                                 180.);
-              csca_integral /= 180.;
-            } else {
-              // Csca for oblate particles
-              integrate_phamat_theta0_phi10(csca_integral,
-                                            nmax,
-                                            lam_f,
-                                            0,
-                                            180,
-                                            ssd.za_grid[za_scat_index],
-                                            0.,
-                                            0.,
-                                            180,
-                                            0.,
-                                            0.);
+              ssd.pha_mat_data(f_index,
+                               T_index,
+                               za_scat_index,
+                               aa_index,
+                               za_inc_index,
+                               0,
+                               Range(0, 4)) = phamat(0, joker);
+              ssd.pha_mat_data(f_index,
+                               T_index,
+                               za_scat_index,
+                               aa_index,
+                               za_inc_index,
+                               0,
+                               Range(4, 4)) = phamat(1, joker);
+              ssd.pha_mat_data(f_index,
+                               T_index,
+                               za_scat_index,
+                               aa_index,
+                               za_inc_index,
+                               0,
+                               Range(8, 4)) = phamat(2, joker);
+              ssd.pha_mat_data(f_index,
+                               T_index,
+                               za_scat_index,
+                               aa_index,
+                               za_inc_index,
+                               0,
+                               Range(12, 4)) = phamat(3, joker);
             }
-            csca_data(f_index, T_index, za_scat_index, 0, joker) =
-                csca_integral(Range(0, 2), 0);
-          }
 
-          // Extinction matrix
+        // Csca integral
+        for (Index za_scat_index = 0; za_scat_index < nza; ++za_scat_index) {
+          Matrix csca_integral;
           if (aspect_ratio < 1.0) {
-            // Average T-Matrix for prolate particles
-            avgtmatrix_(nmax);
+            // Csca for prolate particles
+            integrate_phamat_theta0_phi_alpha6(csca_integral,
+                                               nmax,
+                                               lam_f,
+                                               0,
+                                               180,
+                                               ssd.za_grid[za_scat_index],
+                                               0.,
+                                               0.,
+                                               180.,
+                                               90.,
+                                               0.,
+                                               180.);
+            csca_integral /= 180.;
+          } else {
+            // Csca for oblate particles
+            integrate_phamat_theta0_phi10(csca_integral,
+                                          nmax,
+                                          lam_f,
+                                          0,
+                                          180,
+                                          ssd.za_grid[za_scat_index],
+                                          0.,
+                                          0.,
+                                          180,
+                                          0.,
+                                          0.);
           }
+          csca_data(f_index, T_index, za_scat_index, 0, joker) =
+              csca_integral(Range(0, 2), 0);
+        }
 
-          for (Index za_inc_index = 0; za_inc_index < nza; ++za_inc_index) {
-            Complex s11;
-            Complex s12;
-            Complex s21;
-            Complex s22;
-            VectorView K =
-                ssd.ext_mat_data(f_index, T_index, za_inc_index, 0, joker);
-
-            const Numeric beta = 0.;
-            const Numeric alpha = 0.;
-            ampl_(nmax,
-                  lam_f,
-                  ssd.za_grid[za_inc_index],
-                  ssd.za_grid[za_inc_index],
-                  0.,
-                  0.,
-                  alpha,
-                  beta,
-                  s11,
-                  s12,
-                  s21,
-                  s22);
-
-            K[0] = (Complex(0., -1.) * (s11 + s22)).real();
-            K[1] = (Complex(0., 1.) * (s22 - s11)).real();
-            K[2] = (s22 - s11).real();
+        // Extinction matrix
+        if (aspect_ratio < 1.0) {
+          // Average T-Matrix for prolate particles
+          avgtmatrix_(nmax);
+        }
 
-            K *= lam_f;
-          }
+        for (Index za_inc_index = 0; za_inc_index < nza; ++za_inc_index) {
+          Complex s11;
+          Complex s12;
+          Complex s21;
+          Complex s22;
+          VectorView K =
+              ssd.ext_mat_data(f_index, T_index, za_inc_index, 0, joker);
+
+          const Numeric beta = 0.;
+          const Numeric alpha = 0.;
+          ampl_(nmax,
+                lam_f,
+                ssd.za_grid[za_inc_index],
+                ssd.za_grid[za_inc_index],
+                0.,
+                0.,
+                alpha,
+                beta,
+                s11,
+                s12,
+                s21,
+                s22);
+
+          K[0] = (Complex(0., -1.) * (s11 + s22)).real();
+          K[1] = (Complex(0., 1.) * (s22 - s11)).real();
+          K[2] = (s22 - s11).real();
+
+          K *= lam_f;
         }
-      }
+      };
+
+      const auto failures = tmatrix_compute_all(
+          nf,
+          nT,
+          {flat(ssd.pha_mat_data), flat(ssd.ext_mat_data), flat(csca_data)},
+          compute,
+          processes);
+
+      if (failures.size()) throw std::runtime_error(failures.front().message);
 
       csca_data *= 2. * PI * PI / 32400.;
       ssd.abs_vec_data =
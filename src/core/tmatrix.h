@@ -30,6 +30,9 @@
  \param[in] precision       Accuracy of the computations
  \param[in] ndgs            The number of division points in computing
                             integrals over the particle surface.
+ \param[in] processes       Maximum number of forked worker processes.  The
+                            Fortran code is not threadsafe, so each worker
+                            has its own copy of its common blocks.
 
  \author Oliver Lemke
  */
@@ -42,7 +45,8 @@ void calcSingleScatteringDataProperties(SingleScatteringData& ssd,
                                         const Numeric precision = 0.001,
                                         const Index ndgs = 2,
                                         const Index robust = 0,
-                                        const Index quiet = 1);
+                                        const Index quiet = 1,
+                                        const Index processes = 1);
 
 /** T-Matrix validation test.
 
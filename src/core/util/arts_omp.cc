@@ -108,3 +108,19 @@ void arts_omp_set_dynamic(int i [[maybe_unused]])
   // Nothing to do here.
 #endif
 }
+
+//! Wrapper for omp_set_num_threads
+/*! 
+  This wrapper works with and without OMP support.
+
+  \param i Number of threads to use for subsequent parallel regions.
+*/
+void arts_omp_set_num_threads(int i [[maybe_unused]])
+{
+
+#ifdef _OPENMP
+  omp_set_num_threads(i);
+#else
+  // Nothing to do here.
+#endif
+}
@@ -33,4 +33,6 @@ void arts_omp_set_nested(int i);
 
 void arts_omp_set_dynamic(int i);
 
+void arts_omp_set_num_threads(int i);
+
 #endif  // arts_omp_h
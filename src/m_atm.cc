@@ -5,6 +5,7 @@
 #include <zconf.h>
 
 #include <algorithm>
+#include <array>
 #include <iomanip>
 #include <iterator>
 #include <memory>
@@ -491,48 +492,129 @@ void atmospheric_fieldAppendAbsorptionData(const Workspace &ws,
               [](const SpeciesEnum &x) { return String{toString<1>(x)}; });
 }
 
-void atmospheric_fieldIGRF(AtmField &atmospheric_field, const Time &time) {
+void atmospheric_fieldIGRF(AtmField &atmospheric_field,
+                           const Time &time,
+                           const AscendingGrid &alts,
+                           const AscendingGrid &lats,
+                           const AscendingGrid &lons) try {
   using IGRF::igrf;
 
   //! We need explicit planet-size as IGRF requires the radius
   //! This is the WGS84 version of that, with radius of equator and pole
   static constexpr Vector2 ell{6378137., 6356752.314245};
 
-  //! This struct deals with the computations, it's internally saving a mutable
-  //! state
+  if (alts.size() and lats.size() and lons.size()) {
+    const Index nalt = alts.size();
+    const Index nlat = lats.size();
+    const Index nlon = lons.size();
+
+    //! Longitude changes slowest so that its terms are shared by all points
+    //! of a column.  The geocentric latitude depends on the altitude, so the
+    //! Legendre recursion is redone for almost every point.
+    std::vector<Vector3> pos;
+    pos.reserve(nalt * nlat * nlon);
+    for (Index ilon = 0; ilon < nlon; ilon++) {
+      for (Index ilat = 0; ilat < nlat; ilat++) {
+        for (Index ialt = 0; ialt < nalt; ialt++) {
+          pos.push_back({alts[ialt], lats[ilat], lons[ilon]});
+        }
+      }
+    }
+
+    const std::vector<Vector3> mag = igrf(pos, ell, time);
+
+    std::array<GriddedField3, 3> fields;
+    for (Size k = 0; k < 3; k++) {
+      fields[k] = GriddedField3{
+          .data_name  = "Magnetic Field",
+          .data       = Tensor3(nalt, nlat, nlon),
+          .grid_names = {"Altitude", "Latitude", "Longitude"},
+          .grids      = {alts, lats, lons}};
+    }
+
+    Size i = 0;
+    for (Index ilon = 0; ilon < nlon; ilon++) {
+      for (Index ilat = 0; ilat < nlat; ilat++) {
+        for (Index ialt = 0; ialt < nalt; ialt++, i++) {
+          for (Size k = 0; k < 3; k++) {
+            fields[k].data(ialt, ilat, ilon) = mag[i][k];
+          }
+        }
+      }
+    }
+
+    const std::array keys{AtmKey::mag_u, AtmKey::mag_v, AtmKey::mag_w};
+    for (Size k = 0; k < 3; k++) {
+      auto &data   = atmospheric_field[keys[k]];
+      data         = std::move(fields[k]);
+      data.alt_low = InterpolationExtrapolation::Nearest;
+      data.alt_upp = InterpolationExtrapolation::Nearest;
+      data.lat_low = InterpolationExtrapolation::Nearest;
+      data.lat_upp = InterpolationExtrapolation::Nearest;
+      data.lon_low = InterpolationExtrapolation::Nearest;
+      data.lon_upp = InterpolationExtrapolation::Nearest;
+    }
+
+    return;
+  }
+
+  ARTS_USER_ERROR_IF(alts.size() or lats.size() or lons.size(),
+                     "Must give all or none of the grids to tabulate the field")
+
+  //! This struct deals with the computations.  The three components are
+  //! requested one after the other at the same position, so the last field
+  //! of each thread is kept.
   struct res {
-    Time t;
+    std::shared_ptr<const std::pair<Matrix, Matrix>> gh;
+
+    explicit res(const Time &t)
+        : gh(std::make_shared<const std::pair<Matrix, Matrix>>(
+              IGRF::coefficients(t))) {}
 
     [[nodiscard]] Vector3 comp(Numeric al, Numeric la, Numeric lo) const {
-      return igrf({al, la, lo}, ell, t);
+      struct last_t {
+        std::shared_ptr<const std::pair<Matrix, Matrix>> gh{};
+        Vector3 pos{};
+        Vector3 mag{};
+      };
+      thread_local last_t last;
+
+      if (last.gh != gh or last.pos[0] != al or last.pos[1] != la or
+          last.pos[2] != lo) {
+        const Vector3 pos{al, la, lo};
+        last = {gh, pos, igrf(gh->first, gh->second, pos, ell)};
+      }
+      return last.mag;
     }
 
     [[nodiscard]] Numeric get_u(Numeric z, Numeric la, Numeric lo) const {
-      return igrf({z, la, lo}, ell, t)[0];
+      return comp(z, la, lo)[0];
     }
 
     [[nodiscard]] Numeric get_v(Numeric z, Numeric la, Numeric lo) const {
-      return igrf({z, la, lo}, ell, t)[1];
+      return comp(z, la, lo)[1];
     }
 
     [[nodiscard]] Numeric get_w(Numeric z, Numeric la, Numeric lo) const {
-      return igrf({z, la, lo}, ell, t)[2];
+      return comp(z, la, lo)[2];
     }
   };
 
+  const res cpy(time);
   atmospheric_field[AtmKey::mag_u] = Atm::FunctionalData{
-      [cpy = res(time)](Numeric h, Numeric lat, Numeric lon) {
+      [cpy](Numeric h, Numeric lat, Numeric lon) {
         return cpy.get_u(h, lat, lon);
       }};
   atmospheric_field[AtmKey::mag_v] = Atm::FunctionalData{
-      [cpy = res(time)](Numeric h, Numeric lat, Numeric lon) {
+      [cpy](Numeric h, Numeric lat, Numeric lon) {
         return cpy.get_v(h, lat, lon);
       }};
   atmospheric_field[AtmKey::mag_w] = Atm::FunctionalData{
-      [cpy = res(time)](Numeric h, Numeric lat, Numeric lon) {
+      [cpy](Numeric h, Numeric lat, Numeric lon) {
         return cpy.get_w(h, lat, lon);
       }};
 }
+ARTS_METHOD_ERROR_CATCH
 
 enum class atmospheric_fieldHydrostaticPressureDataOptions : char {
   Lat,
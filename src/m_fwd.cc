@@ -1,9 +1,15 @@
 #include <fwd.h>
+#include <jacobian.h>
 #include <workspace.h>
 
 #include <algorithm>
+#include <chrono>
 #include <exception>
+#include <format>
+#include <functional>
+#include <iostream>
 #include <memory>
+#include <vector>
 
 #include "arts_omp.h"
 #include "debug.h"
@@ -63,12 +69,141 @@ void spectral_radiance_operatorClearsky1D(
                                                         cia_robust);
 }
 
+void spectral_radiance_operatorContinuumCache(
+    SpectralRadianceOperator& spectral_radiance_operator,
+    const AscendingGrid& frequency_grid,
+    const Numeric& tolerance,
+    const Index& start_nodes) {
+  ARTS_USER_ERROR_IF(frequency_grid.empty(), "Must have a frequency grid")
+
+  spectral_radiance_operator.set_continuum_cache(
+      {frequency_grid.front(), frequency_grid.back()}, tolerance, start_nodes);
+}
+
+void spectral_radiance_operatorWindShift(
+    SpectralRadianceOperator& spectral_radiance_operator, const Index& on) {
+  spectral_radiance_operator.set_wind_shift(on != 0);
+}
+
+void spectral_radiance_operatorBake(
+    SpectralRadianceOperator& spectral_radiance_operator,
+    const AscendingGrid& frequency_grid) try {
+  spectral_radiance_operator.bake(frequency_grid);
+}
+ARTS_METHOD_ERROR_CATCH
+
+void spectral_radiance_operatorSetJacobian(
+    SpectralRadianceOperator& spectral_radiance_operator,
+    const JacobianTargets& jacobian_targets) try {
+  ARTS_USER_ERROR_IF(
+      not jacobian_targets.surf().empty() or
+          not jacobian_targets.line().empty(),
+      "The operator only has derivatives for atmospheric targets")
+
+  const auto& targets = jacobian_targets.atm();
+
+  std::vector<AtmKeyVal> keys;
+  Vector perturbations(targets.size());
+  for (Size i = 0; i < targets.size(); i++) {
+    keys.push_back(targets[i].type);
+    perturbations[i] = targets[i].d;
+  }
+
+  spectral_radiance_operator.set_jacobian(keys, perturbations);
+}
+ARTS_METHOD_ERROR_CATCH
+
+namespace {
+/** Runs work(d, f0, f1) for all directions d and all frequencies
+ *
+ * The frequencies of each direction are split into blocks so that there are a
+ * few tasks per thread even for few directions.  The tasks are handed out
+ * dynamically, the most path points times frequencies first, so that long limb
+ * paths do not end up last on a single thread.
+ *
+ * If display_progress is non-zero, the progress is printed per tenth of the
+ * tasks done, followed by the scheduling and the time it took.
+ */
+template <typename Work>
+void schedule_by_path_size(const Work& work,
+                             const std::vector<Index>& path_sizes,
+                             const Index nfreq,
+                             const Index display_progress) {
+  using clock = std::chrono::steady_clock;
+
+  const Index ndir     = static_cast<Index>(path_sizes.size());
+  const Index nthreads =
+      arts_omp_in_parallel() ? 1 : arts_omp_get_max_threads();
+  const Index nblocks  = std::clamp<Index>(
+      (4 * nthreads + ndir - 1) / std::max<Index>(ndir, 1),
+      1,
+      std::max<Index>(nfreq, 1));
+  const Index block_size = (nfreq + nblocks - 1) / nblocks;
+
+  std::vector<std::array<Index, 3>> tasks;
+  for (Index d = 0; d < ndir; d++) {
+    for (Index f0 = 0; f0 < nfreq; f0 += block_size) {
+      tasks.push_back({d, f0, std::min(f0 + block_size, nfreq)});
+    }
+  }
+
+  std::ranges::stable_sort(
+      tasks, std::greater<>{}, [&path_sizes](const std::array<Index, 3>& t) {
+        return path_sizes[t[0]] * (t[2] - t[1]);
+      });
+
+  const Index ntasks = static_cast<Index>(tasks.size());
+  const auto start   = clock::now();
+  const auto seconds = [&start]() {
+    return std::chrono::duration<Numeric>(clock::now() - start).count();
+  };
+
+  Index done = 0;
+  String errors{};
+
+#pragma omp parallel for schedule(dynamic) if (not arts_omp_in_parallel())
+  for (Index it = 0; it < ntasks; it++) {
+    try {
+      work(tasks[it][0], tasks[it][1], tasks[it][2]);
+    } catch (std::exception& e) {
+#pragma omp critical
+      errors += e.what() + String("\n");
+    }
+
+    if (display_progress != 0) {
+#pragma omp critical(fwd_radiance_progress)
+      {
+        done++;
+        if ((10 * done) / ntasks != (10 * (done - 1)) / ntasks) {
+          std::cout << std::format(
+              "{} of {} tasks done after {:.2f} s\n", done, ntasks, seconds());
+        }
+      }
+    }
+  }
+
+  ARTS_USER_ERROR_IF(not errors.empty(), "{}", errors)
+
+  if (display_progress != 0) {
+    std::cout << std::format(
+        "{} directions in {} tasks of up to {} frequencies on {} threads\n"
+        "Spectral radiance computations took {:.3f} s\n",
+        ndir,
+        ntasks,
+        block_size,
+        nthreads,
+        seconds());
+  }
+}
+}  // namespace
+
 void spectral_radiance_fieldFromOperatorPlanarGeometric(
     StokvecGriddedField6& spectral_radiance_field,
     const SpectralRadianceOperator& spectral_radiance_operator,
     const AscendingGrid& frequency_grid,
     const AscendingGrid& zenith_grid,
-    const AscendingGrid& azimuth_grid) {
+    const AscendingGrid& azimuth_grid,
+    const Index& display_progress) {
   const AscendingGrid& altitude_grid  = spectral_radiance_operator.altitude();
   const AscendingGrid& latitude_grid  = spectral_radiance_operator.latitude();
   const AscendingGrid& longitude_grid = spectral_radiance_operator.longitude();
@@ -141,37 +276,40 @@ void spectral_radiance_fieldFromOperatorPlanarGeometric(
     return srad;
   };
 
-  if (arts_omp_in_parallel() or arts_omp_get_max_threads() == 1) {
-    for (Index i = 0; i < nza; ++i) {
-      for (Index j = 0; j < naa; ++j) {
-        const auto path = pathstep(zenith_grid[i], azimuth_grid[j]);
-        for (Index n = 0; n < nfreq; ++n) {
-          spectral_radiance_field.data(i, j, joker, 0, 0, n) =
-              freqstep(frequency_grid[n], zenith_grid[i], path);
-        }
-      }
-    }
-  } else {
-    String error{};
-
-#pragma omp parallel for collapse(2)
-    for (Index i = 0; i < nza; ++i) {
-      for (Index j = 0; j < naa; ++j) {
-        try {
-          const auto path = pathstep(zenith_grid[i], azimuth_grid[j]);
-          for (Index n = 0; n < nfreq; ++n) {
-            spectral_radiance_field.data(i, j, joker, 0, 0, n) =
-                freqstep(frequency_grid[n], zenith_grid[i], path);
-          }
-        } catch (std::exception& e) {
+  //! The paths are shared by all frequency blocks of a direction
+  std::vector<std::vector<fwd::path>> paths(nza * naa);
+  std::vector<Index> path_sizes(nza * naa);
+  String errors{};
+
+#pragma omp parallel for collapse(2) if (not arts_omp_in_parallel())
+  for (Index i = 0; i < nza; ++i) {
+    for (Index j = 0; j < naa; ++j) {
+      try {
+        paths[i * naa + j] = pathstep(zenith_grid[i], azimuth_grid[j]);
+        path_sizes[i * naa + j] =
+            static_cast<Index>(paths[i * naa + j].size());
+      } catch (std::exception& e) {
 #pragma omp critical
-          error += e.what() + String{"\n"};
-        }
+        errors += e.what() + String("\n");
       }
     }
-
-    ARTS_USER_ERROR_IF(not error.empty(), "{}", error)
   }
+
+  ARTS_USER_ERROR_IF(not errors.empty(), "{}", errors)
+
+  //! All paths have one point per altitude, so only the blocks matter here
+  schedule_by_path_size(
+      [&](const Index d, const Index f0, const Index f1) {
+        const Index i = d / naa;
+        const Index j = d % naa;
+        for (Index n = f0; n < f1; ++n) {
+          spectral_radiance_field.data(i, j, joker, 0, 0, n) =
+              freqstep(frequency_grid[n], zenith_grid[i], paths[d]);
+        }
+      },
+      path_sizes,
+      nfreq,
+      display_progress);
 }
 
 void spectral_radiance_fieldFromOperatorPath(
@@ -181,7 +319,8 @@ void spectral_radiance_fieldFromOperatorPath(
     const Agenda& ray_path_observer_agenda,
     const AscendingGrid& frequency_grid,
     const AscendingGrid& zenith_grid,
-    const AscendingGrid& azimuth_grid) {
+    const AscendingGrid& azimuth_grid,
+    const Index& display_progress) {
   const AscendingGrid& altitude_grid  = spectral_radiance_operator.altitude();
   const AscendingGrid& latitude_grid  = spectral_radiance_operator.latitude();
   const AscendingGrid& longitude_grid = spectral_radiance_operator.longitude();
@@ -192,6 +331,7 @@ void spectral_radiance_fieldFromOperatorPath(
   const Index nlat  = latitude_grid.size();
   const Index nlon  = longitude_grid.size();
   const Index nfreq = frequency_grid.size();
+  const Index ndir  = nza * naa * nalt * nlat * nlon;
 
   spectral_radiance_field = StokvecGriddedField6{
       .data_name = "Spectral Radiance Field",
@@ -210,74 +350,78 @@ void spectral_radiance_fieldFromOperatorPath(
                      longitude_grid,
                      frequency_grid}};
 
-  if (arts_omp_in_parallel()) {
-    for (Index iza = 0; iza < nza; ++iza) {
-      for (Index iaa = 0; iaa < naa; ++iaa) {
-        for (Index ialt = 0; ialt < nalt; ++ialt) {
-          for (Index ilat = 0; ilat < nlat; ++ilat) {
-            for (Index ilon = 0; ilon < nlon; ++ilon) {
-              ArrayOfPropagationPathPoint ray_path;
-              ray_path_observer_agendaExecute(
-                  ws,
-                  ray_path,
-                  {altitude_grid[ialt],
-                   latitude_grid[ilat],
-                   longitude_grid[ilon]},
-                  {zenith_grid[iza], azimuth_grid[iaa]},
-                  ray_path_observer_agenda);
-              std::transform(
-                  frequency_grid.begin(),
-                  frequency_grid.end(),
-                  spectral_radiance_field(iza, iaa, ialt, ilat, ilon, joker)
-                      .begin(),
-                  [path = spectral_radiance_operator.from_path(ray_path),
-                   &spectral_radiance_operator](Numeric f) {
-                    return spectral_radiance_operator(f, path);
-                  });
-            }
-          }
-        }
-      }
-    }
-  } else {
+  //! Directions are the flattened first 5 dimensions of the field
+  auto field = spectral_radiance_field.data.reshape_as(ndir, nfreq);
+
+  //! The paths of a batch of directions are shared by all their frequency
+  //! blocks, and freed before the next batch, so that the memory does not
+  //! grow with the size of the field
+  const Index nthreads =
+      arts_omp_in_parallel() ? 1 : arts_omp_get_max_threads();
+  const Index batch_size = std::min<Index>(ndir, 16 * nthreads);
+  std::vector<std::vector<fwd::path>> paths(batch_size);
+  std::vector<Index> path_sizes;
+
+  for (Index d0 = 0; d0 < ndir; d0 += batch_size) {
+    const Index nd = std::min(batch_size, ndir - d0);
+    path_sizes.assign(nd, 0);
     String errors{};
 
-#pragma omp parallel for collapse(5)
-    for (Index iza = 0; iza < nza; ++iza) {
-      for (Index iaa = 0; iaa < naa; ++iaa) {
-        for (Index ialt = 0; ialt < nalt; ++ialt) {
-          for (Index ilat = 0; ilat < nlat; ++ilat) {
-            for (Index ilon = 0; ilon < nlon; ++ilon) {
-              try {
-                ArrayOfPropagationPathPoint ray_path;
-                ray_path_observer_agendaExecute(
-                    ws,
-                    ray_path,
-                    {altitude_grid[ialt],
-                     latitude_grid[ilat],
-                     longitude_grid[ilon]},
-                    {zenith_grid[iza], azimuth_grid[iaa]},
-                    ray_path_observer_agenda);
-                std::transform(
-                    frequency_grid.begin(),
-                    frequency_grid.end(),
-                    spectral_radiance_field(iza, iaa, ialt, ilat, ilon, joker)
-                        .begin(),
-                    [path = spectral_radiance_operator.from_path(ray_path),
-                     &spectral_radiance_operator](Numeric f) {
-                      return spectral_radiance_operator(f, path);
-                    });
-              } catch (std::exception& e) {
+    const auto start = std::chrono::steady_clock::now();
+
+#pragma omp parallel for schedule(dynamic) if (not arts_omp_in_parallel())
+    for (Index i = 0; i < nd; ++i) {
+      Index d          = d0 + i;
+      const Index ilon = d % nlon;
+      d               /= nlon;
+      const Index ilat = d % nlat;
+      d               /= nlat;
+      const Index ialt = d % nalt;
+      d               /= nalt;
+      const Index iaa  = d % naa;
+      const Index iza  = d / naa;
+
+      try {
+        ArrayOfPropagationPathPoint ray_path;
+        ray_path_observer_agendaExecute(
+            ws,
+            ray_path,
+            {altitude_grid[ialt], latitude_grid[ilat], longitude_grid[ilon]},
+            {zenith_grid[iza], azimuth_grid[iaa]},
+            ray_path_observer_agenda);
+        spectral_radiance_operator.from_path(paths[i], ray_path);
+        path_sizes[i] = static_cast<Index>(paths[i].size());
+      } catch (std::exception& e) {
 #pragma omp critical
-                errors += e.what() + String("\n");
-              }
-            }
-          }
-        }
+        errors += e.what() + String("\n");
       }
     }
 
     ARTS_USER_ERROR_IF(not errors.empty(), "{}", errors)
+
+    if (display_progress != 0) {
+      std::cout << std::format(
+          "Directions {} to {} of {}, paths took {:.3f} s\n",
+          d0,
+          d0 + nd - 1,
+          ndir,
+          std::chrono::duration<Numeric>(std::chrono::steady_clock::now() -
+                                         start)
+              .count());
+    }
+
+    schedule_by_path_size(
+        [&](const Index i, const Index f0, const Index f1) {
+          for (Index n = f0; n < f1; ++n) {
+            field(d0 + i, n) =
+                spectral_radiance_operator(frequency_grid[n], paths[i]);
+          }
+        },
+        path_sizes,
+        nfreq,
+        display_progress);
+
+    for (auto& path : paths) path = {};
   }
 }
 
@@ -327,3 +471,193 @@ void measurement_vectorFromOperatorPath(
   }
 }
 ARTS_METHOD_ERROR_CATCH
+
+void measurement_vectorFromOperatorPathAdaptive(
+    const Workspace& ws,
+    Vector& measurement_vector,
+    Vector& measurement_vector_error,
+    const ArrayOfSensorObsel& measurement_vector_sensor,
+    const SpectralRadianceOperator& spectral_radiance_operator,
+    const Agenda& ray_path_observer_agenda,
+    const Numeric& optical_depth,
+    const Numeric& source_tolerance,
+    const Numeric& cutoff_transmission,
+    const Index& max_depth,
+    const Index& max_stride) try {
+  ARTS_USER_ERROR_IF(optical_depth < 0.0,
+                     "The optical depth must not be negative: {}",
+                     optical_depth)
+  ARTS_USER_ERROR_IF(source_tolerance <= 0.0,
+                     "The source tolerance must be positive: {}",
+                     source_tolerance)
+  ARTS_USER_ERROR_IF(max_depth < 0 or max_depth > 16,
+                     "The maximum depth must be in [0, 16]: {}",
+                     max_depth)
+  ARTS_USER_ERROR_IF(
+      max_stride < 1, "The maximum stride must be positive: {}", max_stride)
+
+  measurement_vector.resize(measurement_vector_sensor.size());
+  measurement_vector = 0.0;
+  measurement_vector_error.resize(measurement_vector_sensor.size());
+  measurement_vector_error = 0.0;
+  if (measurement_vector_sensor.empty()) return;
+
+  //! Check the observational elements that their dimensions are correct
+  for (auto& obsel : measurement_vector_sensor) obsel.check();
+
+  const SensorSimulations simulations =
+      collect_simulations(measurement_vector_sensor);
+
+  for (auto& [f_grid_ptr, poslos_set] : simulations) {
+    const Index nf = f_grid_ptr->size();
+
+    for (auto& poslos_gs : poslos_set) {
+      for (Index ip = 0; ip < poslos_gs->size(); ++ip) {
+        ArrayOfPropagationPathPoint ray_path;
+        std::vector<fwd::path> path;
+        StokvecVector spectral_radiance(nf);
+        StokvecVector spectral_radiance_error(nf);
+
+        const SensorPosLos& poslos = (*poslos_gs)[ip];
+
+        ray_path_observer_agendaExecute(
+            ws, ray_path, poslos.pos, poslos.los, ray_path_observer_agenda);
+        spectral_radiance_operator.from_path(path, ray_path);
+
+        for (Index iv = 0; iv < nf; ++iv) {
+          const auto [srad, err] =
+              spectral_radiance_operator.adaptive((*f_grid_ptr)[iv],
+                                                  path,
+                                                  optical_depth,
+                                                  source_tolerance,
+                                                  cutoff_transmission,
+                                                  max_depth,
+                                                  max_stride);
+          spectral_radiance[iv]       = srad;
+          spectral_radiance_error[iv] = Stokvec{err, 0.0, 0.0, 0.0};
+        }
+
+        for (Size iv = 0; iv < measurement_vector_sensor.size(); ++iv) {
+          const SensorObsel& obsel = measurement_vector_sensor[iv];
+          if (obsel.same_freqs(f_grid_ptr)) {
+            measurement_vector[iv] += obsel.sumup(spectral_radiance, ip);
+            measurement_vector_error[iv] +=
+                std::abs(obsel.sumup(spectral_radiance_error, ip));
+          }
+        }
+      }
+    }
+  }
+}
+ARTS_METHOD_ERROR_CATCH
+
+void measurement_vectorFromOperatorPathWithJacobian(
+    const Workspace& ws,
+    Vector& measurement_vector,
+    Matrix& measurement_jacobian,
+    const ArrayOfSensorObsel& measurement_vector_sensor,
+    const SpectralRadianceOperator& spectral_radiance_operator,
+    const JacobianTargets& jacobian_targets,
+    const AtmField& atmospheric_field,
+    const Agenda& ray_path_observer_agenda) try {
+  const auto& targets = jacobian_targets.atm();
+  const Index nx      = jacobian_targets.x_size();
+  const Index nt      = static_cast<Index>(targets.size());
+  const Index nn      = spectral_radiance_operator.node_count();
+
+  measurement_vector.resize(measurement_vector_sensor.size());
+  measurement_vector = 0.0;
+  measurement_jacobian.resize(measurement_vector_sensor.size(), nx);
+  measurement_jacobian = 0.0;
+  if (measurement_vector_sensor.empty()) return;
+
+  ARTS_USER_ERROR_IF(
+      not jacobian_targets.surf().empty() or
+          not jacobian_targets.line().empty(),
+      "The operator only has derivatives for atmospheric targets")
+
+  ARTS_USER_ERROR_IF(
+      not std::ranges::equal(spectral_radiance_operator.jacobian_keys,
+                             targets,
+                             {},
+                             {},
+                             &Jacobian::AtmTarget::type),
+      "The operator derivatives do not match jacobian_targets.\n"
+      "Call spectral_radiance_operatorSetJacobian first.")
+
+  //! Check the observational elements that their dimensions are correct
+  for (auto& obsel : measurement_vector_sensor) obsel.check();
+
+  //! The weights of the atmospheric field data at each operator node
+  const auto& alt = spectral_radiance_operator.altitude();
+  const auto& lat = spectral_radiance_operator.latitude();
+  const auto& lon = spectral_radiance_operator.longitude();
+  std::vector<std::vector<std::array<std::pair<Index, Numeric>, 8>>>
+      node_weights(nt);
+  for (Index it = 0; it < nt; it++) {
+    ARTS_USER_ERROR_IF(not atmospheric_field.contains(targets[it].type),
+                       "No {} in atmospheric_field but in jacobian_targets",
+                       targets[it].type)
+
+    const auto& data = atmospheric_field[targets[it].type];
+    for (Index i = 0; i < alt.size(); i++) {
+      for (Index j = 0; j < lat.size(); j++) {
+        for (Index k = 0; k < lon.size(); k++) {
+          node_weights[it].push_back(data.flat_weight(alt[i], lat[j], lon[k]));
+        }
+      }
+    }
+  }
+
+  const SensorSimulations simulations =
+      collect_simulations(measurement_vector_sensor);
+
+  StokvecMatrix dI(nt, nn);
+
+  for (auto& [f_grid_ptr, poslos_set] : simulations) {
+    const Index nf = f_grid_ptr->size();
+
+    for (auto& poslos_gs : poslos_set) {
+      for (Index ip = 0; ip < poslos_gs->size(); ++ip) {
+        ArrayOfPropagationPathPoint ray_path;
+        std::vector<fwd::path> path;
+        StokvecVector spectral_radiance(nf);
+        StokvecMatrix spectral_radiance_jacobian(nx, nf);
+        spectral_radiance_jacobian = Stokvec{0.0, 0.0, 0.0, 0.0};
+
+        const SensorPosLos& poslos = (*poslos_gs)[ip];
+
+        ray_path_observer_agendaExecute(
+            ws, ray_path, poslos.pos, poslos.los, ray_path_observer_agenda);
+        spectral_radiance_operator.from_path(path, ray_path);
+
+        for (Index iv = 0; iv < nf; iv++) {
+          dI                    = Stokvec{0.0, 0.0, 0.0, 0.0};
+          spectral_radiance[iv] =
+              spectral_radiance_operator(dI, (*f_grid_ptr)[iv], path);
+
+          for (Index it = 0; it < nt; it++) {
+            for (Index in = 0; in < nn; in++) {
+              for (auto& [ix, w] : node_weights[it][in]) {
+                if (w == 0.0) continue;
+                spectral_radiance_jacobian(
+                    static_cast<Index>(targets[it].x_start) + ix, iv) +=
+                    w * dI(it, in);
+              }
+            }
+          }
+        }
+
+        for (Size iv = 0; iv < measurement_vector_sensor.size(); ++iv) {
+          const SensorObsel& obsel = measurement_vector_sensor[iv];
+          if (obsel.same_freqs(f_grid_ptr)) {
+            measurement_vector[iv] += obsel.sumup(spectral_radiance, ip);
+            obsel.sumup(
+                measurement_jacobian[iv], spectral_radiance_jacobian, ip);
+          }
+        }
+      }
+    }
+  }
+}
+ARTS_METHOD_ERROR_CATCH
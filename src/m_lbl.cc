@@ -452,7 +452,8 @@ void absorption_bandsReadSpeciesSplitCatalog(
 ARTS_METHOD_ERROR_CATCH
 
 void absorption_bandsReadSplit(AbsorptionBands& absorption_bands,
-                               const String& dir) try {
+                               const String& dir,
+                               const Vector2& frequency_range) try {
   absorption_bands = {};
 
   std::vector<std::filesystem::path> paths;
@@ -470,7 +471,7 @@ void absorption_bandsReadSplit(AbsorptionBands& absorption_bands,
 #pragma omp parallel for schedule(dynamic)
   for (Size i = 0; i < paths.size(); i++) {
     try {
-      xml_read_from_file(paths[i].string(), splitbands[i]);
+      xml_read_from_file(paths[i].string(), splitbands[i], frequency_range);
     } catch (std::exception& e) {
 #pragma omp critical
       error += var_string(e.what(), '\n');
@@ -497,7 +498,8 @@ void absorption_bandsReadSplit(AbsorptionBands& absorption_bands,
 ARTS_METHOD_ERROR_CATCH
 
 void absorption_bandsSaveSplit(const AbsorptionBands& absorption_bands,
-                               const String& dir) try {
+                               const String& dir,
+                               const Index& binary) try {
   auto create_if_not = [](const std::filesystem::path& path) {
     if (not std::filesystem::exists(path)) {
       std::filesystem::create_directories(path);
@@ -513,8 +515,10 @@ void absorption_bandsSaveSplit(const AbsorptionBands& absorption_bands,
   }
 
   for (const auto& [isot, bands] : isotopologues_data) {
-    xml_write_to_file(
-        (p / var_string(isot, ".xml")).string(), bands, FileType::ascii, 0);
+    xml_write_to_file((p / var_string(isot, ".xml")).string(),
+                      bands,
+                      binary ? FileType::binary : FileType::ascii,
+                      0);
   }
 }
 ARTS_METHOD_ERROR_CATCH
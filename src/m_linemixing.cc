@@ -135,3 +135,49 @@ void ecs_dataAddTran2011(LinemixingEcsData& ecs_data) {
         data(T0, {Conversion::angstrom2meter(5.5)});
   }
 }
+
+void ecs_dataAddTabulatedBands(LinemixingEcsData& ecs_data,
+                               const AbsorptionBands& absorption_bands,
+                               const AtmPoint& atmospheric_point,
+                               const AscendingGrid& temperatures,
+                               const AscendingGrid& pressures,
+                               const Numeric& max_relative_error) try {
+  const AscendingGrid P =
+      pressures.empty() ? AscendingGrid{atmospheric_point.pressure} : pressures;
+
+  String error{};
+  for (auto& [key, band] : absorption_bands) {
+    if (band.lineshape != LineByLineLineshape::VP_ECS_MAKAROV and
+        band.lineshape != LineByLineLineshape::VP_ECS_HARTMANN)
+      continue;
+
+    auto it = ecs_data.find(key.Isotopologue());
+    ARTS_USER_ERROR_IF(it == ecs_data.end(),
+                       "No ECS data for isotopologue {}",
+                       key.Isotopologue())
+
+    auto table = lbl::voigt::ecs::tabulate(
+        key, band, it->second, atmospheric_point, temperatures, P);
+
+    if (table.str_error > max_relative_error or
+        table.val_error > max_relative_error) {
+      error += std::format(
+          "Band {} has relative errors of {} in strength and {} in line center and width\n",
+          key,
+          table.str_error,
+          table.val_error);
+    }
+
+    ecs_data.tables[key] = std::move(table);
+  }
+
+  ARTS_USER_ERROR_IF(not error.empty(),
+                     "The tables exceed the maximum relative error of {}:\n{}",
+                     max_relative_error,
+                     error)
+}
+ARTS_METHOD_ERROR_CATCH
+
+void ecs_dataRemoveTabulatedBands(LinemixingEcsData& ecs_data) {
+  ecs_data.tables.clear();
+}
@@ -12,12 +12,11 @@ void absorption_lookup_tableInit(
   absorption_lookup_table.clear();
 }
 
-template <bool calc>
-std::conditional_t<calc, Vector, void> _propagation_matrixAddLookup(
-    PropmatVector& propagation_matrix [[maybe_unused]],
-    PropmatMatrix& propagation_matrix_jacobian [[maybe_unused]],
+void propagation_matrixAddLookup(
+    PropmatVector& propagation_matrix,
+    PropmatMatrix& propagation_matrix_jacobian,
     const AscendingGrid& frequency_grid,
-    const JacobianTargets& jacobian_targets [[maybe_unused]],
+    const JacobianTargets& jacobian_targets,
     const SpeciesEnum& propagation_matrix_select_species,
     const AbsorptionLookupTables& absorption_lookup_table,
     const AtmPoint& atmospheric_point,
@@ -26,26 +25,19 @@ std::conditional_t<calc, Vector, void> _propagation_matrixAddLookup(
     const Index& t_interp_order,
     const Index& water_interp_order,
     const Index& f_interp_order,
-    const Numeric& extpolfac) {
-  if constexpr (calc) {
-    Vector absorption(frequency_grid.size(), 0.0);
-
-    if (propagation_matrix_select_species == "Bath"_spec) {
-      for (auto& [spec, data] : absorption_lookup_table) {
-        data.absorption(absorption,
-                        spec,
-                        p_interp_order,
-                        t_interp_order,
-                        water_interp_order,
-                        f_interp_order,
-                        atmospheric_point,
-                        frequency_grid,
-                        extpolfac);
-      }
-    } else {
-      absorption_lookup_table.at(propagation_matrix_select_species)
-          .absorption(absorption,
-                      propagation_matrix_select_species,
+    const Numeric& extpolfac) try {
+  const Index nf      = frequency_grid.size();
+  const auto& targets = jacobian_targets.atm();
+
+  Vector absorption(nf, 0.0);
+  Matrix d_absorption(targets.size(), nf, 0.0);
+  lookup::absorption_derivatives derivatives(targets.empty() ? 0 : nf);
+
+  const auto add = [&](const SpeciesEnum& species,
+                       const AbsorptionLookupTable& data) {
+    if (targets.empty()) {
+      data.absorption(absorption,
+                      species,
                       p_interp_order,
                       t_interp_order,
                       water_interp_order,
@@ -53,120 +45,56 @@ std::conditional_t<calc, Vector, void> _propagation_matrixAddLookup(
                       atmospheric_point,
                       frequency_grid,
                       extpolfac);
+      return;
     }
 
-    return absorption;
-  } else {
-    const Vector absorption = _propagation_matrixAddLookup<not calc>(
-        propagation_matrix,
-        propagation_matrix_jacobian,
-        frequency_grid,
-        jacobian_targets,
-        propagation_matrix_select_species,
-        absorption_lookup_table,
-        atmospheric_point,
-        no_negative_absorption,
-        p_interp_order,
-        t_interp_order,
-        water_interp_order,
-        f_interp_order,
-        extpolfac);
-
-    for (Index i = 0; i < frequency_grid.size(); i++) {
-      if (no_negative_absorption == 0 or absorption[i] > 0.0) {
-        propagation_matrix[i].A() += absorption[i];
+    derivatives.zero();
+    data.absorption(absorption,
+                    derivatives,
+                    species,
+                    p_interp_order,
+                    t_interp_order,
+                    water_interp_order,
+                    f_interp_order,
+                    atmospheric_point,
+                    frequency_grid,
+                    extpolfac);
+
+    for (Size i = 0; i < targets.size(); i++) {
+      const auto& target = targets[i];
+      auto dx            = d_absorption[i];
+
+      if (target.type == AtmKey::t) {
+        dx += derivatives.t;
+      } else if (target.type == AtmKey::p) {
+        dx += derivatives.p;
+      } else if (target.is_wind()) {
+        dx += derivatives.f;
+      } else {
+        if (target.type == species) dx += derivatives.vmr;
+        if (target.type == "H2O"_spec) dx += derivatives.h2o;
       }
     }
+  };
 
-    if (jacobian_targets.atm().size()) {
-      Vector d_absorption;
-
-      for (auto& jacobian_target : jacobian_targets.atm()) {
-        ARTS_USER_ERROR_IF(
-            not std::isnormal(jacobian_target.d),
-            "The target {} is not good, it lacks a perturbation value.",
-            jacobian_target);
-
-        if (jacobian_target.is_wind()) {
-          const AscendingGrid frequency_grid2(
-              frequency_grid.begin(),
-              frequency_grid.end(),
-              [d = jacobian_target.d](Numeric x) { return x + d; });
-          d_absorption = _propagation_matrixAddLookup<not calc>(
-              propagation_matrix,
-              propagation_matrix_jacobian,
-              frequency_grid2,
-              {},
-              propagation_matrix_select_species,
-              absorption_lookup_table,
-              atmospheric_point,
-              no_negative_absorption,
-              p_interp_order,
-              t_interp_order,
-              water_interp_order,
-              f_interp_order,
-              extpolfac);
-
-        } else {
-          AtmPoint atm_point               = atmospheric_point;
-          atm_point[jacobian_target.type] += jacobian_target.d;
-
-          d_absorption = _propagation_matrixAddLookup<not calc>(
-              propagation_matrix,
-              propagation_matrix_jacobian,
-              frequency_grid,
-              {},
-              propagation_matrix_select_species,
-              absorption_lookup_table,
-              atm_point,
-              no_negative_absorption,
-              p_interp_order,
-              t_interp_order,
-              water_interp_order,
-              f_interp_order,
-              extpolfac);
-        }
+  if (propagation_matrix_select_species == "Bath"_spec) {
+    for (auto& [spec, data] : absorption_lookup_table) add(spec, data);
+  } else {
+    add(propagation_matrix_select_species,
+        absorption_lookup_table.at(propagation_matrix_select_species));
+  }
 
-        const Numeric d_inv = 1.0 / jacobian_target.d;
-        for (Index i = 0; i < frequency_grid.size(); i++) {
-          if (no_negative_absorption == 0 or d_absorption[i] > 0.0) {
-            propagation_matrix_jacobian(jacobian_target.target_pos, i).A() =
-                (d_absorption[i] - absorption[i]) * d_inv;
-          }
-        }
+  for (Index i = 0; i < nf; i++) {
+    if (no_negative_absorption == 0 or absorption[i] > 0.0) {
+      propagation_matrix[i].A() += absorption[i];
+
+      for (Size j = 0; j < targets.size(); j++) {
+        propagation_matrix_jacobian(targets[j].target_pos, i).A() +=
+            d_absorption(j, i);
       }
     }
   }
 }
-
-void propagation_matrixAddLookup(
-    PropmatVector& propagation_matrix,
-    PropmatMatrix& propagation_matrix_jacobian,
-    const AscendingGrid& frequency_grid,
-    const JacobianTargets& jacobian_targets,
-    const SpeciesEnum& propagation_matrix_select_species,
-    const AbsorptionLookupTables& absorption_lookup_table,
-    const AtmPoint& atmospheric_point,
-    const Index& no_negative_absorption,
-    const Index& p_interp_order,
-    const Index& t_interp_order,
-    const Index& water_interp_order,
-    const Index& f_interp_order,
-    const Numeric& extpolfac) try {
-  _propagation_matrixAddLookup<false>(propagation_matrix,
-                                      propagation_matrix_jacobian,
-                                      frequency_grid,
-                                      jacobian_targets,
-                                      propagation_matrix_select_species,
-                                      absorption_lookup_table,
-                                      atmospheric_point,
-                                      no_negative_absorption,
-                                      p_interp_order,
-                                      t_interp_order,
-                                      water_interp_order,
-                                      f_interp_order,
-                                      extpolfac);
-}
 ARTS_METHOD_ERROR_CATCH
 
 void ray_path_atmospheric_pointExtendInPressure(
@@ -205,17 +133,11 @@ void absorption_lookup_tablePrecompute(
           : std::make_shared<const AscendingGrid>(water_perturbation)};
 }
 
-void absorption_lookup_tablePrecomputeAll(
-    AbsorptionLookupTables& absorption_lookup_table,
-    const ArrayOfAtmPoint& ray_path_atmospheric_point,
-    const AscendingGrid& frequency_grid,
+namespace {
+//! The sorted species of the bands, which must include water_affected_species
+ArrayOfSpeciesEnum lookup_species(
     const AbsorptionBands& absorption_bands,
-    const LinemixingEcsData& ecs_data,
-    const AscendingGrid& temperature_perturbation,
-    const AscendingGrid& water_perturbation,
     const ArrayOfSpeciesEnum& water_affected_species) {
-  const AscendingGrid empty{};
-
   ArrayOfSpeciesEnum lut_species;
   const auto species_not_in_lut =
       std::views::transform(
@@ -244,6 +166,22 @@ void absorption_lookup_tablePrecomputeAll(
         water_affected_species)
   }
 
+  return lut_species;
+}
+}  // namespace
+
+void absorption_lookup_tablePrecomputeAll(
+    AbsorptionLookupTables& absorption_lookup_table,
+    const ArrayOfAtmPoint& ray_path_atmospheric_point,
+    const AscendingGrid& frequency_grid,
+    const AbsorptionBands& absorption_bands,
+    const LinemixingEcsData& ecs_data,
+    const AscendingGrid& temperature_perturbation,
+    const AscendingGrid& water_perturbation,
+    const ArrayOfSpeciesEnum& water_affected_species) {
+  const ArrayOfSpeciesEnum lut_species =
+      lookup_species(absorption_bands, water_affected_species);
+
   const auto f = std::make_shared<const AscendingGrid>(frequency_grid);
   const auto t =
       std::make_shared<const AscendingGrid>(temperature_perturbation);
@@ -266,6 +204,123 @@ void absorption_lookup_tablePrecomputeAll(
   }
 }
 
+void absorption_lookup_tableAdaptive(
+    AbsorptionLookupTables& absorption_lookup_table,
+    String& report,
+    const ArrayOfAtmPoint& ray_path_atmospheric_point,
+    const AscendingGrid& frequency_grid,
+    const AbsorptionBands& absorption_bands,
+    const LinemixingEcsData& ecs_data,
+    const AscendingGrid& temperature_perturbation,
+    const AscendingGrid& water_perturbation,
+    const ArrayOfSpeciesEnum& water_affected_species,
+    const Numeric& tolerance,
+    const ArrayOfSpeciesEnum& tolerance_species,
+    const Vector& species_tolerance,
+    const Index& p_interp_order,
+    const Index& t_interp_order,
+    const Index& water_interp_order) {
+  ARTS_USER_ERROR_IF(
+      static_cast<Index>(tolerance_species.size()) != species_tolerance.size(),
+      "Must have one tolerance per species, got {} species and {} tolerances",
+      tolerance_species.size(),
+      species_tolerance.size())
+
+  const ArrayOfSpeciesEnum lut_species =
+      lookup_species(absorption_bands, water_affected_species);
+
+  const auto f = std::make_shared<const AscendingGrid>(frequency_grid);
+  const auto t =
+      std::make_shared<const AscendingGrid>(temperature_perturbation);
+  const auto w = std::make_shared<const AscendingGrid>(water_perturbation);
+
+  report.clear();
+  for (SpeciesEnum s : lut_species) {
+    const bool do_water_perturb =
+        std::ranges::any_of(water_affected_species, Cmp::eq(s));
+
+    const auto ptr = std::ranges::find(tolerance_species, s);
+    const Numeric species_tol =
+        ptr == tolerance_species.end()
+            ? tolerance
+            : species_tolerance[std::distance(tolerance_species.begin(), ptr)];
+
+    lookup::adaptive_summary summary;
+    absorption_lookup_table[s] =
+        lookup::adaptive_table(summary,
+                               s,
+                               ray_path_atmospheric_point,
+                               f,
+                               absorption_bands,
+                               ecs_data,
+                               t,
+                               do_water_perturb ? w : nullptr,
+                               p_interp_order,
+                               t_interp_order,
+                               water_interp_order,
+                               species_tol);
+
+    const auto [nt, nw, np]   = summary.nodes;
+    const auto [mt, mw, mp]   = summary.candidates;
+    const Index nodes         = nt * nw * np;
+    const Index uniform_nodes = mt * mw * mp;
+    report += std::format(
+        R"({}:
+  Pressure levels:             {} of {}
+  Temperature perturbations:   {} of {}
+  Water perturbations:         {} of {}
+  Table nodes:                 {} of {} ({:.1f}%)
+  Tolerance:                   {}
+  Cross-section calculations:  {}
+)",
+        s,
+        np,
+        mp,
+        nt,
+        mt,
+        nw,
+        mw,
+        nodes,
+        uniform_nodes,
+        100.0 * static_cast<Numeric>(nodes) /
+            static_cast<Numeric>(uniform_nodes),
+        species_tol,
+        summary.calculations);
+  }
+}
+
+void absorption_lookup_tableUpdateBands(
+    AbsorptionLookupTables& absorption_lookup_table,
+    const ArrayOfAtmPoint& ray_path_atmospheric_point,
+    const AbsorptionBands& absorption_bands,
+    const LinemixingEcsData& ecs_data,
+    const ArrayOfQuantumIdentifier& changed_bands) {
+  for (auto& [s, lut] : absorption_lookup_table) {
+    lut.update_bands(s,
+                     ray_path_atmospheric_point,
+                     absorption_bands,
+                     ecs_data,
+                     changed_bands);
+  }
+}
+
+void absorption_lookup_tableExtendGrids(
+    AbsorptionLookupTables& absorption_lookup_table,
+    const ArrayOfAtmPoint& ray_path_atmospheric_point,
+    const AscendingGrid& frequency_grid,
+    const AbsorptionBands& absorption_bands,
+    const LinemixingEcsData& ecs_data) {
+  const auto f = std::make_shared<const AscendingGrid>(frequency_grid);
+
+  for (auto& [s, lut] : absorption_lookup_table) {
+    //! New levels at the old frequencies, then new frequencies at all levels
+    lut.extend_pressure(
+        s, ray_path_atmospheric_point, absorption_bands, ecs_data);
+    lut.extend_frequency(
+        s, ray_path_atmospheric_point, f, absorption_bands, ecs_data);
+  }
+}
+
 void absorption_lookup_tableFromProfiles(
     AbsorptionLookupTables& absorption_lookup_table,
     const AscendingGrid& frequency_grid,
@@ -104,7 +104,8 @@ void OEM(const Workspace& ws,
          const Numeric& stop_dx,
          const Vector& lm_ga_settings,
          const Index& clear_matrices,
-         const Index& display_progress) {
+         const Index& display_progress,
+         const Index& processes) {
   // Main sizes
   const Index n = model_state_covariance_matrix.nrows();
   const Index m = measurement_vector.nelem();
@@ -128,7 +129,8 @@ void OEM(const Workspace& ws,
              stop_dx,
              lm_ga_settings,
              clear_matrices,
-             display_progress);
+             display_progress,
+             processes);
 
   // Size diagnostic output and init with NaNs
   oem_diagnostics.resize(5);
@@ -152,13 +154,14 @@ void OEM(const Workspace& ws,
   // If no precomputed value given, we compute yf and jacobian to
   // compute initial cost (and use in the first OEM iteration).
   if (measurement_vector_fitted.nelem() == 0) {
-    inversion_iterate_agendaExecute(ws,
-                                    measurement_vector_fitted,
-                                    measurement_jacobian,
-                                    model_state_vector_apriori,
-                                    1,
-                                    0,
-                                    inversion_iterate_agenda);
+    oem::inversion_iterate(ws,
+                           measurement_vector_fitted,
+                           measurement_jacobian,
+                           model_state_vector_apriori,
+                           1,
+                           0,
+                           inversion_iterate_agenda,
+                           processes);
   }
 
   ARTS_USER_ERROR_IF(
@@ -228,7 +231,8 @@ void OEM(const Workspace& ws,
                           (unsigned int)n,
                           measurement_jacobian,
                           measurement_vector_fitted,
-                          &inversion_iterate_agenda);
+                          &inversion_iterate_agenda,
+                          processes);
     oem::OEM_STANDARD<oem::AgendaWrapper> oem(aw, xa_oem, Sa, Se);
     oem::OEM_MFORM<oem::AgendaWrapper> oem_m(aw, xa_oem, Sa, Se);
     int oem_verbosity = static_cast<int>(display_progress);
@@ -5,6 +5,8 @@
 #include <workspace.h>
 
 #include <algorithm>
+#include <optional>
+#include <vector>
 
 #include "arts_omp.h"
 #include "atm.h"
@@ -107,7 +109,10 @@ void sun_pathFromObserverAgenda(const Workspace& ws,
                                 const Vector3& observer_pos,
                                 const Numeric& angle_cut,
                                 const Index& refinements,
-                                const Index& just_hit) {
+                                const Index& just_hit,
+                                const Index& secant_steps) {
+  ARTS_USER_ERROR_IF(secant_steps < 0, "secant_steps must be non-negative")
+
   find_sun_path(ws,
                 sun_path,
                 sun,
@@ -116,9 +121,58 @@ void sun_pathFromObserverAgenda(const Workspace& ws,
                 observer_pos,
                 angle_cut,
                 refinements,
-                just_hit);
+                just_hit,
+                std::nullopt,
+                secant_steps);
+}
+
+namespace {
+/** Find the sun paths of the points in [first, last) in order
+ *
+ * Neighbouring path points see the sun in almost the same direction, so each
+ * search is warm-started from the line-of-sight found for the previous point.
+ */
+template <typename SunPath>
+void sun_paths_along(const Workspace& ws,
+                     SunPath&& sun_path,
+                     const SurfaceField& surface_field,
+                     const Agenda& ray_path_observer_agenda,
+                     const ArrayOfPropagationPathPoint& ray_path,
+                     const Sun& sun,
+                     const Size first,
+                     const Size last,
+                     const Numeric angle_cut,
+                     const Index refinements,
+                     const Index just_hit) {
+  std::optional<Vector2> los{};
+  for (Size i = first; i < last; ++i) {
+    los = find_sun_path(ws,
+                        sun_path(i),
+                        sun,
+                        ray_path_observer_agenda,
+                        surface_field,
+                        ray_path[i].pos,
+                        angle_cut,
+                        refinements,
+                        static_cast<bool>(just_hit),
+                        los);
+  }
+}
+
+//! The number of contiguous chunks of the ray path to search in parallel
+Size sun_path_chunks(const Size np, const Size nsuns) {
+  if (np == 0 or arts_omp_in_parallel()) return 1;
+  const Size nt = static_cast<Size>(arts_omp_get_max_threads());
+  return std::clamp<Size>((nt + nsuns - 1) / std::max<Size>(nsuns, 1), 1, np);
 }
 
+//! Two suns at the same place and of the same size have the same paths
+bool same_sun_geometry(const Sun& a, const Sun& b) {
+  return a.distance == b.distance and a.latitude == b.latitude and
+         a.longitude == b.longitude and a.radius == b.radius;
+}
+}  // namespace
+
 void ray_path_sun_pathFromPathObserver(
     const Workspace& ws,
     ArrayOfArrayOfPropagationPathPoint& ray_path_sun_path,
@@ -131,45 +185,35 @@ void ray_path_sun_pathFromPathObserver(
     const Index& just_hit) {
   ARTS_USER_ERROR_IF(angle_cut < 0.0, "angle_cut must be positive")
 
-  const Size np = ray_path.size();
+  const Size np      = ray_path.size();
+  const Size nchunks = sun_path_chunks(np, 1);
 
   ray_path_sun_path.resize(np);
-  if (arts_omp_in_parallel() and
-      static_cast<Index>(np) >= arts_omp_get_max_threads()) {
-    for (Size i = 0; i < np; ++i) {
-      sun_pathFromObserverAgenda(ws,
-                                 ray_path_sun_path[i],
-                                 surface_field,
-                                 ray_path_observer_agenda,
-                                 sun,
-                                 ray_path[i].pos,
-                                 angle_cut,
-                                 refinements,
-                                 just_hit);
-    }
-  } else {
-    String error{};
 
-#pragma omp parallel for
-    for (Size i = 0; i < np; ++i) {
-      try {
-        sun_pathFromObserverAgenda(ws,
-                                   ray_path_sun_path[i],
-                                   surface_field,
-                                   ray_path_observer_agenda,
-                                   sun,
-                                   ray_path[i].pos,
-                                   angle_cut,
-                                   refinements,
-                                   just_hit);
-      } catch (const std::exception& e) {
+  String error{};
+
+#pragma omp parallel for if (nchunks > 1)
+  for (Size c = 0; c < nchunks; ++c) {
+    try {
+      sun_paths_along(
+          ws,
+          [&](Size i) -> auto& { return ray_path_sun_path[i]; },
+          surface_field,
+          ray_path_observer_agenda,
+          ray_path,
+          sun,
+          c * np / nchunks,
+          (c + 1) * np / nchunks,
+          angle_cut,
+          refinements,
+          just_hit);
+    } catch (const std::exception& e) {
 #pragma omp critical
-        error += e.what();
-      }
+      error += e.what();
     }
-
-    ARTS_USER_ERROR_IF(error.size(), "{}", error)
   }
+
+  ARTS_USER_ERROR_IF(error.size(), "{}", error)
 }
 
 void ray_path_suns_pathFromPathObserver(
@@ -190,45 +234,53 @@ void ray_path_suns_pathFromPathObserver(
   ray_path_suns_path.resize(np);
   for (auto& p : ray_path_suns_path) p.resize(nsuns);
 
-  if (arts_omp_in_parallel() and
-      static_cast<Index>(np * nsuns) >= arts_omp_get_max_threads()) {
-    for (Size i = 0; i < np; ++i) {
-      for (Size j = 0; j < nsuns; ++j) {
-        sun_pathFromObserverAgenda(ws,
-                                   ray_path_suns_path[i][j],
-                                   surface_field,
-                                   ray_path_observer_agenda,
-                                   suns[j],
-                                   ray_path[i].pos,
-                                   angle_cut,
-                                   refinements,
-                                   just_hit);
+  //! Only search for the first of suns with the same geometry
+  std::vector<Size> same_as(nsuns);
+  for (Size j = 0; j < nsuns; ++j) {
+    same_as[j] = j;
+    for (Size k = 0; k < j; ++k) {
+      if (same_sun_geometry(suns[j], suns[k])) {
+        same_as[j] = k;
+        break;
       }
     }
-  } else {
-    String error{};
+  }
 
-#pragma omp parallel for collapse(2)
-    for (Size i = 0; i < np; ++i) {
-      for (Size j = 0; j < nsuns; ++j) {
-        try {
-          sun_pathFromObserverAgenda(ws,
-                                     ray_path_suns_path[i][j],
-                                     surface_field,
-                                     ray_path_observer_agenda,
-                                     suns[j],
-                                     ray_path[i].pos,
-                                     angle_cut,
-                                     refinements,
-                                     just_hit);
-        } catch (const std::exception& e) {
+  const Size nchunks = sun_path_chunks(np, nsuns);
+
+  String error{};
+
+#pragma omp parallel for collapse(2) if (nchunks * nsuns > 1)
+  for (Size c = 0; c < nchunks; ++c) {
+    for (Size j = 0; j < nsuns; ++j) {
+      if (same_as[j] != j) continue;
+
+      try {
+        sun_paths_along(
+            ws,
+            [&](Size i) -> auto& { return ray_path_suns_path[i][j]; },
+            surface_field,
+            ray_path_observer_agenda,
+            ray_path,
+            suns[j],
+            c * np / nchunks,
+            (c + 1) * np / nchunks,
+            angle_cut,
+            refinements,
+            just_hit);
+      } catch (const std::exception& e) {
 #pragma omp critical
-          error += e.what();
-        }
+        error += e.what();
       }
     }
+  }
 
-    ARTS_USER_ERROR_IF(error.size(), "{}", error)
+  ARTS_USER_ERROR_IF(error.size(), "{}", error)
+
+  for (auto& p : ray_path_suns_path) {
+    for (Size j = 0; j < nsuns; ++j) {
+      if (same_as[j] != j) p[j] = p[same_as[j]];
+    }
   }
 }
 
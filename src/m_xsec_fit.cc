@@ -129,13 +129,16 @@ void propagation_matrixAddXsecFit(  // WS Output:
     const Numeric current_p = force_p < 0 ? atm_point.pressure : force_p;
     const Numeric current_t = force_t < 0 ? atm_point.temperature : force_t;
 
-    // Get the absorption cross sections from the HITRAN data:
-    this_xdata.Extract(xsec_temp, f_grid, current_p, current_t);
+    // Get the absorption cross sections from the HITRAN data, the fit is
+    // shared by the frequency perturbation:
+    const XsecRecord::Prepared fit = this_xdata.Prepare(current_p, current_t);
+    fit.Extract(xsec_temp, f_grid);
     if (do_freq_jac) {
-      this_xdata.Extract(dxsec_temp_dF, dfreq, current_p, current_t);
+      fit.Extract(dxsec_temp_dF, dfreq);
     }
     if (do_temp_jac) {
-      this_xdata.Extract(dxsec_temp_dT, f_grid, current_p, current_t + dt);
+      this_xdata.Prepare(current_p, current_t + dt)
+          .Extract(dxsec_temp_dT, f_grid);
     }
 
     // Add to result variable:
@@ -21,6 +21,7 @@
 #include "invlib/map.h"
 #include "invlib/optimization.h"
 #include "jacobian.h"
+#include "oem_process_pool.h"
 
 ////////////////////////////////////////////////////////////////////////////////
 //  Type Aliases
@@ -479,16 +480,20 @@ class AgendaWrapper {
    * \param[in] arts_y Reference to the arts y WSV.
    * \param[in] inversion_iterate_agenda Pointer to the x argument of the agenda
    * execution function.
+   * \param[in] processes Number of worker processes to distribute the agenda
+   * execution over, see oem::inversion_iterate.
    */
   AgendaWrapper(const Workspace *const ws,
                 unsigned int measurement_space_dimension,
                 unsigned int state_space_dimension,
                 ::Matrix &arts_jacobian,
                 ::Vector &arts_y,
-                const Agenda *inversion_iterate_agenda)
+                const Agenda *inversion_iterate_agenda,
+                Index processes = 0)
       : m(measurement_space_dimension),
         n(state_space_dimension),
         inversion_iterate_agenda_(inversion_iterate_agenda),
+        processes_(processes),
         iteration_counter_(0),
         jacobian_(arts_jacobian),
         reuse_jacobian_((arts_jacobian.nrows() != 0) &&
@@ -520,13 +525,14 @@ class AgendaWrapper {
    */
   MatrixReference Jacobian(const Vector &xi, Vector &yi) {
     if (!reuse_jacobian_) {
-      inversion_iterate_agendaExecute(*ws_,
-                                      yi_,
-                                      jacobian_,
-                                      xi,
-                                      1,
-                                      iteration_counter_,
-                                      *inversion_iterate_agenda_);
+      inversion_iterate(*ws_,
+                        yi_,
+                        jacobian_,
+                        xi,
+                        1,
+                        iteration_counter_,
+                        *inversion_iterate_agenda_,
+                        processes_);
       yi                  = yi_;
       iteration_counter_ += 1;
     } else {
@@ -548,13 +554,14 @@ class AgendaWrapper {
   Vector evaluate(const Vector &xi) {
     if (!reuse_jacobian_) {
       Matrix dummy;
-      inversion_iterate_agendaExecute(*ws_,
-                                      yi_,
-                                      dummy,
-                                      xi,
-                                      0,
-                                      iteration_counter_,
-                                      *inversion_iterate_agenda_);
+      inversion_iterate(*ws_,
+                        yi_,
+                        dummy,
+                        xi,
+                        0,
+                        iteration_counter_,
+                        *inversion_iterate_agenda_,
+                        processes_);
     } else {
       reuse_jacobian_ = false;
     }
@@ -564,6 +571,8 @@ class AgendaWrapper {
  private:
   /** Pointer to the inversion_iterate_agenda of the workspace. */
   const Agenda *inversion_iterate_agenda_;
+  /** Number of worker processes for the agenda execution. */
+  Index processes_;
   unsigned int iteration_counter_;
   /** Reference to the jacobian WSV.*/
   MatrixReference jacobian_;
@@ -667,6 +676,8 @@ void Tensor4Clip(Tensor4 &x,
  * Checked to be 1 or 0.
  * @param display_progress Whether or not to display iteration progress. Checked
  * to be 1 or 0.
+ * @param processes Number of worker processes for the agenda execution.
+ * Checked to be non-negative.
  */
 void OEM_checks(const Workspace &ws,
                 Vector &x,
@@ -683,7 +694,8 @@ void OEM_checks(const Workspace &ws,
                 const Numeric &stop_dx,
                 const Vector &lm_ga_settings,
                 const Index &clear_matrices,
-                const Index &display_progress) {
+                const Index &display_progress,
+                const Index &processes) {
   const Index n  = xa.nelem();
   const Index m  = y.nelem();
 
@@ -740,16 +752,17 @@ void OEM_checks(const Workspace &ws,
                      "Valid options for *clear_matrices* are 0 and 1.");
   ARTS_USER_ERROR_IF(display_progress < 0 || display_progress > 1,
                      "Valid options for *display_progress* are 0 and 1.");
+  ARTS_USER_ERROR_IF(processes < 0, "The argument *processes* must be >= 0.");
 
   // If necessary compute yf and jacobian.
   if (x.nelem() == 0) {
     x = xa;
-    inversion_iterate_agendaExecute(
-        ws, yf, jacobian, xa, 1, 0, inversion_iterate_agenda);
+    oem::inversion_iterate(
+        ws, yf, jacobian, xa, 1, 0, inversion_iterate_agenda, processes);
   }
   if ((yf.nelem() == 0) || (jacobian.empty())) {
-    inversion_iterate_agendaExecute(
-        ws, yf, jacobian, x, 1, 0, inversion_iterate_agenda);
+    oem::inversion_iterate(
+        ws, yf, jacobian, x, 1, 0, inversion_iterate_agenda, processes);
   }
 }
 
@@ -0,0 +1,352 @@
+#include "oem_process_pool.h"
+
+#include <arts_omp.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include "callback.h"
+#include "debug.h"
+#include "workspace_agenda_class.h"
+#include "workspace_method_class.h"
+
+#ifndef _WIN32
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+namespace oem {
+std::vector<std::pair<Size, Size>> measurement_groups(
+    const ArrayOfSensorObsel& measurement_sensor, Index processes) {
+  const Size m = measurement_sensor.size();
+
+  //! Runs of elements that share the same simulations
+  std::vector<std::pair<Size, Size>> runs;
+  for (Size i = 0; i < m; i++) {
+    if (runs.empty() or
+        not(measurement_sensor[i].same_freqs(
+                measurement_sensor[runs.back().first]) and
+            measurement_sensor[i].same_poslos(
+                measurement_sensor[runs.back().first]))) {
+      runs.emplace_back(i, i + 1);
+    } else {
+      runs.back().second = i + 1;
+    }
+  }
+
+  const Size n = std::max<Size>(1, static_cast<Size>(processes));
+  if (runs.size() <= n) return runs;
+
+  //! Merge runs until each group holds about m / n elements
+  std::vector<std::pair<Size, Size>> groups;
+  const Size target = (m + n - 1) / n;
+  for (auto& run : runs) {
+    if (groups.empty() or
+        (groups.back().second - groups.back().first >= target and
+         groups.size() < n)) {
+      groups.push_back(run);
+    } else {
+      groups.back().second = run.second;
+    }
+  }
+
+  return groups;
+}
+
+#ifndef _WIN32
+namespace {
+void write_all(int fd, const void* data, std::size_t n) {
+  const char* ptr = static_cast<const char*>(data);
+  while (n > 0) {
+    const ssize_t k = ::write(fd, ptr, n);
+    if (k < 0) {
+      if (errno == EINTR) continue;
+      ::_exit(EXIT_FAILURE);
+    }
+    ptr += k;
+    n   -= static_cast<std::size_t>(k);
+  }
+}
+
+bool read_all(int fd, void* data, std::size_t n) {
+  char* ptr = static_cast<char*>(data);
+  while (n > 0) {
+    const ssize_t k = ::read(fd, ptr, n);
+    if (k < 0 and errno == EINTR) continue;
+    if (k <= 0) return false;
+    ptr += k;
+    n   -= static_cast<std::size_t>(k);
+  }
+  return true;
+}
+
+[[noreturn]] void report_error(int fd, const std::string& msg) {
+  const std::int64_t status = 1;
+  const std::int64_t n      = msg.size();
+  write_all(fd, &status, sizeof(status));
+  write_all(fd, &n, sizeof(n));
+  write_all(fd, msg.data(), msg.size());
+  ::close(fd);
+  ::_exit(EXIT_FAILURE);
+}
+
+/** The worker part of the pool, never returns
+ *
+ * The message to the parent is a status flag followed by either the error
+ * message or the shape and data of the computed slices.
+ */
+[[noreturn]] void worker(int fd,
+                         const Workspace& ws,
+                         const ArrayOfSensorObsel& sensor,
+                         const std::pair<Size, Size>& group,
+                         const Vector& model_state_vector,
+                         const Index do_jacobian,
+                         const Index counter,
+                         const Agenda& inversion_iterate_agenda) try {
+  //! The OpenMP thread pool of the parent does not exist here
+  arts_omp_set_num_threads(1);
+
+  Workspace local = ws;
+  local.set("measurement_sensor",
+            ArrayOfSensorObsel(sensor.begin() + group.first,
+                               sensor.begin() + group.second));
+
+  Vector y;
+  Matrix jacobian;
+  inversion_iterate_agendaExecute(local,
+                                  y,
+                                  jacobian,
+                                  model_state_vector,
+                                  do_jacobian,
+                                  counter,
+                                  inversion_iterate_agenda);
+
+  const std::int64_t status = 0;
+  const std::array<std::int64_t, 3> shape{
+      y.size(), jacobian.nrows(), jacobian.ncols()};
+  write_all(fd, &status, sizeof(status));
+  write_all(fd, shape.data(), sizeof(shape));
+  write_all(fd, y.data_handle(), sizeof(Numeric) * y.size());
+  write_all(fd, jacobian.data_handle(), sizeof(Numeric) * jacobian.size());
+  ::close(fd);
+  ::_exit(EXIT_SUCCESS);
+} catch (std::exception& e) {
+  report_error(fd, e.what());
+} catch (...) {
+  report_error(fd, "Unknown error");
+}
+
+bool has_callback(const Agenda& agenda) {
+  return std::ranges::any_of(agenda.get_methods(), [](const Method& m) {
+    return m.get_setval() and m.get_setval()->holds<CallbackOperator>();
+  });
+}
+
+//! Whether any agenda that the workers may run contains a callback
+bool has_callback(const Workspace& ws, const Agenda& agenda) {
+  if (has_callback(agenda)) return true;
+
+  for (auto& var : ws) {
+    const Wsv& wsv = var.second;
+    if (wsv.holds<Agenda>() and has_callback(wsv.get_unsafe<Agenda>())) {
+      return true;
+    }
+
+    if (wsv.holds<ArrayOfAgenda>() and
+        std::ranges::any_of(wsv.get_unsafe<ArrayOfAgenda>(),
+                            [](const Agenda& a) { return has_callback(a); })) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+//! Close the pipes and wait for the workers, ignoring any failures
+void reap(const std::vector<pid_t>& pids, const std::vector<int>& fds) {
+  for (auto fd : fds) {
+    if (fd >= 0) ::close(fd);
+  }
+
+  for (auto pid : pids) {
+    if (pid <= 0) continue;
+    int wstatus = 0;
+    while (::waitpid(pid, &wstatus, 0) < 0 and errno == EINTR) {
+    }
+  }
+}
+}  // namespace
+#endif
+
+void inversion_iterate(const Workspace& ws,
+                       Vector& measurement_vector_fitted,
+                       Matrix& measurement_jacobian,
+                       const Vector& model_state_vector,
+                       const Index do_jacobian,
+                       const Index counter,
+                       const Agenda& inversion_iterate_agenda,
+                       const Index processes) try {
+  const auto serial = [&]() {
+    inversion_iterate_agendaExecute(ws,
+                                    measurement_vector_fitted,
+                                    measurement_jacobian,
+                                    model_state_vector,
+                                    do_jacobian,
+                                    counter,
+                                    inversion_iterate_agenda);
+  };
+
+  if (processes < 2 or not ws.contains("measurement_sensor")) {
+    return serial();
+  }
+
+#ifdef _WIN32
+  ARTS_USER_ERROR("Distributed OEM over processes is not supported on Windows")
+#else
+  const auto& sensor =
+      ws.get<ArrayOfSensorObsel>("measurement_sensor");
+  const auto groups = measurement_groups(sensor, processes);
+  if (groups.size() < 2) return serial();
+
+  ARTS_USER_ERROR_IF(arts_omp_in_parallel(),
+                     "Cannot fork worker processes from a parallel region")
+  ARTS_USER_ERROR_IF(has_callback(ws, inversion_iterate_agenda), R"(
+Cannot distribute an agenda with callbacks over processes.
+
+The callbacks would run in the workers, where the Python interpreter of the
+parent cannot be used, and anything they change would be lost.  Use a single
+process or remove the callbacks.
+)")
+
+  std::vector<pid_t> pids(groups.size(), -1);
+  std::vector<int> fds(groups.size(), -1);
+  for (Size i = 0; i < groups.size(); i++) {
+    int pipefd[2];
+    if (::pipe(pipefd) != 0) {
+      const int err = errno;
+      reap(pids, fds);
+      ARTS_USER_ERROR("Cannot create pipe: {}", std::strerror(err))
+    }
+
+    const pid_t pid = ::fork();
+    if (pid < 0) {
+      const int err = errno;
+      ::close(pipefd[0]);
+      ::close(pipefd[1]);
+      reap(pids, fds);
+      ARTS_USER_ERROR("Cannot fork: {}", std::strerror(err))
+    }
+
+    if (pid == 0) {
+      ::close(pipefd[0]);
+      for (Size j = 0; j < i; j++) ::close(fds[j]);
+      worker(pipefd[1],
+             ws,
+             sensor,
+             groups[i],
+             model_state_vector,
+             do_jacobian,
+             counter,
+             inversion_iterate_agenda);
+    }
+
+    ::close(pipefd[1]);
+    pids[i] = pid;
+    fds[i]  = pipefd[0];
+  }
+
+  //! Gather the results in order, collecting all errors before throwing
+  const Size m = sensor.size();
+  Index ncols  = -1;
+  std::string errors;
+
+  const auto gather = [&](const Size i) -> std::string {
+    const Index first = static_cast<Index>(groups[i].first);
+    const Index ny    = static_cast<Index>(groups[i].second) - first;
+    const int fd      = fds[i];
+
+    std::int64_t status = 1;
+    if (not read_all(fd, &status, sizeof(status))) {
+      return std::format("Worker {} died without reporting\n", i);
+    }
+
+    if (status != 0) {
+      std::int64_t n = 0;
+      std::string msg;
+      if (read_all(fd, &n, sizeof(n))) {
+        msg.resize(static_cast<std::size_t>(n));
+        if (not read_all(fd, msg.data(), msg.size())) msg = "(truncated)";
+      }
+      return std::format("Worker {} failed:\n{}\n", i, msg);
+    }
+
+    std::array<std::int64_t, 3> shape{};
+    if (not read_all(fd, shape.data(), sizeof(shape))) {
+      return std::format("Worker {} died while reporting\n", i);
+    }
+
+    if (shape[0] != ny or (shape[1] != 0 and shape[1] != ny)) {
+      return std::format(
+          "Worker {} computed {} measurement values and {} Jacobian rows but expected {}\n",
+          i,
+          shape[0],
+          shape[1],
+          ny);
+    }
+
+    if (not read_all(fd,
+                     measurement_vector_fitted[Range(first, ny)].data_handle(),
+                     sizeof(Numeric) * ny)) {
+      return std::format("Worker {} died while reporting\n", i);
+    }
+
+    if (shape[1] == 0) return {};
+
+    if (ncols < 0) {
+      ncols = shape[2];
+      measurement_jacobian.resize(static_cast<Index>(m), ncols);
+    }
+
+    if (ncols != shape[2]) {
+      return std::format(
+          "Worker {} computed {} Jacobian columns but expected {}\n",
+          i,
+          shape[2],
+          ncols);
+    }
+
+    if (not read_all(fd,
+                     measurement_jacobian[Range(first, ny)].data_handle(),
+                     sizeof(Numeric) * ny * ncols)) {
+      return std::format("Worker {} died while reporting\n", i);
+    }
+
+    return {};
+  };
+
+  try {
+    measurement_vector_fitted.resize(static_cast<Index>(m));
+    for (Size i = 0; i < groups.size(); i++) {
+      errors += gather(i);
+      ::close(fds[i]);
+      fds[i] = -1;
+    }
+  } catch (...) {
+    reap(pids, fds);
+    throw;
+  }
+
+  reap(pids, fds);
+
+  ARTS_USER_ERROR_IF(not errors.empty(), "{}", errors)
+
+  if (ncols < 0) measurement_jacobian.resize(0, 0);
+#endif
+}
+ARTS_METHOD_ERROR_CATCH
+}  // namespace oem
@@ -0,0 +1,67 @@
+/**
+  @file   oem_process_pool.h
+
+  @brief Distributes the OEM forward model over a pool of local processes.
+
+  The measurement vector is split into groups of consecutive sensor elements
+  that share both frequency grid and position/line-of-sight grid, so that no
+  radiative transfer simulation is repeated between workers.  Each worker is a
+  forked copy of the current process that runs inversion_iterate_agenda with
+  its own slice of measurement_sensor.  The slices of the measurement
+  vector and the Jacobian are gathered by the parent process in order.
+
+  Only the forking thread exists in a worker.  The workers therefore never
+  start OpenMP threads, as the thread pool of the parent is gone, and never
+  run Python callbacks, as the interpreter of the parent cannot be used.
+  Agendas with callbacks are rejected before forking, and forking from inside
+  a parallel region is an error.
+*/
+
+#pragma once
+
+#include <workspace.h>
+
+#include <utility>
+#include <vector>
+
+namespace oem {
+/** Split the sensor into groups to be computed by independent workers
+ *
+ * Consecutive elements sharing frequency and position/line-of-sight grids
+ * are never split.  The resulting groups are merged into at most
+ * `processes` contiguous ranges with roughly equal number of elements.
+ *
+ * @param[in] measurement_sensor The sensor elements
+ * @param[in] processes The maximum number of groups
+ * @return The [first, last) element ranges of each group, in order
+ */
+std::vector<std::pair<Size, Size>> measurement_groups(
+    const ArrayOfSensorObsel& measurement_sensor, Index processes);
+
+/** Execute inversion_iterate_agenda, possibly distributed over processes
+ *
+ * If processes is less than 2, or if the sensor cannot be split, this is the
+ * same as calling inversion_iterate_agendaExecute.  Otherwise, each worker
+ * process computes the measurement vector and Jacobian rows of its sensor
+ * group, and these are gathered into the output.  Each worker runs a single
+ * OpenMP thread.  The agenda, and every agenda of the workspace, may not
+ * contain callbacks, as their side effects would be lost.
+ *
+ * @param[in] ws The workspace, must hold measurement_sensor for distribution
+ * @param[out] measurement_vector_fitted As inversion_iterate_agenda
+ * @param[inout] measurement_jacobian As inversion_iterate_agenda
+ * @param[in] model_state_vector As inversion_iterate_agenda
+ * @param[in] do_jacobian As inversion_iterate_agenda
+ * @param[in] counter As inversion_iterate_agenda
+ * @param[in] inversion_iterate_agenda The agenda
+ * @param[in] processes The number of worker processes
+ */
+void inversion_iterate(const Workspace& ws,
+                       Vector& measurement_vector_fitted,
+                       Matrix& measurement_jacobian,
+                       const Vector& model_state_vector,
+                       const Index do_jacobian,
+                       const Index counter,
+                       const Agenda& inversion_iterate_agenda,
+                       const Index processes);
+}  // namespace oem
@@ -1,11 +1,70 @@
 #include <arts_omp.h>
 #include <debug.h>
 #include <fwd.h>
+#include <nanobind/ndarray.h>
+#include <nanobind/stl/optional.h>
 #include <python_interface.h>
 
+#include <algorithm>
+#include <optional>
+#include <vector>
+
 #include "hpy_arts.h"
 
 namespace Python {
+namespace {
+using freq_nd =
+    py::ndarray<py::numpy, const Numeric, py::ndim<1>, py::c_contig>;
+using pos_nd =
+    py::ndarray<py::numpy, const Numeric, py::shape<-1, 3>, py::c_contig>;
+using los_nd =
+    py::ndarray<py::numpy, const Numeric, py::shape<-1, 2>, py::c_contig>;
+using out_nd =
+    py::ndarray<py::numpy, Numeric, py::shape<-1, -1, 4>, py::c_contig>;
+
+//! Writes the radiance of all geometries and frequencies, must not use Python
+void geometric_planar_batch(Numeric* out,
+                            const SpectralRadianceOperator& srad_op,
+                            const Numeric* freq,
+                            const Numeric* pos,
+                            const Numeric* los,
+                            const Index npos,
+                            const Index nfreq) {
+  std::vector<std::vector<fwd::path>> paths(npos);
+  String error{};
+
+#pragma omp parallel for if (not arts_omp_in_parallel())
+  for (Index i = 0; i < npos; i++) {
+    try {
+      paths[i] = srad_op.geometric_planar(
+          {pos[3 * i], pos[3 * i + 1], pos[3 * i + 2]},
+          {los[2 * i], los[2 * i + 1]});
+    } catch (std::exception& e) {
+#pragma omp critical
+      error += e.what() + String{"\n"};
+    }
+  }
+
+  ARTS_USER_ERROR_IF(not error.empty(), "{}", error)
+
+#pragma omp parallel for collapse(2) schedule(dynamic) \
+    if (not arts_omp_in_parallel())
+  for (Index i = 0; i < npos; i++) {
+    for (Index j = 0; j < nfreq; j++) {
+      try {
+        const Stokvec x = srad_op(freq[j], paths[i]);
+        std::ranges::copy(x.data, out + 4 * (i * nfreq + j));
+      } catch (std::exception& e) {
+#pragma omp critical
+        error += e.what() + String{"\n"};
+      }
+    }
+  }
+
+  ARTS_USER_ERROR_IF(not error.empty(), "{}", error)
+}
+}  // namespace
+
 void py_fwd(py::module_& m) try {
   py::class_<SpectralRadianceOperator> sro(m, "SpectralRadianceOperator");
   workspace_group_interface(sro);
@@ -21,7 +80,8 @@ void py_fwd(py::module_& m) try {
          "freq"_a,
          "pos"_a,
          "los"_a,
-         "Geometric planar spectral radiance")
+         "Geometric planar spectral radiance",
+         py::call_guard<py::gil_scoped_release>())
       .def(
           "geometric_planar",
           [](const SpectralRadianceOperator& srad_op,
@@ -58,7 +118,102 @@ void py_fwd(py::module_& m) try {
           "freq"_a,
           "pos"_a,
           "los"_a,
-          "Geometric planar spectral radiance")
+          "Geometric planar spectral radiance",
+          py::call_guard<py::gil_scoped_release>())
+      .def(
+          "geometric_planar_batch",
+          [](const SpectralRadianceOperator& srad_op,
+             const freq_nd& freq,
+             const pos_nd& pos,
+             const los_nd& los,
+             std::optional<out_nd> out) {
+            const Index nfreq = static_cast<Index>(freq.shape(0));
+            const Index npos  = static_cast<Index>(pos.shape(0));
+
+            ARTS_USER_ERROR_IF(static_cast<Index>(los.shape(0)) != npos,
+                               "Got {} positions but {} lines of sight",
+                               npos,
+                               los.shape(0))
+
+            if (out) {
+              ARTS_USER_ERROR_IF(
+                  static_cast<Index>(out->shape(0)) != npos or
+                      static_cast<Index>(out->shape(1)) != nfreq,
+                  "Output must have shape ({}, {}, 4), got ({}, {}, 4)",
+                  npos,
+                  nfreq,
+                  out->shape(0),
+                  out->shape(1))
+            } else {
+              auto* data = new Numeric[npos * nfreq * 4]{};
+              py::capsule owner(data, [](void* p) noexcept {
+                delete[] static_cast<Numeric*>(p);
+              });
+              const std::array<size_t, 3> shape{static_cast<size_t>(npos),
+                                                static_cast<size_t>(nfreq),
+                                                4};
+              out.emplace(data, 3, shape.data(), owner);
+            }
+
+            {
+              py::gil_scoped_release release;
+              geometric_planar_batch(out->data(),
+                                     srad_op,
+                                     freq.data(),
+                                     pos.data(),
+                                     los.data(),
+                                     npos,
+                                     nfreq);
+            }
+
+            return *out;
+          },
+          "freq"_a,
+          "pos"_a,
+          "los"_a,
+          "out"_a.noconvert().none() = py::none(),
+          R"--(Geometric planar spectral radiance of many geometries at once
+
+The Python global interpreter lock is released during the computations, which
+run in parallel over all geometries and frequencies.  Other Python threads may
+compute with the same operator meanwhile, but must not modify it, e.g., by
+:meth:`bake` or :meth:`set_continuum_cache`.  This is not supported.
+
+Parameters
+----------
+freq : numpy.ndarray
+    The frequencies, shape (F,)
+pos : numpy.ndarray
+    The positions [alt, lat, lon], shape (N, 3)
+los : numpy.ndarray
+    The lines of sight [zenith, azimuth], shape (N, 2)
+out : numpy.ndarray, optional
+    C-contiguous float64 array of shape (N, F, 4) to write into.  A new one is
+    created if not given.
+
+Returns
+-------
+out : numpy.ndarray
+    The spectral radiance of shape (N, F, 4)
+)--")
+      .def("set_continuum_cache",
+           &SpectralRadianceOperator::set_continuum_cache,
+           "range"_a,
+           "tolerance"_a,
+           "start_nodes"_a = 33,
+           "Interpolate CIA and predefined absorption inside the range")
+      .def("set_wind_shift",
+           &SpectralRadianceOperator::set_wind_shift,
+           "on"_a,
+           "Doppler shift the absorption of the nodes by their wind")
+      .def("bake",
+           &SpectralRadianceOperator::bake,
+           "frequency_grid"_a,
+           R"--(Tabulate the absorption of all nodes on the frequency grid
+
+This modifies the operator, so it keeps the Python global interpreter lock.
+Modifying an operator while other threads compute with it is not supported.
+)--")
       .def_prop_ro("altitude",
                    &SpectralRadianceOperator::altitude,
                    "The altitude of the top of the atmosphere [m]");
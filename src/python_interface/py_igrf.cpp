@@ -4,7 +4,9 @@
 namespace Python {
 void py_igrf(py::module_& m) try {
   m.def("igrf",
-        &IGRF::igrf,
+        [](const Vector3 pos, const Vector2 ell, const Time& t) {
+          return IGRF::igrf(pos, ell, t);
+        },
         "pos"_a,
         "ell"_a = Vector2{6378137.0, 6356752.314245},
         "t"_a   = Time{},
@@ -23,6 +25,29 @@ ell : Vector2, optional
 t : Time, optional
     A time stamp, default is the current time
 )--");
+
+  m.def("igrf",
+        [](const ArrayOfVector3& pos, const Vector2 ell, const Time& t) {
+          return IGRF::igrf(pos, ell, t);
+        },
+        "pos"_a,
+        "ell"_a = Vector2{6378137.0, 6356752.314245},
+        "t"_a   = Time{},
+        R"--(Compute the magnetic field according to IGRF along a path
+
+As for a single position, but the coefficients are only computed once and
+the longitude terms are shared by neighboring positions of the same
+longitude.
+
+Parameters
+----------
+pos : ArrayOfVector3
+    The positions in [alt, lat, lon] (geodetic)
+ell : Vector2, optional
+    The ellipsoid (a, b), default is WGS84 [6378137.0, 6356752.314245]
+t : Time, optional
+    A time stamp, default is the current time
+)--");
 } catch (std::exception& e) {
   throw std::runtime_error(
       var_string("DEV ERROR:\nCannot initialize IGRF\n", e.what()));
@@ -485,6 +485,16 @@ T0 : float
 
   py::class_<LinemixingEcsData> led(m, "LinemixingEcsData");
   workspace_group_interface(led);
+  led.def_prop_ro(
+      "table_errors",
+      [](const LinemixingEcsData& ecs_data) {
+        std::unordered_map<QuantumIdentifier, std::pair<Numeric, Numeric>> out;
+        for (auto& [key, table] : ecs_data.tables) {
+          out[key] = {table.str_error, table.val_error};
+        }
+        return out;
+      },
+      "The relative errors of equivalent line strengths and values of tabulated bands");
 
   lbl.def(
       "equivalent_lines",
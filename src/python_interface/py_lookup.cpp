@@ -31,6 +31,16 @@ void py_lookup(py::module_& m) try {
   alt.def_rw("xsec",
              &AbsorptionLookupTable::xsec,
              "The absorption cross section table");
+  alt.def_prop_ro(
+      "band_ranges",
+      [](const AbsorptionLookupTable& lt) {
+        py::dict out;
+        for (auto& [key, range] : lt.band_ranges) {
+          out[py::cast(key)] = py::cast(range);
+        }
+        return out;
+      },
+      "The bands that contributed to the table, with the frequency range they affect in Hz");
 
   auto alts = py::bind_map<AbsorptionLookupTables>(m, "AbsorptionLookupTables");
   workspace_group_interface(alts);
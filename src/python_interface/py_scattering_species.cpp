@@ -246,8 +246,56 @@ void py_scattering_species(py::module_ &m) try {  //
     scattering::BulkScatteringProperties<scattering::Format::ARO, scattering::Representation::Gridded, 4>
     >;
 
-  py::class_<MGDSingleMoment>(m, "MGDSingleMoment");
-  py::class_<ScatteringHabit>(m, "ScatteringHabit");
+  py::class_<MGDSingleMoment>(m, "MGDSingleMoment")
+    .def(py::init<ScatteringSpeciesProperty, std::string, Numeric, Numeric, bool>(),
+         "moment"_a,
+         "name"_a,
+         "t_min"_a,
+         "t_max"_a,
+         "picky"_a = false)
+    .def(py::init<ScatteringSpeciesProperty, Numeric, Numeric, Numeric, Numeric, Numeric, Numeric, bool>(),
+         "moment"_a,
+         "n_alpha"_a,
+         "n_b"_a,
+         "mu"_a,
+         "gamma"_a,
+         "t_min"_a,
+         "t_max"_a,
+         "picky"_a = false);
+
+  py::class_<scattering::ScatteringDataSpec>(m, "ScatteringDataSpec")
+    .def(py::init<std::shared_ptr<const Vector>,
+                  std::shared_ptr<const Vector>,
+                  std::shared_ptr<const scattering::ZenithAngleGrid>>(),
+         "t_grid"_a,
+         "f_grid"_a,
+         "za_scat_grid"_a)
+    .def_rw("t_grid", &scattering::ScatteringDataSpec::t_grid)
+    .def_rw("f_grid", &scattering::ScatteringDataSpec::f_grid)
+    .def_rw("za_scat_grid", &scattering::ScatteringDataSpec::za_scat_grid);
+
+  py::class_<ScatteringHabit>(m, "ScatteringHabit")
+    .def(py::init<>())
+    .def(py::init<ParticleHabit, PSD, ParticulateProperty>(),
+         "particle_habit"_a,
+         "psd"_a,
+         "size_parameter"_a = ParticulateProperty::DVeq)
+    .def("prepare_scattering_data", &ScatteringHabit::prepare_scattering_data, "spec"_a)
+    .def_prop_ro("is_prepared", &ScatteringHabit::is_prepared)
+    .def("particle_number_density", &ScatteringHabit::particle_number_density, "atm_point"_a)
+    .def("get_bulk_scattering_properties_tro_gridded",
+         [](const ScatteringHabit& habit,
+            const AtmPoint& atm_point,
+            const Vector& f_grid,
+            std::shared_ptr<scattering::ZenithAngleGrid> za_grid,
+            const Index stokes_dim) {
+           if (stokes_dim == 1) return BulkScatteringPropertiesTROGridded{habit.get_bulk_scattering_properties_tro_gridded<1>(atm_point, f_grid, za_grid)};
+           if (stokes_dim == 2) return BulkScatteringPropertiesTROGridded{habit.get_bulk_scattering_properties_tro_gridded<2>(atm_point, f_grid, za_grid)};
+           if (stokes_dim == 3) return BulkScatteringPropertiesTROGridded{habit.get_bulk_scattering_properties_tro_gridded<3>(atm_point, f_grid, za_grid)};
+           if (stokes_dim == 4) return BulkScatteringPropertiesTROGridded{habit.get_bulk_scattering_properties_tro_gridded<4>(atm_point, f_grid, za_grid)};
+           throw std::runtime_error("Stokes dim must be one of 1, 2, 3, or 4.");
+         })
+    .def("__str__", [](const ScatteringHabit& habit) { return var_string(habit); });
   py::class_<HenyeyGreensteinScatterer>(m, "HenyeyGreensteinScatterer")
     .def(py::init<>())
     .def(py::init<ScatteringSpeciesProperty, ScatteringSpeciesProperty, Numeric>())
@@ -299,6 +347,7 @@ void py_scattering_species(py::module_ &m) try {  //
   aoss
     .def(py::init<>())
     .def("add", &ArrayOfScatteringSpecies::add)
+    .def("prepare_scattering_data", &ArrayOfScatteringSpecies::prepare_scattering_data, "spec"_a)
     .def("get_bulk_scattering_properties_tro_spectral",
          [](const ArrayOfScatteringSpecies& aoss,
             const AtmPoint& atm_point,
@@ -3,6 +3,8 @@
 #include <path_point.h>
 #include <surf.h>
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <iomanip>
 #include <limits>
@@ -203,17 +205,28 @@ std::pair<Numeric, bool> beta_angle(const Workspace& ws,
   return {Conversion::rad2deg(beta), hit};
 }
 
-void find_sun_path(const Workspace& ws,
-                   ArrayOfPropagationPathPoint& sun_path,
-                   const Sun& sun,
-                   const Agenda& ray_path_observer_agenda,
-                   const SurfaceField& surface_field,
-                   const Vector3 observer_pos,
-                   const Numeric angle_cut,
-                   const Index count_limit,
-                   const bool just_hit) {
-  using Conversion::rad2deg;
-
+namespace {
+//! Signed [za, aa] offset from the line-of-sight of the space-facing path point to the sun center
+Vector2 sun_offset(const PropagationPathPoint& space_point,
+                   const Vector3& sun_pos,
+                   const Vector2& ell) {
+  const Vector2 to_sun = geometric_los(space_point.pos, sun_pos, ell);
+  const Vector2 los    = path::mirror(space_point.los);
+  return {to_sun[0] - los[0], std::remainder(to_sun[1] - los[1], 360.0)};
+}
+}  // namespace
+
+Vector2 find_sun_path(const Workspace& ws,
+                      ArrayOfPropagationPathPoint& sun_path,
+                      const Sun& sun,
+                      const Agenda& ray_path_observer_agenda,
+                      const SurfaceField& surface_field,
+                      const Vector3 observer_pos,
+                      const Numeric angle_cut,
+                      const Index count_limit,
+                      const bool just_hit,
+                      const std::optional<Vector2>& initial_los,
+                      const Index secant_steps) {
   ARTS_ASSERT(angle_cut >= 0.0)
 
   const Vector3 sun_pos{
@@ -221,117 +234,108 @@ void find_sun_path(const Workspace& ws,
                           SurfaceKey::h, observer_pos[1], observer_pos[2]),
        sun.latitude,
        sun.longitude}};
-  auto los = geometric_los(observer_pos, sun_pos, surface_field.ellipsoid);
-  auto best_los = los;
 
+  ArrayOfPropagationPathPoint best_path;
+  Vector2 best_los{};
   Numeric best_beta = 360;
-  Numeric fac = 1.0;
+  bool done         = false;
+
+  //! Computes the path at los, keeps it if it is better than the best so far
+  const auto improves = [&](Vector2 los) {
+    los[0] = std::clamp(los[0], 0.0, 180.0);
 
-  //! Startup close to (?) target
-  {
     const auto [beta, hit] = beta_angle(ws,
                                         sun_path,
                                         sun,
                                         observer_pos,
-                                        best_los,
+                                        los,
                                         ray_path_observer_agenda,
                                         surface_field,
                                         angle_cut);
 
-    if (hit and just_hit) return;
-    if (beta < best_beta) {
-      best_beta = beta;
-      best_los = los;
+    done = hit and just_hit;
+    if (not done and beta >= best_beta) return false;
+
+    best_beta = beta;
+    best_los  = los;
+    std::swap(best_path, sun_path);
+    return true;
+  };
+
+  const auto finish = [&]() {
+    sun_path = std::move(best_path);
+    return best_los;
+  };
+
+  //! Startup at the geometric line-of-sight and at the warm start, if any
+  improves(geometric_los(observer_pos, sun_pos, surface_field.ellipsoid));
+  if (done) return finish();
+  if (initial_los.has_value()) {
+    improves(*initial_los);
+    if (done) return finish();
+  }
+
+  //! Secant (Broyden) steps, the Jacobian of the offset starts as -1 since the space-facing line-of-sight mostly follows the observer
+  std::array<Numeric, 4> J{-1.0, 0.0, 0.0, -1.0};
+  Vector2 off = sun_offset(best_path.back(), sun_pos, surface_field.ellipsoid);
+  for (Index i = 0; i < secant_steps and best_beta >= angle_cut; i++) {
+    const Numeric det = J[0] * J[3] - J[1] * J[2];
+    if (det == 0.0) break;
+
+    const Vector2 prev_los = best_los;
+    if (not improves({prev_los[0] - (J[3] * off[0] - J[1] * off[1]) / det,
+                      prev_los[1] - (J[0] * off[1] - J[2] * off[0]) / det})) {
+      break;
     }
+    if (done) return finish();
+
+    const Vector2 new_off =
+        sun_offset(best_path.back(), sun_pos, surface_field.ellipsoid);
+    const Numeric ds0 = best_los[0] - prev_los[0];
+    const Numeric ds1 = best_los[1] - prev_los[1];
+    const Numeric ds2 = ds0 * ds0 + ds1 * ds1;
+    if (ds2 == 0.0) break;
+
+    const Numeric r0 = new_off[0] - off[0] - (J[0] * ds0 + J[1] * ds1);
+    const Numeric r1 = new_off[1] - off[1] - (J[2] * ds0 + J[3] * ds1);
+    J[0] += r0 * ds0 / ds2;
+    J[1] += r0 * ds1 / ds2;
+    J[2] += r1 * ds0 / ds2;
+    J[3] += r1 * ds1 / ds2;
+    off   = new_off;
   }
 
+  //! Probe up, down, left, and right with decreasing step if the secant steps stall
+  Numeric fac = 1.0;
   Index count = 0;
-  do {
-    if (best_beta < angle_cut) return;
-
-    {
-      los = best_los;
-      los[0] = std::clamp(los[0] + fac * best_beta, 0.0, 180.0);
-      const auto [beta, hit] = beta_angle(ws,
-                                          sun_path,
-                                          sun,
-                                          observer_pos,
-                                          los,
-                                          ray_path_observer_agenda,
-                                          surface_field,
-                                          angle_cut);
-
-      if (hit and just_hit) return;
-      if (beta < best_beta) {
-        best_beta = beta;
-        best_los = los;
-        continue;
-      }
+  while (best_beta >= angle_cut) {
+    const Vector2 los = best_los;
+    const Numeric d   = fac * best_beta;
+
+    if (improves({los[0] + d, los[1]})) {
+      if (done) return finish();
+      continue;
     }
 
-    {
-      los = best_los;
-      los[0] = std::clamp(los[0] - fac * best_beta, 0.0, 180.0);
-      const auto [beta, hit] = beta_angle(ws,
-                                          sun_path,
-                                          sun,
-                                          observer_pos,
-                                          los,
-                                          ray_path_observer_agenda,
-                                          surface_field,
-                                          angle_cut);
-
-      if (hit and just_hit) return;
-      if (beta < best_beta) {
-        best_beta = beta;
-        best_los = los;
-        continue;
-      }
+    if (improves({los[0] - d, los[1]})) {
+      if (done) return finish();
+      continue;
     }
 
-    {
-      los = best_los;
-      los[1] += fac * best_beta;
-      const auto [beta, hit] = beta_angle(ws,
-                                          sun_path,
-                                          sun,
-                                          observer_pos,
-                                          los,
-                                          ray_path_observer_agenda,
-                                          surface_field,
-                                          angle_cut);
-
-      if (hit and just_hit) return;
-      if (beta < best_beta) {
-        best_beta = beta;
-        best_los = los;
-        continue;
-      }
+    if (improves({los[0], los[1] + d})) {
+      if (done) return finish();
+      continue;
     }
 
-    {
-      los = best_los;
-      los[1] -= fac * best_beta;
-      const auto [beta, hit] = beta_angle(ws,
-                                          sun_path,
-                                          sun,
-                                          observer_pos,
-                                          los,
-                                          ray_path_observer_agenda,
-                                          surface_field,
-                                          angle_cut);
-
-      if (hit and just_hit) return;
-      if (beta < best_beta) {
-        best_beta = beta;
-        best_los = los;
-        continue;
-      }
+    if (improves({los[0], los[1] - d})) {
+      if (done) return finish();
+      continue;
     }
 
     count++;
     fac *= 0.5;
-    if (count < count_limit) continue;
-    break;
-  } while (true);
+    if (count >= count_limit) break;
+  }
+
+  return finish();
 }
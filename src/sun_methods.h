@@ -2,6 +2,8 @@
 
 #include <sun.h>
 
+#include <optional>
+
 class Agenda;
 class Workspace;
 
@@ -41,16 +43,19 @@ void get_scattered_sunsource(const Workspace& ws,
  *
  * Computes the angular offset between the observer and the sun, and returns the
  * the path in output parameter.  The algorithm first checks the path to the sun
- * as if it was geometric.  It then proceeds to look up, down, left, and right,
- * using a multiple of the angular offset from the sun based on the space-facing
- * point in the ray path.
+ * as if it was geometric, and the initial line-of-sight if one is given.  The
+ * best of these is improved by secant (Broyden) steps using the signed offset
+ * of the space-facing point in the ray path from the sun.  If these stall, it
+ * then proceeds to look up, down, left, and right, using a multiple of the
+ * angular offset from the sun based on the space-facing point in the ray path.
  *
  * This multiple starts a 1x the angular offset and is decreased by a factor of
  * 0.5 per level of refinement.  So a refinement of 2 would look at 1x, 0.5x, and
  * then return. Of 3 would look at 1x, 0.5x, 0.25x, and then return.
  *
  * Two other speed-up parameters are provided.  The first is the angle_cut, which
- * stops the calculations if the angular offset to the sun is larger than 
+ * stops the calculations if the angular offset to the sun is smaller than it.
+ * The second is just_hit, which stops the calculations when the sun is hit.
  * 
  * @param[in] ws ARTS workspace
  * @param[out] sun_path A path to the sun.
@@ -61,16 +66,21 @@ void get_scattered_sunsource(const Workspace& ws,
  * @param[in] angle_cut Angular cutoff to return the path, see above.
  * @param[in] refinements Refinements of the resolution, see above.
  * @param[in] just_hit If true, exits the moment a sun is hit.
+ * @param[in] initial_los A warm start, e.g., the solution of a nearby observer.
+ * @param[in] secant_steps The maximum number of secant steps, 0 only probes.
+ * @return The observer line-of-sight of sun_path.
  */
-void find_sun_path(const Workspace& ws,
-                   ArrayOfPropagationPathPoint& sun_path,
-                   const Sun& sun,
-                   const Agenda& ray_path_observer_agenda,
-                   const SurfaceField& surface_field,
-                   const Vector3 observer_pos,
-                   const Numeric angle_cut,
-                   const Index refinements,
-                   const bool just_hit);
+Vector2 find_sun_path(const Workspace& ws,
+                      ArrayOfPropagationPathPoint& sun_path,
+                      const Sun& sun,
+                      const Agenda& ray_path_observer_agenda,
+                      const SurfaceField& surface_field,
+                      const Vector3 observer_pos,
+                      const Numeric angle_cut,
+                      const Index refinements,
+                      const bool just_hit,
+                      const std::optional<Vector2>& initial_los = std::nullopt,
+                      const Index secant_steps = 8);
 
 std::pair<Numeric, bool> beta_angle(const Workspace& ws,
                                     ArrayOfPropagationPathPoint& sun_path,
@@ -1,6 +1,10 @@
+#include <algorithm>
 #include <iostream>
+#include <limits>
+#include <numeric>
 
 #include "particle_habit.h"
+#include "scattering_species.h"
 #include "test_utils.h"
 #include "xml_io.h"
 
@@ -40,6 +44,273 @@ bool test_particle_habit_from_legacy_tro() {
   return true;
 }
 
+bool test_particle_habit_copy_on_write() {
+
+  std::string meta_path = std::string(TEST_DATA_PATH) + std::string("arts-xml-data/scattering/H2O_ice/ScatteringMetaFile_allH2Oice.xml");
+  std::string data_path = std::string(TEST_DATA_PATH) + std::string("arts-xml-data/scattering/H2O_ice/SingleScatteringFile_allH2Oice.xml");
+
+  ArrayOfSingleScatteringData legacy_data;
+  xml_read_from_file(data_path, legacy_data);
+  ArrayOfScatteringMetaData legacy_meta;
+  xml_read_from_file(meta_path, legacy_meta);
+
+  auto habit = scattering::ParticleHabit::from_legacy_tro(legacy_data, legacy_meta);
+  using SSD = scattering::SingleScatteringData<Numeric, scattering::Format::TRO, scattering::Representation::Gridded, 4>;
+  const Index n = habit.size();
+
+  // Copies share the particles until one of them is appended to.
+  auto copy = habit;
+  if (&copy.get<SSD>(0) != &habit.get<SSD>(0)) {
+    return false;
+  }
+
+  copy.append_particle(habit.get<SSD>(0));
+  if (copy.size() != n + 1 or habit.size() != n) {
+    return false;
+  }
+  if (&copy.get<SSD>(0) == &habit.get<SSD>(0)) {
+    return false;
+  }
+
+  // Appending to an unshared habit keeps its particles in place.
+  const SSD* first = &copy.get<SSD>(0);
+  copy.append_particle(habit.get<SSD>(1));
+  if (copy.size() != n + 2 or &copy.get<SSD>(0) != first) {
+    return false;
+  }
+
+  // Appending to an empty habit builds it up particle by particle.
+  scattering::ParticleHabit built;
+  for (Index ind = 0; ind < n; ++ind) {
+    built.append_particle(habit.get<SSD>(ind));
+  }
+  if (built.size() != n) {
+    return false;
+  }
+  for (Index ind = 0; ind < n; ++ind) {
+    Numeric err = max_error<ConstMatrixView>(built.get<SSD>(ind).extinction_matrix(0, joker, joker),
+                                        habit.get<SSD>(ind).extinction_matrix(0, joker, joker));
+    if (err > 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+namespace {
+//! Index and weight of linear interpolation, constant outside the grid
+std::pair<Index, Numeric> linear_weight(const ConstVectorView& grid, Numeric x) {
+  if (grid.size() == 1) return {0, 0.0};
+  x = std::clamp(x, grid.front(), grid.back());
+  Index i = 0;
+  while (i < grid.size() - 2 and grid[i + 1] <= x) ++i;
+  return {i, (x - grid[i]) / (grid[i + 1] - grid[i])};
+}
+
+//! Bulk properties summed directly from the particles, interpolated linearly
+struct BulkReference {
+  Vector ext;
+  Vector abs;
+  Matrix pha;
+};
+
+BulkReference bulk_reference(const scattering::ParticleHabit& particles,
+                             const std::vector<Index>& order,
+                             const Vector& pnd,
+                             const Numeric t,
+                             const Vector& f_grid,
+                             const Vector& za_grid) {
+  using SSD = scattering::SingleScatteringData<Numeric, scattering::Format::TRO, scattering::Representation::Gridded, 4>;
+
+  BulkReference out{Vector(f_grid.size(), 0.0),
+                    Vector(f_grid.size(), 0.0),
+                    Matrix(f_grid.size(), za_grid.size(), 0.0)};
+  for (Size i = 0; i < order.size(); ++i) {
+    const auto& ssd = particles.get<SSD>(order[i]);
+    const auto& pm = *ssd.phase_matrix;
+    const auto [it, wt] = linear_weight(*pm.get_t_grid(), t);
+
+    for (Index i_f = 0; i_f < f_grid.size(); ++i_f) {
+      const auto [iv, wv] = linear_weight(*pm.get_f_grid(), f_grid[i_f]);
+      for (Index dt : {0, 1}) {
+        for (Index dv : {0, 1}) {
+          const Numeric w = (dt ? wt : 1.0 - wt) * (dv ? wv : 1.0 - wv);
+          if (w == 0.0) continue;
+          out.ext[i_f] += pnd[i] * w * ssd.extinction_matrix(it + dt, iv + dv, 0);
+          out.abs[i_f] += pnd[i] * w * ssd.absorption_vector(it + dt, iv + dv, 0);
+          for (Index i_za = 0; i_za < za_grid.size(); ++i_za) {
+            const auto [iza, wza] = linear_weight(scattering::grid_vector(*pm.get_za_scat_grid()), za_grid[i_za]);
+            for (Index dza : {0, 1}) {
+              const Numeric wp = w * (dza ? wza : 1.0 - wza);
+              if (wp == 0.0) continue;
+              out.pha(i_f, i_za) += pnd[i] * wp * pm(it + dt, iv + dv, iza + dza, 0);
+            }
+          }
+        }
+      }
+    }
+  }
+  return out;
+}
+
+//! The largest difference relative to the largest reference value
+bool close(const Vector& x, const Vector& ref) {
+  Numeric err = 0.0, norm = 0.0;
+  for (Index i = 0; i < ref.size(); ++i) {
+    err = std::max(err, std::abs(x[i] - ref[i]));
+    norm = std::max(norm, std::abs(ref[i]));
+  }
+  return err <= 1e-10 * norm;
+}
+
+//! Compares bulk properties with a reference, both at a single temperature
+template <typename Bulk>
+bool matches(const Bulk& bulk, const BulkReference& ref) {
+  const Index nf = ref.ext.size();
+  const Index nza = ref.pha.ncols();
+
+  Vector ext(nf), abs(nf), pha(nf * nza), pha_ref(nf * nza);
+  for (Index i_f = 0; i_f < nf; ++i_f) {
+    ext[i_f] = bulk.extinction_matrix(0, i_f, 0);
+    abs[i_f] = bulk.absorption_vector(0, i_f, 0);
+    for (Index i_za = 0; i_za < nza; ++i_za) {
+      pha[i_f * nza + i_za] = (*bulk.phase_matrix)(0, i_f, i_za, 0);
+      pha_ref[i_f * nza + i_za] = ref.pha(i_f, i_za);
+    }
+  }
+
+  return close(ext, ref.ext) and close(abs, ref.abs) and close(pha, pha_ref);
+}
+
+//! The linear mix (1 - x) a + x b of two references
+BulkReference mix(const BulkReference& a, const BulkReference& b, const Numeric x) {
+  BulkReference out = a;
+  for (Index i_f = 0; i_f < a.ext.size(); ++i_f) {
+    out.ext[i_f] = (1.0 - x) * a.ext[i_f] + x * b.ext[i_f];
+    out.abs[i_f] = (1.0 - x) * a.abs[i_f] + x * b.abs[i_f];
+    for (Index i_za = 0; i_za < a.pha.ncols(); ++i_za) {
+      out.pha(i_f, i_za) = (1.0 - x) * a.pha(i_f, i_za) + x * b.pha(i_f, i_za);
+    }
+  }
+  return out;
+}
+}  // namespace
+
+bool test_scattering_habit_bulk_properties() {
+
+  std::string meta_path = std::string(TEST_DATA_PATH) + std::string("arts-xml-data/scattering/H2O_ice/ScatteringMetaFile_allH2Oice.xml");
+  std::string data_path = std::string(TEST_DATA_PATH) + std::string("arts-xml-data/scattering/H2O_ice/SingleScatteringFile_allH2Oice.xml");
+
+  ArrayOfSingleScatteringData legacy_data;
+  xml_read_from_file(data_path, legacy_data);
+  ArrayOfScatteringMetaData legacy_meta;
+  xml_read_from_file(meta_path, legacy_meta);
+
+  ScatteringSpeciesProperty iwc{"ice", ParticulateProperty::MassDensity};
+  scattering::ScatteringHabit habit(
+      scattering::ParticleHabit::from_legacy_tro(legacy_data, legacy_meta),
+      MGDSingleMoment(iwc, "Field19", 0.0, 300.0, false));
+
+  // Prepare on the grids of the data, so that no regridding is done.
+  const auto& ssd = legacy_data[0];
+  auto f_grid = std::make_shared<const Vector>(ssd.f_grid);
+  auto za_grid = std::make_shared<scattering::ZenithAngleGrid>(
+      scattering::IrregularZenithAngleGrid(ssd.za_grid));
+  habit.prepare_scattering_data(
+      {std::make_shared<const Vector>(ssd.T_grid), f_grid, za_grid});
+
+  AtmPoint point;
+  point[AtmKey::t] = ssd.T_grid[0];
+  point[iwc] = 1e-4;
+
+  auto bulk = habit.get_bulk_scattering_properties_tro_gridded<1>(point, *f_grid, za_grid);
+  auto pnd = habit.particle_number_density(point);
+
+  // The particles of the habit are sorted by size.
+  std::vector<Index> order(legacy_meta.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::ranges::sort(order, {}, [&](Index i) { return legacy_meta[i].diameter_volume_equ; });
+
+  for (Index i_f = 0; i_f < f_grid->size(); ++i_f) {
+    Numeric ext = 0.0;
+    Numeric abs = 0.0;
+    for (Size i = 0; i < order.size(); ++i) {
+      ext += pnd[i] * legacy_data[order[i]].ext_mat_data(i_f, 0, 0, 0, 0);
+      abs += pnd[i] * legacy_data[order[i]].abs_vec_data(i_f, 0, 0, 0, 0);
+    }
+    if (std::abs(bulk.extinction_matrix(0, i_f, 0) - ext) > 1e-12 * std::abs(ext)) {
+      return false;
+    }
+    if (std::abs(bulk.absorption_vector(0, i_f, 0) - abs) > 1e-12 * std::abs(abs)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool test_scattering_habit_bulk_properties_regridded() {
+
+  std::string meta_path = std::string(TEST_DATA_PATH) + std::string("arts-xml-data/scattering/H2O_ice/ScatteringMetaFile_allH2Oice.xml");
+  std::string data_path = std::string(TEST_DATA_PATH) + std::string("arts-xml-data/scattering/H2O_ice/SingleScatteringFile_allH2Oice.xml");
+
+  ArrayOfSingleScatteringData legacy_data;
+  xml_read_from_file(data_path, legacy_data);
+  ArrayOfScatteringMetaData legacy_meta;
+  xml_read_from_file(meta_path, legacy_meta);
+
+  const auto particles = scattering::ParticleHabit::from_legacy_tro(legacy_data, legacy_meta);
+  ScatteringSpeciesProperty iwc{"ice", ParticulateProperty::MassDensity};
+  scattering::ScatteringHabit habit(
+      particles, MGDSingleMoment(iwc, "Field19", 0.0, 300.0, false));
+
+  std::vector<Index> order(legacy_meta.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::ranges::sort(order, {}, [&](Index i) { return legacy_meta[i].diameter_volume_equ; });
+
+  // Frequencies between those of the data, inside the range of all particles.
+  Numeric f_lo = 0.0, f_hi = std::numeric_limits<Numeric>::infinity();
+  for (const auto& ssd : legacy_data) {
+    f_lo = std::max(f_lo, ssd.f_grid.front());
+    f_hi = std::min(f_hi, ssd.f_grid.back());
+  }
+  auto f_grid = std::make_shared<const Vector>(
+      Vector{f_lo + 0.3 * (f_hi - f_lo), f_lo + 0.55 * (f_hi - f_lo), f_lo + 0.8 * (f_hi - f_lo)});
+
+  // Scattering angles between those of the data.
+  Vector za(25);
+  for (Index i = 0; i < za.size(); ++i) za[i] = 3.0 + 7.0 * static_cast<Numeric>(i);
+  auto za_grid = std::make_shared<scattering::ZenithAngleGrid>(
+      scattering::IrregularZenithAngleGrid(za));
+
+  // A temperature between those of the data.
+  const Vector& t_data = legacy_data[0].T_grid;
+  const Numeric t = t_data.size() > 1 ? 0.4 * t_data[0] + 0.6 * t_data[1] : t_data[0] + 7.0;
+
+  AtmPoint point;
+  point[AtmKey::t] = t;
+  point[iwc] = 1e-4;
+
+  // Prepared at the temperature itself, the data is regridded there.
+  habit.prepare_scattering_data(
+      {std::make_shared<const Vector>(Vector{t}), f_grid, za_grid});
+  Vector pnd = habit.particle_number_density(point);
+  if (not matches(habit.get_bulk_scattering_properties_tro_gridded<1>(point, *f_grid, za_grid),
+                  bulk_reference(particles, order, pnd, t, *f_grid, za))) {
+    return false;
+  }
+
+  // Prepared around the temperature, the bulk properties are interpolated.
+  const Numeric t_lo = t - 4.0, t_hi = t + 6.0;
+  habit.prepare_scattering_data(
+      {std::make_shared<const Vector>(Vector{t_lo, t_hi}), f_grid, za_grid});
+  pnd = habit.particle_number_density(point);
+
+  const auto lo = bulk_reference(particles, order, pnd, t_lo, *f_grid, za);
+  const auto hi = bulk_reference(particles, order, pnd, t_hi, *f_grid, za);
+  return matches(habit.get_bulk_scattering_properties_tro_gridded<1>(point, *f_grid, za_grid),
+                 mix(lo, hi, 0.4));
+}
+
 int main() {
   bool passed = false;
   std::cout << "Test conversion from legacy format (TRO): ";
@@ -50,5 +321,29 @@ int main() {
     std::cout << "FAILED." << std::endl;
     return 1;
   }
+  std::cout << "Test copy-on-write of particle habit: ";
+  passed = test_particle_habit_copy_on_write();
+  if (passed) {
+    std::cout << "PASSED." << std::endl;
+  } else {
+    std::cout << "FAILED." << std::endl;
+    return 1;
+  }
+  std::cout << "Test bulk properties of scattering habit: ";
+  passed = test_scattering_habit_bulk_properties();
+  if (passed) {
+    std::cout << "PASSED." << std::endl;
+  } else {
+    std::cout << "FAILED." << std::endl;
+    return 1;
+  }
+  std::cout << "Test regridded bulk properties of scattering habit: ";
+  passed = test_scattering_habit_bulk_properties_regridded();
+  if (passed) {
+    std::cout << "PASSED." << std::endl;
+  } else {
+    std::cout << "FAILED." << std::endl;
+    return 1;
+  }
   return 0;
 }
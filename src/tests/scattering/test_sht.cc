@@ -3,6 +3,7 @@
 #include <complex>
 #include <iostream>
 #include <random>
+#include <vector>
 
 #include "test_utils.h"
 
@@ -127,6 +128,59 @@ bool test_add_coefficients(int n_trials) {
   return true;
 }
 
+/** Test concurrent use.
+ *
+ * Round-trip transforms of different configurations from many threads
+ * must agree with the input.
+ */
+bool test_concurrent_transforms(int n_trials) {
+  std::vector<ComplexVector> coeffs;
+  for (int i = 0; i < n_trials; ++i) {
+    const Index l_max = 4 + 4 * (i % 3);
+    coeffs.push_back(random_spectral_coeffs(l_max, l_max));
+  }
+
+  bool passed = true;
+#pragma omp parallel for
+  for (int i = 0; i < n_trials; ++i) {
+    const Index l_max = 4 + 4 * (i % 3);
+    auto sht_v        = sht::provider.get_instance_lm(l_max, l_max);
+    ComplexVector v_ref = sht_v->transform(sht_v->synthesize(coeffs[i]));
+    if (std::abs(max_error(coeffs[i], v_ref)) > 1e-6) {
+#pragma omp critical
+      passed = false;
+    }
+  }
+  return passed;
+}
+
+/** Test batched transforms.
+ *
+ * Transforming a batch of fields must give the same coefficients as
+ * transforming them one at a time.
+ */
+bool test_batched_transforms(int n_batch) {
+  auto sht_v = sht::provider.get_instance_lm(8, 8);
+
+  ComplexMatrix coeffs(n_batch, sht_v->get_n_spectral_coeffs());
+  Tensor3 spatial(
+      n_batch, sht_v->get_n_azimuth_angles(), sht_v->get_n_zenith_angles());
+  for (int i = 0; i < n_batch; ++i) {
+    coeffs[i] = random_spectral_coeffs(8, 8);
+  }
+
+  sht_v->synthesize(spatial, coeffs);
+  ComplexMatrix coeffs_ref(n_batch, sht_v->get_n_spectral_coeffs());
+  sht_v->transform(coeffs_ref, spatial);
+
+  for (int i = 0; i < n_batch; ++i) {
+    Matrix spatial_i = sht_v->synthesize(coeffs[i]);
+    if (std::abs(max_error(spatial_i, spatial[i])) > 1e-6) return false;
+    if (std::abs(max_error(coeffs[i], coeffs_ref[i])) > 1e-6) return false;
+  }
+  return true;
+}
+
 bool test_grids() {
   auto sht = sht::provider.get_instance(64, 64);
 
@@ -203,6 +257,24 @@ int main(int /*nargs*/, char** /*argv*/) {
     return 1;
   }
 
+  passed = test_concurrent_transforms(48);
+  std::cout << "test_concurrent_transforms: ";
+  if (passed) {
+    std::cout << "PASSED" << std::endl;
+  } else {
+    std::cout << "FAILED" << std::endl;
+    return 1;
+  }
+
+  passed = test_batched_transforms(24);
+  std::cout << "test_batched_transforms: ";
+  if (passed) {
+    std::cout << "PASSED" << std::endl;
+  } else {
+    std::cout << "FAILED" << std::endl;
+    return 1;
+  }
+
   passed = test_grids();
   std::cout << "test_grids: ";
   if (passed) {
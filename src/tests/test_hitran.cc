@@ -1,6 +1,12 @@
 #include <array>
+#include <chrono>
+#include <format>
 #include <iostream>
+#include <limits>
+#include <sstream>
+
 #include "hitran_species.h"
+#include "lbl_hitran.h"
 
 void test001() {
   const Index nmols = 100;
@@ -17,6 +23,61 @@ void test001() {
   }
 }
 
+//! Synthetic water lines at 0.001, 0.002, ... cm-1
+std::string synthetic_par(Size n) {
+  std::string out;
+  out.reserve(161 * n);
+  for (Size i = 1; i <= n; i++) {
+    out += std::format(" 11{:12.6f}{:10.3E}{:10.3E}{:5.3f}{:5.3f}{:10.4f}{:4.2f}{:8.5f}{:79}{:7.1f}{:7.1f}\n",
+                       0.001 * static_cast<Numeric>(i),
+                       1e-25,
+                       1e-3,
+                       0.05,
+                       0.3,
+                       100.0,
+                       0.7,
+                       -0.001,
+                       "",
+                       3.0,
+                       1.0);
+  }
+  return out;
+}
+
+void test_read_par(Size n) {
+  const std::string data = synthetic_par(n);
+
+  const Numeric f0   = Conversion::kaycm2freq(0.001 * static_cast<Numeric>(n / 4));
+  const Numeric f1   = Conversion::kaycm2freq(0.001 * static_cast<Numeric>(3 * n / 4));
+  const Size nexpect = 3 * n / 4 - n / 4 + 1;
+
+  const auto start = std::chrono::steady_clock::now();
+  const auto all   = lbl::read_hitran_par(std::istringstream(data),
+                                        Vector2{-std::numeric_limits<Numeric>::infinity(),
+                                                std::numeric_limits<Numeric>::infinity()});
+  const auto mid   = std::chrono::steady_clock::now();
+  const auto some  = lbl::read_hitran_par(std::istringstream(data),
+                                         Vector2{f0 * (1 - 1e-12), f1 * (1 + 1e-12)});
+  const auto end   = std::chrono::steady_clock::now();
+
+  ARTS_USER_ERROR_IF(all.size() != n, "Read {} of {} records", all.size(), n)
+  ARTS_USER_ERROR_IF(some.size() != nexpect,
+                     "Read {} records in range, expected {}",
+                     some.size(),
+                     nexpect)
+  for (Size i = 1; i < all.size(); i++) {
+    ARTS_USER_ERROR_IF(all[i].f0 <= all[i - 1].f0, "Records out of order")
+  }
+
+  const std::chrono::duration<double> dt_all  = mid - start;
+  const std::chrono::duration<double> dt_some = end - mid;
+  std::cout << std::format("read_hitran_par full: {} records/s\n",
+                           static_cast<double>(n) / dt_all.count());
+  std::cout << std::format("read_hitran_par half-range: {} records/s\n",
+                           static_cast<double>(nexpect) / dt_some.count());
+}
+
 int main() {
   test001();
+  test_read_par(200'000);
 }
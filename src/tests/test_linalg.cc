@@ -11,8 +11,10 @@
 #include <stdlib.h>
 #include <time.h>
 #include <cmath>
+#include <format>
 #include <iostream>
 #include <random>
+#include <stdexcept>
 #include "array.h"
 #include "lin_alg.h"
 #include "matpack_math.h"
@@ -511,6 +513,48 @@ void test_complex_diagonalize(Index ntests, Index dim) {
   }
 }
 
+void test_complex_solve_inplace(Index ntests, Index dim) {
+  ComplexMatrix A(dim, dim), Ainv(dim, dim), LU(dim, dim);
+  ComplexVector b(dim), x(dim), x_ref(dim);
+
+  // initialize random seed
+  srand((unsigned int)time(0));
+
+  cout << endl << endl << "Testing complex solve_inplace: n = " << dim;
+  cout << ", ntests = " << ntests << endl;
+  cout << setw(10) << "Test no.";
+  cout << setw(25) << "Max. abs. x - A^-1*b" << endl << endl;
+
+  for (Index i = 0; i < ntests; i++) {
+    for (Index j = 0; j < dim; j++) {
+      b[j] = Complex(rand() % 100 - 50, rand() % 100 - 50);
+      for (Index k = 0; k < dim; k++) {
+        A(j, k) = Complex(rand() % 100 - 50, rand() % 100 - 50);
+      }
+    }
+
+    inv(Ainv, A);
+    mult(x_ref, Ainv, b);
+
+    x  = b;
+    LU = A;
+    solve_inplace(x, LU);
+
+    Numeric err = 0.0, scl = 0.0;
+    for (Index j = 0; j < dim; j++) {
+      err = std::max(err, std::abs(x[j] - x_ref[j]));
+      scl = std::max(scl, std::abs(x_ref[j]));
+    }
+
+    cout << setw(10) << i << setw(25) << err << endl;
+
+    if (err > 1e-8 * scl) {
+      throw std::runtime_error(
+          std::format("solve_inplace differs from inv by {} in test {}", err, i));
+    }
+  }
+}
+
 int main() {
   // test_lusolve4D();
   // test_inv( 20, 1000 );
@@ -518,5 +562,6 @@ int main() {
   // test_matrix_exp1D();
   //  test_real_diagonalize(20,100);
   test_complex_diagonalize(20,100);
+  test_complex_solve_inplace(20, 100);
   return (0);
 }
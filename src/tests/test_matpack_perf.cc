@@ -1,6 +1,7 @@
 #include <artstime.h>
 #include <matpack.h>
 
+#include <algorithm>
 #include <cstdlib>
 #include <iostream>
 #include <stdexcept>
@@ -603,6 +604,56 @@ Array<Timing> test_ops_Matrix(Index N) {
   return out;
 }
 
+Array<Timing> test_temporaries(Index N) {
+  constexpr Index reps = 1000;
+
+  Numeric X = 0;
+  Vector a(N, 1);
+
+  Array<Numeric> results_;
+  Array<Timing> out;
+
+  out.emplace_back("Vector(temporary)")([&]() {
+    for (Index i = 0; i < reps; i++) {
+      Vector t(N);
+      std::copy(a.begin(), a.end(), t.begin());
+      t += a;
+      X += t[N - 1];
+    }
+  });
+  results_.push_back(X);
+
+  out.emplace_back("uninitialized_data(temporary)")([&]() {
+    for (Index i = 0; i < reps; i++) {
+      matpack::uninitialized_data<Numeric, 1> t(N);
+      std::copy(a.begin(), a.end(), t.begin());
+      t += a;
+      X += t[N - 1];
+    }
+  });
+  results_.push_back(X);
+
+  const std::size_t arena_allocs =
+      matpack::arena::local().system_allocation_count();
+  out.emplace_back("arena_data(temporary)")([&]() {
+    for (Index i = 0; i < reps; i++) {
+      const matpack::arena_scope scope;
+      matpack::arena_data<Numeric, 1> t(N);
+      std::copy(a.begin(), a.end(), t.begin());
+      t += a;
+      X += t[N - 1];
+    }
+  });
+  results_.push_back(X);
+
+  if (matpack::arena::local().system_allocation_count() - arena_allocs > 1)
+    throw std::runtime_error("arena did not reuse its memory");
+
+  out.emplace_back("dummy")([results_]() { return results_[results_.size() - 1]; });
+
+  return out;
+}
+
 int main(int argc, char** c) {
   std::array<Index, 8> N;
   if (static_cast<std::size_t>(argc) < 1 + 1 + N.size()) {
@@ -629,5 +680,6 @@ int main(int argc, char** c) {
               << test_elementary_ops_Matrix(N[5]) << '\n';
     std::cout << N[6] << " vector_ops_vector\n" << test_ops_Vector(N[6]) << '\n';
     std::cout << N[7] << " matrix_ops_matrix\n" << test_ops_Matrix(N[7]) << '\n';
+    std::cout << N[3] << " temporaries\n" << test_temporaries(N[3]) << '\n';
   }
 }
@@ -7,6 +7,7 @@
 #include <limits>
 #include <numeric>
 #include <stdexcept>
+#include <thread>
 #include <type_traits>
 #include <vector>
 
@@ -14,6 +15,7 @@
 #include "debug.h"
 #include "interp.h"
 #include "lin_alg.h"
+#include "matpack_allocator.h"
 #include "logic.h"
 #include "matpack_algo.h"
 #include "matpack_arrays.h"
@@ -654,6 +656,50 @@ void test_grid() {
   std::cout << y << '\n';
 }
 
+void test_arena() {
+  //! A fresh thread has an empty arena
+  std::thread([]() {
+    using matpack::arena, matpack::arena_data, matpack::arena_scope;
+
+    arena& a              = arena::local();
+    constexpr Index block = arena::min_block_size / sizeof(Numeric);
+
+    {
+      const arena_scope scope;
+      const arena_data<Numeric, 1> x(3 * block / 4);
+      const arena_data<Numeric, 1> y(block / 2);
+      ARTS_USER_ERROR_IF(a.system_allocation_count() != 2,
+                         "{}",
+                         a.system_allocation_count())
+      ARTS_USER_ERROR_IF(a.skipped() != arena::min_block_size / 4,
+                         "{}",
+                         a.skipped())
+    }
+    ARTS_USER_ERROR_IF(a.skipped() != 0, "{}", a.skipped())
+
+    //! The blocks are now 1 and 2 min_block_size, the second must not be
+    //! skipped when a third larger block is needed
+    {
+      const arena_scope scope;
+      const arena_data<Numeric, 1> x(3 * block);
+      const arena_data<Numeric, 1> y(3 * block / 2);
+      ARTS_USER_ERROR_IF(a.system_allocation_count() != 3,
+                         "{}",
+                         a.system_allocation_count())
+    }
+
+    //! Storage freed by another thread is left to the scope
+    {
+      const arena_scope scope;
+      arena_data<Numeric, 1> x(block / 4);
+      const auto m = a.mark();
+      std::thread([&x]() { const auto y = std::move(x); }).join();
+      ARTS_USER_ERROR_IF(a.mark().block != m.block or a.mark().used != m.used,
+                         "Another thread changed the arena")
+    }
+  }).join();
+}
+
 #define EXECUTE_TEST(X)                                                       \
   std::cout << "#########################################################\n"; \
   std::cout << "Executing test: " #X << '\n';                                 \
@@ -674,4 +720,5 @@ int main() {
   EXECUTE_TEST(test_sorted_grid)
   EXECUTE_TEST(test_lapack_vector_mult)
   EXECUTE_TEST(test_grid)
+  EXECUTE_TEST(test_arena)
 }
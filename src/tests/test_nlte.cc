@@ -0,0 +1,165 @@
+#include <lin_alg.h>
+#include <matpack.h>
+#include <nlte.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+
+#include "debug.h"
+
+namespace {
+const ArrayOfIndex upper{1, 2, 2, 3};
+const ArrayOfIndex lower{0, 1, 0, 2};
+constexpr Index nstates = 4;
+constexpr Index nlines  = 4;
+constexpr Index nlevels = 20;
+
+Vector random_vector(std::mt19937& gen, Index n, Numeric lo, Numeric hi) {
+  std::uniform_real_distribution<Numeric> dist(lo, hi);
+  Vector out(n);
+  for (auto& v : out) v = dist(gen);
+  return out;
+}
+
+Matrix random_matrix(std::mt19937& gen, Index n, Index m, Numeric lo, Numeric hi) {
+  std::uniform_real_distribution<Numeric> dist(lo, hi);
+  Matrix out(n, m);
+  for (Index i = 0; i < n; i++)
+    for (Index j = 0; j < m; j++) out(i, j) = dist(gen);
+  return out;
+}
+
+//! The solution of each level by assembling and solving it on its own
+Matrix direct_solution(const Vector& Aij,
+                       const Vector& Bij,
+                       const Vector& Bji,
+                       const Matrix& Cij,
+                       const Matrix& Cji,
+                       const Matrix& Jij) {
+  const Index row = find_first_unique_in_lower(upper, lower);
+
+  Matrix x(nlevels, nstates);
+  for (Index ilev = 0; ilev < nlevels; ilev++) {
+    Matrix A(nstates, nstates);
+    Vector b(nstates, 0.0);
+    statistical_equilibrium_equation(
+        A, Aij, Bij, Bji, Cij[ilev], Cji[ilev], Jij[ilev], upper, lower);
+    set_constant_statistical_equilibrium_matrix(A, b, 1.0, row);
+    solve(x[ilev], A, b);
+  }
+  return x;
+}
+
+Numeric max_relative_difference(const Matrix& a, const Matrix& b) {
+  Numeric out = 0.0;
+  for (Index i = 0; i < a.nrows(); i++)
+    for (Index j = 0; j < a.ncols(); j++)
+      out = std::max(out, std::abs(a(i, j) / b(i, j) - 1.0));
+  return out;
+}
+
+void test_batched_solver() {
+  std::mt19937 gen(42);
+
+  const Vector Aij = random_vector(gen, nlines, 0.5, 2.0);
+  const Vector Bij = random_vector(gen, nlines, 0.5, 2.0);
+  const Vector Bji = random_vector(gen, nlines, 0.5, 2.0);
+  const Matrix Cij = random_matrix(gen, nlevels, nlines, 0.1, 10.0);
+  const Matrix Cji = random_matrix(gen, nlevels, nlines, 0.1, 10.0);
+  Matrix Jij       = random_matrix(gen, nlevels, nlines, 0.5, 2.0);
+
+  StatisticalEquilibriumSolver solver(Aij, Bij, Bji, upper, lower, nstates);
+  solver.set_collisions(Cij, Cji);
+
+  Matrix x(nlevels, nstates);
+  Index nfactored = solver.solve(x, Jij);
+  ARTS_USER_ERROR_IF(nfactored != nlevels,
+                     "All levels must be factored on the first solve, got {}",
+                     nfactored)
+
+  Numeric err = max_relative_difference(
+      x, direct_solution(Aij, Bij, Bji, Cij, Cji, Jij));
+  ARTS_USER_ERROR_IF(err > 1e-12, "First solve is off by {}", err)
+
+  //! A small change of the radiation field reuses the factorizations
+  Jij *= 1.001;
+  nfactored = solver.solve(x, Jij);
+  ARTS_USER_ERROR_IF(nfactored != 0,
+                     "No level should be factored anew, got {}",
+                     nfactored)
+
+  err = max_relative_difference(
+      x, direct_solution(Aij, Bij, Bji, Cij, Cji, Jij));
+  ARTS_USER_ERROR_IF(err > 1e-10, "Refined solve is off by {}", err)
+
+  //! A large change of the radiation field requires new factorizations
+  Jij *= 1000.0;
+  nfactored = solver.solve(x, Jij);
+  ARTS_USER_ERROR_IF(nfactored == 0, "Levels must be factored anew")
+
+  err = max_relative_difference(
+      x, direct_solution(Aij, Bij, Bji, Cij, Cji, Jij));
+  ARTS_USER_ERROR_IF(err > 1e-10, "Solve after large change is off by {}", err)
+
+  std::cout << "Batched statistical equilibrium solver OK\n";
+}
+
+//! Counts the iterations of x = M x + c to converge, with or without Ng acceleration
+Index fixed_point_iterations(const Matrix& M, const Vector& c, bool accelerate) {
+  const Index n = c.size();
+
+  Vector exact(n);
+  Matrix IminusM(n, n, 0.0);
+  for (Index i = 0; i < n; i++) IminusM(i, i) = 1.0;
+  IminusM -= M;
+  solve(exact, IminusM, c);
+
+  NgAcceleration ng;
+  Matrix x(1, n, 1.0);
+  for (Index iter = 1; iter < 10000; iter++) {
+    Vector next{c};
+    mult(next, M, x[0], 1.0, 1.0);
+    x[0] = next;
+
+    if (accelerate) ng(x);
+
+    Numeric err = 0.0;
+    for (Index i = 0; i < n; i++)
+      err = std::max(err, std::abs(x(0, i) / exact[i] - 1.0));
+    if (err < 1e-10) return iter;
+  }
+  return 10000;
+}
+
+void test_ng_acceleration() {
+  //! A slowly converging iteration dominated by two eigenvalues
+  Matrix M(3, 3, 0.0);
+  M(0, 0) = 0.95;
+  M(0, 1) = 0.02;
+  M(1, 1) = 0.9;
+  M(2, 1) = 0.03;
+  M(2, 2) = 0.1;
+  const Vector c{1.0, 2.0, 3.0};
+
+  const Index plain = fixed_point_iterations(M, c, false);
+  const Index ng    = fixed_point_iterations(M, c, true);
+  ARTS_USER_ERROR_IF(ng * 2 > plain,
+                     "Ng acceleration needs {} iterations, plain {}",
+                     ng,
+                     plain)
+
+  std::cout << "Ng acceleration OK, " << ng << " instead of " << plain
+            << " iterations\n";
+}
+}  // namespace
+
+int main() try {
+  test_batched_solver();
+  test_ng_acceleration();
+} catch (std::exception& e) {
+  std::cerr << e.what() << '\n';
+  return EXIT_FAILURE;
+}
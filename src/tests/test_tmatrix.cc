@@ -0,0 +1,97 @@
+#include <algorithm>
+#include <iostream>
+#include <span>
+
+#include "debug.h"
+#include "math_funcs.h"
+#include "optproperties.h"
+#include "tmatrix.h"
+
+namespace {
+//! The flat data of a tensor
+template <typename T>
+auto flat(const T& x) {
+  return std::span{x.data_handle(), static_cast<std::size_t>(x.size())};
+}
+
+//! The scattering data grids of calc_ssp_random_test and calc_ssp_fixed_test
+SingleScatteringData ssd_grids(const PType ptype) {
+  SingleScatteringData ssd;
+  ssd.ptype  = ptype;
+  ssd.f_grid = {230e9, 240e9, 250e9};
+  ssd.T_grid = {220, 250};
+  nlinspace(ssd.za_grid, 0, 180, 19);
+  nlinspace(ssd.aa_grid, 0, 180, 19);
+  return ssd;
+}
+
+Matrix real_index() {
+  Matrix mrr(3, 2, 1.78031135);
+  mrr(0, 1) = 1.78150475;
+  mrr(1, 0) = 1.78037238;
+  mrr(1, 1) = 1.78147686;
+  return mrr;
+}
+
+Matrix imag_index() {
+  Matrix mri(3, 2, 0.00278706);
+  mri(0, 1) = 0.00507565;
+  mri(1, 0) = 0.00287245;
+  mri(1, 1) = 0.00523012;
+  return mri;
+}
+
+void check_processes(const PType ptype, const Numeric axial_ratio) {
+  const Matrix mrr = real_index();
+  const Matrix mri = imag_index();
+
+  SingleScatteringData serial = ssd_grids(ptype);
+  calcSingleScatteringDataProperties(
+      serial, mrr, mri, 200.e-6, -1, axial_ratio, 0.001, 2, 0, 1, 1);
+
+  //! Fewer, as many and more processes than frequency and temperature pairs
+  for (const Index processes : {2, 6, 16}) {
+    SingleScatteringData par = ssd_grids(ptype);
+    calcSingleScatteringDataProperties(
+        par, mrr, mri, 200.e-6, -1, axial_ratio, 0.001, 2, 0, 1, processes);
+
+    ARTS_USER_ERROR_IF(
+        not std::ranges::equal(flat(par.pha_mat_data),
+                               flat(serial.pha_mat_data)),
+        "Phase matrix differs with {} processes",
+        processes)
+    ARTS_USER_ERROR_IF(
+        not std::ranges::equal(flat(par.ext_mat_data),
+                               flat(serial.ext_mat_data)),
+        "Extinction differs with {} processes",
+        processes)
+    ARTS_USER_ERROR_IF(
+        not std::ranges::equal(flat(par.abs_vec_data),
+                               flat(serial.abs_vec_data)),
+        "Absorption differs with {} processes",
+        processes)
+  }
+}
+}  // namespace
+
+void test_random_orientation() {
+  check_processes(PTYPE_TOTAL_RND, 1.5);
+  check_processes(PTYPE_TOTAL_RND, 0.7);
+}
+
+void test_azimuthally_random() {
+  check_processes(PTYPE_AZIMUTH_RND, 1.5);
+  check_processes(PTYPE_AZIMUTH_RND, 0.7);
+}
+
+#define EXECUTE_TEST(X)                                                       \
+  std::cout << "#########################################################\n"; \
+  std::cout << "Executing test: " #X << '\n';                                 \
+  std::cout << "#########################################################\n"; \
+  X();                                                                        \
+  std::cout << "#########################################################\n";
+
+int main() {
+  EXECUTE_TEST(test_random_orientation)
+  EXECUTE_TEST(test_azimuthally_random)
+}
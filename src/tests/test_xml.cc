@@ -1,4 +1,6 @@
+#include <cmath>
 #include <iostream>
+#include <limits>
 #include "matpack_data.h"
 #include "xml_io_base.h"
 
@@ -13,5 +15,27 @@ int main(int /*argc*/, char * /*argv*/[]) {
   xml_read_from_file_base(filename, v2);
   std::cout << v2 << '\n';
 
+  // Large enough to span several blocks of the bulk parser
+  Tensor3 t1(7, 300, 101);
+  Numeric* x1 = t1.data_handle();
+  for (Index i = 0; i < t1.size(); i++) {
+    x1[i] = std::sin(static_cast<Numeric>(i)) * std::pow(10.0, i % 40 - 20);
+  }
+  x1[0]             = std::numeric_limits<Numeric>::quiet_NaN();
+  x1[t1.size() - 1] = -std::numeric_limits<Numeric>::infinity();
+  xml_write_to_file_base(filename, t1, FileType::ascii);
+
+  Tensor3 t2;
+  xml_read_from_file_base(filename, t2);
+  const Numeric* x2 = t2.data_handle();
+  if (t1.shape() != t2.shape() or not std::isnan(x2[0])) return 1;
+  for (Index i = 1; i < t1.size(); i++) {
+    if (std::abs(x1[i] - x2[i]) > 1e-14 * std::abs(x1[i]) and x1[i] != x2[i]) {
+      std::cerr << "Mismatch at element " << i << ": " << x1[i] << " vs "
+                << x2[i] << '\n';
+      return 1;
+    }
+  }
+
   return (0);
 }
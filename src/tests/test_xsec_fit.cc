@@ -0,0 +1,149 @@
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "debug.h"
+#include "interp.h"
+#include "xml_io.h"
+#include "xsec_fit.h"
+
+namespace {
+//! The fitted data of a dataset, with negative values removed
+Vector fitted(const GriddedField1Named& coeffs,
+              const Numeric pressure,
+              const Numeric temperature) {
+  const Index n = coeffs.grid<0>().nelem();
+  Vector out(n);
+  for (Index i = 0; i < n; i++) {
+    const ConstVectorView c = coeffs.data(i, joker);
+    out[i] = c[XsecRecord::P00] + c[XsecRecord::P10] * temperature +
+             c[XsecRecord::P01] * pressure +
+             c[XsecRecord::P20] * temperature * temperature;
+  }
+
+  Numeric sum{};
+  Numeric sum_non_negative{};
+  for (auto& x : out) {
+    sum += x;
+    if (x < 0.) x = 0.;
+    sum_non_negative += x;
+  }
+  if (sum > 0. and sum != sum_non_negative) out *= sum / sum_non_negative;
+
+  return out;
+}
+
+//! The cross sections by Lagrange interpolation, as before the prepared fits
+Vector reference(const XsecRecord& xsec,
+                 const Vector& f_grid,
+                 const Numeric pressure,
+                 const Numeric temperature) {
+  Vector out(f_grid.nelem(), 0.);
+  for (auto& coeffs : xsec.FitCoeffs()) {
+    const Vector& data_f_grid = coeffs.grid<0>();
+    const Vector fit          = fitted(coeffs, pressure, temperature);
+    for (Index i = 0; i < f_grid.nelem(); i++) {
+      if (f_grid[i] < data_f_grid.front() or f_grid[i] > data_f_grid.back())
+        continue;
+
+      const FixedLagrangeInterpolation<1> lag(0, f_grid[i], data_f_grid);
+      out[i] += interp(fit, interpweights(lag), lag);
+    }
+  }
+  return out;
+}
+
+//! All data frequencies, their midpoints and some points outside the data
+Vector test_frequencies(const XsecRecord& xsec) {
+  std::vector<Numeric> f;
+  for (auto& coeffs : xsec.FitCoeffs()) {
+    const Vector& data_f_grid = coeffs.grid<0>();
+    const Index n             = data_f_grid.nelem();
+    for (Index i = 0; i < n; i++) {
+      f.push_back(data_f_grid[i]);
+      if (i + 1 < n) f.push_back(0.5 * (data_f_grid[i] + data_f_grid[i + 1]));
+    }
+    f.push_back(0.99 * data_f_grid.front());
+    f.push_back(1.01 * data_f_grid.back());
+  }
+
+  std::ranges::sort(f);
+  f.erase(std::unique(f.begin(), f.end()), f.end());
+
+  Vector out(f.size());
+  std::ranges::copy(f, out.begin());
+  return out;
+}
+}  // namespace
+
+void test_real_record() {
+  XsecRecord xsec;
+  xml_read_from_file(ARTS_CAT_DATA_DIR "/xsec/O3-XFIT.xml", xsec);
+
+  const Vector f_grid = test_frequencies(xsec);
+
+  for (const Numeric pressure : {1e2, 1e4, 1e5}) {
+    for (const Numeric temperature : {200., 250., 300.}) {
+      const Vector ref = reference(xsec, f_grid, pressure, temperature);
+      const Numeric scale = std::ranges::max(ref);
+      ARTS_USER_ERROR_IF(not(scale > 0), "No cross sections")
+
+      Vector result(f_grid.nelem());
+      xsec.Extract(result, f_grid, pressure, temperature);
+
+      const auto prepared = xsec.Prepare(pressure, temperature);
+      for (Index i = 0; i < f_grid.nelem(); i++) {
+        ARTS_USER_ERROR_IF(std::abs(result[i] - ref[i]) > 1e-12 * scale,
+                           "Extract at {} Hz: {} vs {}",
+                           f_grid[i],
+                           result[i],
+                           ref[i])
+
+        const Numeric at = prepared.At(f_grid[i]);
+        ARTS_USER_ERROR_IF(std::abs(at - ref[i]) > 1e-12 * scale,
+                           "At at {} Hz: {} vs {}",
+                           f_grid[i],
+                           at,
+                           ref[i])
+      }
+    }
+  }
+}
+
+void test_single_point_dataset() {
+  XsecRecord xsec;
+  xsec.FitCoeffs().resize(1);
+  auto& coeffs     = xsec.FitCoeffs().front();
+  coeffs.grid<0>() = Vector{1e12};
+  coeffs.grid<1>() = {"p00", "p10", "p01", "p20"};
+  coeffs.data      = Matrix(1, 4, 0.);
+  coeffs.data(0, XsecRecord::P00) = 1.;
+
+  //! A single frequency cannot be interpolated, so it gives nothing
+  const Vector f_grid{0.5e12, 1e12, 2e12};
+  Vector result(f_grid.nelem(), 1.);
+  xsec.Extract(result, f_grid, 1e4, 250.);
+  ARTS_USER_ERROR_IF(
+      std::ranges::any_of(result, [](auto x) { return x != 0.; }),
+      "Single frequency dataset gives {:B,}",
+      result)
+
+  const auto prepared = xsec.Prepare(1e4, 250.);
+  for (auto f : f_grid) {
+    ARTS_USER_ERROR_IF(
+        prepared.At(f) != 0., "Single frequency dataset at {} Hz", f)
+  }
+}
+
+#define EXECUTE_TEST(X)                                                       \
+  std::cout << "#########################################################\n"; \
+  std::cout << "Executing test: " #X << '\n';                                 \
+  std::cout << "#########################################################\n"; \
+  X();                                                                        \
+  std::cout << "#########################################################\n";
+
+int main() {
+  EXECUTE_TEST(test_real_record)
+  EXECUTE_TEST(test_single_point_dataset)
+}
@@ -677,14 +677,21 @@ available in the *absorption_xsec_fit_data* variable.
 
 The IGRF model is a model of the Earth's magnetic field. It is based on
 spherical harmonics and is only valid for a limited time period.
+
+By default, the field is computed when it is needed.  If all of the grids
+are given, the field is instead tabulated on these grids once, and is
+interpolated between them.  Outside the grids, the nearest value is used.
 )--",
       .author    = {"Richard Larsson"},
       .out       = {"atmospheric_field"},
       .in        = {"atmospheric_field"},
-      .gin       = {"time"},
-      .gin_type  = {"Time"},
-      .gin_value = {Time{}},
-      .gin_desc  = {"Time of data to use"},
+      .gin       = {"time", "alts", "lats", "lons"},
+      .gin_type  = {"Time", "AscendingGrid", "AscendingGrid", "AscendingGrid"},
+      .gin_value = {Time{}, AscendingGrid{}, AscendingGrid{}, AscendingGrid{}},
+      .gin_desc  = {"Time of data to use",
+                    "Altitude grid of the tabulated field",
+                    "Latitude grid of the tabulated field",
+                    "Longitude grid of the tabulated field"},
   };
 
   wsm_data["atmospheric_fieldInit"] = {
@@ -862,6 +869,53 @@ Sets N2 and O2 speces
       .gin_desc  = {R"--(VMRs of air species)--", R"--(Air species)--"},
   };
 
+  wsm_data["ecs_dataAddTabulatedBands"] = {
+      .desc =
+          R"--(Tabulates the equivalent lines of all ECS bands.
+
+The relaxation matrix of the bands is diagonalized on all combinations of
+the temperature and pressure grids.  Line-by-line calculations of the
+tabulated bands then interpolate the equivalent lines rather than
+diagonalizing the relaxation matrix at every atmospheric point.
+
+The equivalent lines are stored as their deviation from the lines without
+line mixing, divided by pressure.  Outside the pressure grid this deviation
+is kept constant, so a single pressure gives the first order pressure scaling
+of the band.  Temperatures outside the grid are an error.
+
+The tables are also computed between all grid points and compared to the
+full diagonalization.  The largest relative errors of equivalent line
+strengths and of equivalent line centers and widths are kept with the table.
+
+For bands that are not computed one-by-one, the broadening species mixing
+ratios of ``atmospheric_point`` are part of the table.
+
+The tables are not stored when ``ecs_data`` is saved to file.
+)--",
+      .author    = {"Richard Larsson"},
+      .out       = {"ecs_data"},
+      .in        = {"ecs_data", "absorption_bands", "atmospheric_point"},
+      .gin       = {"temperatures", "pressures", "max_relative_error"},
+      .gin_type  = {"AscendingGrid", "AscendingGrid", "Numeric"},
+      .gin_value = {std::nullopt,
+                    AscendingGrid{},
+                    std::numeric_limits<Numeric>::infinity()},
+      .gin_desc =
+          {"The temperature grid of the tables, at least two points",
+           "The pressure grid of the tables, empty for the pressure of the atmospheric point",
+           "An error is thrown if any table has larger relative errors than this"},
+  };
+
+  wsm_data["ecs_dataRemoveTabulatedBands"] = {
+      .desc      = R"--(Removes all tabulated equivalent lines from ECS data.
+
+Afterwards, all ECS bands are computed by full diagonalization.
+)--",
+      .author    = {"Richard Larsson"},
+      .out       = {"ecs_data"},
+      .in        = {"ecs_data"},
+  };
+
   wsm_data["ray_path_atmospheric_pointExtendInPressure"] = {
       .desc      = R"--(Gets the atmospheric points along the path.
 )--",
@@ -2249,6 +2303,123 @@ for those species that are ``water_affected_species``.
            "A list of absorption species that are affected by water vapor perturbations nonlinearly"},
   };
 
+  wsm_data["absorption_lookup_tableAdaptive"] = {
+      .desc =
+          R"--(Compute the lookup table for all species in *absorption_bands* on adaptively chosen nodes.
+
+Like *absorption_lookup_tablePrecomputeAll*, but the pressure levels of
+*ray_path_atmospheric_point*, ``temperature_perturbation`` and ``water_perturbation``
+are only candidates for the nodes of the table.  The nodes are chosen, per species,
+by bisecting between the candidates until the interpolation error, checked against
+the exact line-by-line calculations at the midpoints, is below ``tolerance``.
+
+The error is the largest absolute error over frequency relative to the largest
+exact cross-section.  Pressure is refined without perturbations, temperature for
+all chosen pressure levels, and water for all chosen pressure levels without
+temperature perturbation.  At least ``*_interp_order`` + 1 nodes are used for each
+dimension, so the interpolation orders should be those used with the table later.
+
+Species in ``tolerance_species`` use the matching element of ``species_tolerance``
+instead of ``tolerance``.
+
+The ``report`` lists the nodes used per species versus the uniform candidate grid.
+)--",
+      .author    = {"Richard Larsson"},
+      .out       = {"absorption_lookup_table"},
+      .gout      = {"report"},
+      .gout_type = {"String"},
+      .gout_desc = {"The nodes used versus the candidates, per species"},
+      .in        = {"absorption_lookup_table",
+                    "ray_path_atmospheric_point",
+                    "frequency_grid",
+                    "absorption_bands",
+                    "ecs_data"},
+      .gin       = {"temperature_perturbation",
+                    "water_perturbation",
+                    "water_affected_species",
+                    "tolerance",
+                    "tolerance_species",
+                    "species_tolerance",
+                    "p_interp_order",
+                    "t_interp_order",
+                    "water_interp_order"},
+      .gin_type  = {"AscendingGrid",
+                    "AscendingGrid",
+                    "ArrayOfSpeciesEnum",
+                    "Numeric",
+                    "ArrayOfSpeciesEnum",
+                    "Vector",
+                    "Index",
+                    "Index",
+                    "Index"},
+      .gin_value = {AscendingGrid{},
+                    AscendingGrid{},
+                    ArrayOfSpeciesEnum{},
+                    Numeric{1e-3},
+                    ArrayOfSpeciesEnum{},
+                    Vector{},
+                    Index{7},
+                    Index{7},
+                    Index{7}},
+      .gin_desc =
+          {"Candidate temperature perturbations for the lookup table",
+           "Candidate water vapor perturbations for the lookup table",
+           "A list of absorption species that are affected by water vapor perturbations nonlinearly",
+           "The largest relative interpolation error allowed",
+           "Species with their own tolerance",
+           "The tolerance of each of the species in tolerance_species",
+           "The pressure interpolation order",
+           "The temperature interpolation order",
+           "The water vapor interpolation order"},
+  };
+
+  wsm_data["absorption_lookup_tableUpdateBands"] = {
+      .desc =
+          R"--(Update *absorption_lookup_table* after changes to *absorption_bands*.
+
+Each table records the bands that contributed to it and the frequency range
+they affect.  The range covers the line centers plus-minus the cutoff and the
+largest pressure shift and Zeeman splitting at the nodes.  Bands that have been removed
+from or added to *absorption_bands*, and the bands listed in ``changed_bands``,
+mark their old and new frequency ranges as affected.  Only the frequencies of the
+table in these ranges are recomputed.
+
+Bands without cutoff affect all frequencies.
+
+*ray_path_atmospheric_point* must be the atmosphere the tables were created from.
+Only species that already have a table are updated.
+)--",
+      .author    = {"Richard Larsson"},
+      .out       = {"absorption_lookup_table"},
+      .in        = {"absorption_lookup_table",
+                    "ray_path_atmospheric_point",
+                    "absorption_bands",
+                    "ecs_data"},
+      .gin       = {"changed_bands"},
+      .gin_type  = {"ArrayOfQuantumIdentifier"},
+      .gin_value = {ArrayOfQuantumIdentifier{}},
+      .gin_desc  = {"Bands whose data has been modified in place"},
+  };
+
+  wsm_data["absorption_lookup_tableExtendGrids"] = {
+      .desc =
+          R"--(Extend the pressure and frequency grids of *absorption_lookup_table*.
+
+*ray_path_atmospheric_point* must contain all pressure levels of the tables, and
+*frequency_grid* must contain all their frequencies.  Only the new pressure levels
+and the new frequencies are computed, existing data is kept as is.
+
+The temperature and water vapor perturbations of the tables are unchanged.
+)--",
+      .author = {"Richard Larsson"},
+      .out    = {"absorption_lookup_table"},
+      .in     = {"absorption_lookup_table",
+                 "ray_path_atmospheric_point",
+                 "frequency_grid",
+                 "absorption_bands",
+                 "ecs_data"},
+  };
+
   wsm_data["absorption_lookup_tableFromProfiles"] = {
       .desc =
           R"--(Compute the lookup table for all species in *absorption_bands*.
@@ -2393,13 +2564,24 @@ will be stored as 0.xml, 1.xml, 2.xml, and so on
 
 The ``dir`` path has to be absolute or relative to the working path, the environment
 variables are not considered
+
+Both ascii and binary files, as written by *absorption_bandsSaveSplit*, are read.
+
+You may pass an inclusive frequency range to limit what is kept.  Only lines with
+a line center in the range [fmin, fmax] are kept, and bands without any such lines
+are removed.  Binary files store the line center range of each band and the size
+of each line, so bands and lines outside the range are skipped without being read.
+Ascii files are parsed in full.
 )--",
       .author    = {"Richard Larsson"},
       .out       = {"absorption_bands"},
-      .gin       = {"dir"},
-      .gin_type  = {"String"},
-      .gin_value = {std::nullopt},
-      .gin_desc  = {"Absolute or relative path to the directory"},
+      .gin       = {"dir", "frequency_range"},
+      .gin_type  = {"String", "Vector2"},
+      .gin_value = {std::nullopt,
+                    Vector2{-std::numeric_limits<Numeric>::infinity(),
+                            std::numeric_limits<Numeric>::infinity()}},
+      .gin_desc  = {"Absolute or relative path to the directory",
+                    "Frequency range selection"},
   };
 
   wsm_data["absorption_bandsSaveSplit"] = {
@@ -2411,13 +2593,17 @@ will be stored as 0.xml, 1.xml, 2.xml, and so on
 
 The ``dir`` path has to be absolute or relative to the working path, the environment
 variables are not considered
+
+If ``binary`` is true, the line data is stored column-wise in binary files next
+to the XML files.  These are much faster to read than the ascii files.
 )--",
       .author    = {"Richard Larsson"},
       .in        = {"absorption_bands"},
-      .gin       = {"dir"},
-      .gin_type  = {"String"},
-      .gin_value = {std::nullopt},
-      .gin_desc  = {"Absolute or relative path to the directory"},
+      .gin       = {"dir", "binary"},
+      .gin_type  = {"String", "Index"},
+      .gin_value = {std::nullopt, Index{0}},
+      .gin_desc  = {"Absolute or relative path to the directory",
+                    "Whether or not to store the data in binary format"},
   };
 
   wsm_data["ray_pathGeometricUplooking"] = {
@@ -2621,6 +2807,90 @@ called).
       .pass_workspace = true,
   };
 
+  wsm_data["spectral_radiance_operatorContinuumCache"] = {
+      .desc      = R"--(Interpolate slowly varying absorption in the operator
+
+The collision-induced absorption and the predefined models of every atmospheric
+point of *spectral_radiance_operator* are computed on a coarse frequency grid
+over the range of *frequency_grid*.  They are then interpolated linearly for any
+frequency inside that range.
+
+The coarse grid starts with ``start_nodes`` evenly spaced frequencies.  Each
+interval is bisected until linear interpolation at its middle is within
+``tolerance`` of the exact value, relative to the largest absolute value at the
+starting frequencies.  Features narrower than the starting spacing may be missed,
+so predefined models with resolved lines need more ``start_nodes``.
+
+A non-positive ``tolerance`` turns the interpolation off.
+)--",
+      .author    = {"Richard Larsson"},
+      .out       = {"spectral_radiance_operator"},
+      .in        = {"spectral_radiance_operator", "frequency_grid"},
+      .gin       = {"tolerance", "start_nodes"},
+      .gin_type  = {"Numeric", "Index"},
+      .gin_value = {Numeric{1e-4}, Index{33}},
+      .gin_desc  = {"The relative interpolation error allowed",
+                    "The number of evenly spaced starting frequencies"},
+  };
+
+  wsm_data["spectral_radiance_operatorWindShift"] = {
+      .desc      = R"--(Doppler shift the absorption of the operator by the wind
+
+With ``on``, the frequency is scaled by the wind of each atmospheric node along
+the line of sight, as in *frequency_gridWindShift*, before the absorption of
+that node is computed.  This is off for a new operator, so that its radiances
+do not change with the wind unless asked to.  Wind derivatives by
+*spectral_radiance_operatorSetJacobian* need it on.
+)--",
+      .author    = {"Richard Larsson"},
+      .out       = {"spectral_radiance_operator"},
+      .in        = {"spectral_radiance_operator"},
+      .gin       = {"on"},
+      .gin_type  = {"Index"},
+      .gin_value = {Index{1}},
+      .gin_desc  = {"Whether to Doppler shift the absorption"},
+  };
+
+  wsm_data["spectral_radiance_operatorBake"] = {
+      .desc      = R"--(Tabulate the absorption of the operator on *frequency_grid*
+
+The absorption, non-LTE source and Planck radiation of every atmospheric node
+of *spectral_radiance_operator* are computed once for *frequency_grid*.  Later
+calculations at these exact frequencies interpolate the tables instead of the
+absorption models, which makes repeated scans over the same frequencies much
+cheaper.  Other frequencies are not affected.
+
+The tables need memory for 3 values per node and frequency, and 12 more if
+any band has Zeeman splitting.  With *spectral_radiance_operatorWindShift* on,
+the nodes may not have wind, since its Doppler shift depends on the line of
+sight.  Call this method after any other method
+that changes the operator.  An empty *frequency_grid* removes the tables.
+)--",
+      .author    = {"Richard Larsson"},
+      .out       = {"spectral_radiance_operator"},
+      .in        = {"spectral_radiance_operator", "frequency_grid"},
+  };
+
+  wsm_data["spectral_radiance_operatorSetJacobian"] = {
+      .desc      = R"--(Prepare the operator for derivatives by *jacobian_targets*
+
+Only atmospheric targets are supported.  The derivatives are with regards to
+the atmospheric nodes of *spectral_radiance_operator*.
+
+Wind derivatives come from the frequency derivative of the Doppler shifted
+absorption, so they need *spectral_radiance_operatorWindShift* on.  For all
+other targets, the absorption of every node is also kept with the node
+perturbed by the target's ``d``.  Each such target costs as much memory as the
+absorption of the operator itself.
+
+The radiative transfer itself is linearized analytically, see
+*measurement_vectorFromOperatorPathWithJacobian*.
+)--",
+      .author    = {"Richard Larsson"},
+      .out       = {"spectral_radiance_operator"},
+      .in        = {"spectral_radiance_operator", "jacobian_targets"},
+  };
+
   wsm_data["spectral_radiance_fieldFromOperatorPlanarGeometric"] = {
       .desc =
           R"--(Computes the spectral radiance field assuming planar geometric paths
@@ -2632,16 +2902,22 @@ point, their altitude profiles are treated independently.
 Limitations:
 
 - The zenith grid is not allowed to contain the value 90 degrees.
+
+The paths of all directions are computed in parallel.  The frequencies of each
+direction are then split into blocks, and the blocks are computed in parallel.
+If ``display_progress`` is set, the progress and the time it took are printed.
 )--",
       .author    = {"Richard Larsson"},
       .gout      = {"spectral_radiance_field"},
       .gout_type = {"StokvecGriddedField6"},
       .gout_desc = {"The spectral radiance field"},
       .in        = {"spectral_radiance_operator", "frequency_grid"},
-      .gin       = {"zenith_grid", "azimuth_grid"},
-      .gin_type  = {"AscendingGrid", "AscendingGrid"},
-      .gin_value = {std::nullopt, std::nullopt},
-      .gin_desc  = {"The zenith grid", "The azimuth grid"},
+      .gin       = {"zenith_grid", "azimuth_grid", "display_progress"},
+      .gin_type  = {"AscendingGrid", "AscendingGrid", "Index"},
+      .gin_value = {std::nullopt, std::nullopt, Index{0}},
+      .gin_desc  = {"The zenith grid",
+                    "The azimuth grid",
+                    "Print the progress while computing if non-zero"},
   };
 
   wsm_data["spectral_radiance_fieldFromOperatorPath"] = {
@@ -2653,7 +2929,12 @@ zenith x azimuth x altitude x latitude x longitude x frequency number of calcula
 The positional arguments are taken from *spectral_radiance_operator*.
 
 If the code is not already in parallel operation mode when this method is called,
-the first 5 dimensions are computed in parallel.
+the directions are processed in batches of a few per thread.  The paths of a
+batch are computed in parallel.  The frequencies of each path are then split
+into blocks, and the blocks are computed in parallel, the longest paths first.
+The paths are reused by all their blocks and freed before the next batch, so
+that only a batch of paths is kept in memory.  If ``display_progress`` is set,
+the progress and the time it took are printed.
 )--",
       .author         = {"Richard Larsson"},
       .gout           = {"spectral_radiance_field"},
@@ -2662,10 +2943,12 @@ the first 5 dimensions are computed in parallel.
       .in             = {"spectral_radiance_operator",
                          "ray_path_observer_agenda",
                          "frequency_grid"},
-      .gin            = {"zenith_grid", "azimuth_grid"},
-      .gin_type       = {"AscendingGrid", "AscendingGrid"},
-      .gin_value      = {std::nullopt, std::nullopt},
-      .gin_desc       = {"The zenith grid", "The azimuth grid"},
+      .gin            = {"zenith_grid", "azimuth_grid", "display_progress"},
+      .gin_type       = {"AscendingGrid", "AscendingGrid", "Index"},
+      .gin_value      = {std::nullopt, std::nullopt, Index{0}},
+      .gin_desc       = {"The zenith grid",
+                         "The azimuth grid",
+                         "Print the progress while computing if non-zero"},
       .pass_workspace = true,
   };
 
@@ -3054,6 +3337,76 @@ The core calculations happens inside the *spectral_radiance_operator*.
       .pass_workspace = true,
   };
 
+  wsm_data["measurement_vectorFromOperatorPathAdaptive"] = {
+      .desc =
+          R"--(Sets measurement vector with adaptive steps along the paths
+
+As *measurement_vectorFromOperatorPath* but each path is integrated with
+adaptive steps.  Layers with an optical depth below ``optical_depth`` are
+merged, up to ``max_stride`` of them, so that most levels inside them are
+never evaluated.  A merge is only kept if the middle level is close to linear
+between its ends.  Layers with a large change of the source over their optical
+depth are split into sublayers until the change is within ``source_tolerance``
+of the source.  The integration stops once the transmission is below
+``cutoff_transmission``, so the absorption of the rest of the path is never
+computed.  Without merging (``optical_depth`` of 0) and splitting
+(``max_depth`` of 0), the result is that of
+*measurement_vectorFromOperatorPath*.
+
+The estimated errors of the spectral radiance are summed up by the sensor
+elements, as absolute values, into ``measurement_vector_error``.
+)--",
+      .author         = {"Richard Larsson"},
+      .out            = {"measurement_vector"},
+      .gout           = {"measurement_vector_error"},
+      .gout_type      = {"Vector"},
+      .gout_desc      = {"The estimated error of the measurement vector"},
+      .in             = {"measurement_sensor",
+                         "spectral_radiance_operator",
+                         "ray_path_observer_agenda"},
+      .gin            = {"optical_depth",
+                         "source_tolerance",
+                         "cutoff_transmission",
+                         "max_depth",
+                         "max_stride"},
+      .gin_type       = {"Numeric", "Numeric", "Numeric", "Index", "Index"},
+      .gin_value      = {Numeric{1e-3},
+                         Numeric{1e-3},
+                         Numeric{1e-6},
+                         Index{4},
+                         Index{8}},
+      .gin_desc       = {"The optical depth below which layers are merged",
+                         "The error allowed relative to the source of a layer",
+                         "The transmission below which the path is stopped",
+                         "The maximum number of times a layer is split in two",
+                         "The maximum number of layers merged into one"},
+      .pass_workspace = true,
+  };
+
+  wsm_data["measurement_vectorFromOperatorPathWithJacobian"] = {
+      .desc =
+          R"--(Sets measurement vector and its Jacobian by looping over all sensor elements
+
+As *measurement_vectorFromOperatorPath* but also computes *measurement_jacobian*.
+
+The derivatives by the nodes of *spectral_radiance_operator* are propagated
+through the same steps and node weights as the radiance.  They are then mapped
+to the data of *atmospheric_field*, from which the nodes of the operator were
+taken.
+
+*spectral_radiance_operatorSetJacobian* must have been called with the same
+*jacobian_targets*.
+)--",
+      .author         = {"Richard Larsson"},
+      .out            = {"measurement_vector", "measurement_jacobian"},
+      .in             = {"measurement_sensor",
+                         "spectral_radiance_operator",
+                         "jacobian_targets",
+                         "atmospheric_field",
+                         "ray_path_observer_agenda"},
+      .pass_workspace = true,
+  };
+
   wsm_data["measurement_vectorFromSensor"] = {
       .desc =
           R"--(Sets measurement vector by looping over all sensor elements
@@ -3124,7 +3477,9 @@ Note that this means you only get "half" a Gaussian channel for the outermost ch
 The algorithm finds the pair of angles with the least error in regards to angular zenith and 
 azimuth offset from the sun.  It uses this pair of angles to compute said path.  The algorithm
 is iterative.  It first finds the geometric pair of angles pointing at the sun.  It then
-computes the path, using the space-facing path point's pointing offset relative to the sun
+computes the path, and corrects the angles by secant steps based on the signed zenith and azimuth
+offset of the space-facing path point relative to the sun.  When these steps no longer improve
+the solution, it uses the space-facing path point's pointing offset relative to the sun
 to change the angles in the four directions (up, left, right, down) until it finds a better
 solution.  If no better solution is found, the algorithm it refines the angular search to half
 for every level of refinement above 1, it then stops.
@@ -3136,24 +3491,31 @@ will point close to the horizon.
 The two control parameters are the ``angle_cut`` and ``just_hit``.  The ``angle_cut`` is the limit
 in degrees to which the algorithm should search for a better solution.  The ``just_hit`` is a flag
 that just returns the first time a path hits the sun.
+
+The ``secant_steps`` limits the number of secant steps.  Setting it to 0 skips them, so
+that only the search in the four directions is used.
 )--",
       .author    = {"Richard Larsson"},
       .out       = {"sun_path"},
       .in        = {"surface_field", "ray_path_observer_agenda", "sun"},
-      .gin       = {"pos", "angle_cut", "refinement", "just_hit"},
-      .gin_type  = {"Vector3", "Numeric", "Index", "Index"},
-      .gin_value = {std::nullopt, Numeric{0.0}, Index{1}, Index{0}},
+      .gin       = {"pos", "angle_cut", "refinement", "just_hit", "secant_steps"},
+      .gin_type  = {"Vector3", "Numeric", "Index", "Index", "Index"},
+      .gin_value = {std::nullopt, Numeric{0.0}, Index{1}, Index{0}, Index{8}},
       .gin_desc =
           {"An observer position [alt, lat, lon]",
            "The angle delta-cutoff in the iterative solver [0.0, ...]",
            "The refinement of the search algorithm (twice the power of this is the resultion)",
-           "Whether or not it is enough to just hit the sun or if better accuracy is needed"},
+           "Whether or not it is enough to just hit the sun or if better accuracy is needed",
+           "The maximum number of secant steps before searching in the four directions"},
       .pass_workspace = true,
   };
 
   wsm_data["ray_path_suns_pathFromPathObserver"] = {
       .desc =
           R"--(Wraps *sun_pathFromObserverAgenda* for all paths to all suns.
+
+The search for each path point is warm-started from the solution of the previous
+path point.  Suns at the same position and of the same size share their paths.
 )--",
       .author = {"Richard Larsson"},
       .out    = {"ray_path_suns_path"},
@@ -3530,6 +3892,18 @@ Description of the special input arguments:
     - ``display_progress``:
 
       Controls if there is any screen output. The overall report level is ignored by this WSM.
+
+    - ``processes``:
+
+      If above 1, each execution of *inversion_iterate_agenda* is distributed over
+      this many local worker processes.  *measurement_sensor* is split into
+      groups of consecutive elements sharing frequency and position/line-of-sight grids,
+      and each worker computes its slice of *measurement_vector_fitted* and
+      *measurement_jacobian*.  The agenda must compute these from *measurement_sensor*,
+      e.g., via *measurement_vectorFromSensor*.  Each worker is forked from the
+      calling thread and runs a single OpenMP thread.  Agendas with Python callbacks
+      cannot be distributed, as the callbacks cannot run in the workers and what they
+      change would be lost, so they are an error.  Not available on Windows.
 )",
       .author = {"Patrick Eriksson"},
       .out    = {"model_state_vector",
@@ -3557,7 +3931,8 @@ Description of the special input arguments:
                     "stop_dx",
                     "lm_ga_settings",
                     "clear_matrices",
-                    "display_progress"},
+                    "display_progress",
+                    "processes"},
       .gin_type  = {"String",
                     "Numeric",
                     "Vector",
@@ -3565,6 +3940,7 @@ Description of the special input arguments:
                     "Numeric",
                     "Vector",
                     "Index",
+                    "Index",
                     "Index"},
       .gin_value = {std::nullopt,
                     Numeric{std::numeric_limits<Numeric>::infinity()},
@@ -3573,6 +3949,7 @@ Description of the special input arguments:
                     Numeric{0.01},
                     Vector{},
                     Index{0},
+                    Index{0},
                     Index{0}},
       .gin_desc =
           {"Iteration method. For this and all options below, see further above",
@@ -3582,7 +3959,8 @@ Description of the special input arguments:
            "Stop criterion for iterative inversions",
            "Settings associated with the ga factor of the LM method",
            "An option to save memory",
-           "Flag to control if inversion diagnostics shall be printed on the screen"},
+           "Flag to control if inversion diagnostics shall be printed on the screen",
+           "Number of worker processes for the forward model (0 or 1 is serial)"},
       .pass_workspace = true,
   };
 
@@ -127,13 +127,15 @@ void filename_xml_with_index(String& filename,
 
   \param filename XML filename
   \param type Generic return value
+  \param args Extra arguments passed on to the stream reader
 */
-template <typename T>
+template <typename T, typename... Args>
 void xml_read_from_file(const String& filename,
-                        T& type) requires (std::same_as<T, std::remove_const_t<T>>) {
+                        T& type,
+                        const Args&... args) requires (std::same_as<T, std::remove_const_t<T>>) {
   String xml_file = filename;
   find_xml_file(xml_file);
-  xml_read_from_file_base(xml_file, type);
+  xml_read_from_file_base(xml_file, type, args...);
 }
 
 //! Write data to XML file
@@ -192,6 +192,18 @@ TMPL_XML_READ_WRITE_STREAM(ArrayOfArrayOfMuelmatMatrix)
 
 TMPL_XML_READ_WRITE_STREAM(AtmFunctionalData)
 
+//! Reads only the lines with f0 inside frequency_range
+void xml_read_from_stream(std::istream &,
+                          AbsorptionBand &,
+                          bifstream *,
+                          const Vector2 &frequency_range);
+
+//! Reads only the lines with f0 inside frequency_range, and no empty bands
+void xml_read_from_stream(std::istream &,
+                          AbsorptionBands &,
+                          bifstream *,
+                          const Vector2 &frequency_range);
+
 // Undefine the macro to avoid it being used anywhere else
 #undef TMPL_XML_READ_WRITE_STREAM
 
@@ -16,8 +16,10 @@
 #include "bofstream.h"
 #include "file.h"
 #include "double_imanip.h"
+#include <algorithm>
 #include <iterator>
 #include <string_view>
+#include <vector>
 
 namespace {
 static inline std::string quotation_mark_replacement{"”"};
@@ -514,6 +516,40 @@ void xml_data_parse_error(XMLTag& tag, const String& str_error) {
   throw std::runtime_error(os.str());
 }
 
+//! Reads the ASCII values of a numeric array
+/*!
+  The values are read in bulk.  If not all values can be read, a parse
+  error is thrown with the position of the first bad value.
+
+  \param is_xml  XML Input stream
+  \param data    The contiguous data of the array
+  \param shape   The shape of the array, used for the error message
+  \param tag     XML tag object
+*/
+void xml_parse_numeric_data(std::istream& is_xml,
+                            std::span<Numeric> data,
+                            std::span<const Index> shape,
+                            XMLTag& tag) {
+  const std::size_t n = parse_doubles(is_xml, data);
+  if (n == data.size()) return;
+
+  std::vector<Index> pos(shape.size());
+  Index rem = static_cast<Index>(n);
+  for (std::size_t i = shape.size(); i > 0; i--) {
+    pos[i - 1]  = shape[i - 1] > 0 ? rem % shape[i - 1] : 0;
+    rem        /= std::max<Index>(shape[i - 1], 1);
+  }
+
+  std::ostringstream os;
+  os << " near "
+     << "\n  Element: " << n << "\n  Position: [";
+  for (std::size_t i = 0; i < pos.size(); i++) {
+    os << (i ? ", " : "") << pos[i];
+  }
+  os << ']';
+  xml_data_parse_error(tag, os.str());
+}
+
 //! Reads XML header and root tag
 /*!
   Check whether XML file has correct version tag and reads arts root
@@ -17,6 +17,7 @@
 #include <enumsFileType.h>
 
 #include <memory>
+#include <span>
 
 #include "xml_io_general_types.h"
 
@@ -106,6 +107,11 @@ void xml_parse_error(const String& str_error);
 
 void xml_data_parse_error(XMLTag& tag, const String& str_error);
 
+void xml_parse_numeric_data(std::istream& is_xml,
+                            std::span<Numeric> data,
+                            std::span<const Index> shape,
+                            XMLTag& tag);
+
 void xml_set_stream_precision(std::ostream& os);
 
 void parse_xml_tag_content_as_string(std::istream& is_xml, String& content);
@@ -205,9 +211,12 @@ void xml_open_output_file(ogzstream& file, const String& name);
 
   \param filename XML filename
   \param type Generic return value
+  \param args Extra arguments passed on to the stream reader
 */
-template <typename T>
-void xml_read_from_file_base(const String& filename, T& type) {
+template <typename T, typename... Args>
+void xml_read_from_file_base(const String& filename,
+                             T& type,
+                             const Args&... args) {
   // Open input stream:
   std::unique_ptr<std::istream> ifs;
   if (filename.size() > 2 && filename.substr(filename.length() - 3, 3) == ".gz")
@@ -241,11 +250,12 @@ void xml_read_from_file_base(const String& filename, T& type) {
 
     xml_read_header_from_stream(*ifs, ftype, ntype, etype);
     if (ftype == FileType::ascii) {
-      xml_read_from_stream(*ifs, type, static_cast<bifstream*>(nullptr));
+      xml_read_from_stream(
+          *ifs, type, static_cast<bifstream*>(nullptr), args...);
     } else {
       String bfilename = filename + ".bin";
       bifstream bifs(bfilename.c_str());
-      xml_read_from_stream(*ifs, type, &bifs);
+      xml_read_from_stream(*ifs, type, &bifs, args...);
     }
     xml_read_footer_from_stream(*ifs);
   } catch (const std::runtime_error& e) {
@@ -12,12 +12,16 @@
 #include <workspace.h>
 
 #include <algorithm>
+#include <array>
 #include <concepts>
+#include <cstdint>
+#include <format>
 #include <limits>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <variant>
+#include <vector>
 
 #include "atm.h"
 #include "cloudbox.h"
@@ -445,17 +449,12 @@ void xml_read_from_stream(std::istream& is_xml,
     pbifs->readDoubleArray(reinterpret_cast<Numeric*>(matrix.data_handle()),
                            nrows * ncols);
   } else {
-    for (Index r = 0; r < nrows; r++) {
-      for (Index c = 0; c < ncols; c++) {
-        is_xml >> double_imanip() >> matrix.real()(r, c) >> matrix.imag()(r, c);
-        if (is_xml.fail()) {
-          std::ostringstream os;
-          os << " near "
-             << "\n  Row   : " << r << "\n  Column: " << c;
-          xml_data_parse_error(tag, os.str());
-        }
-      }
-    }
+    xml_parse_numeric_data(
+        is_xml,
+        {reinterpret_cast<Numeric*>(matrix.data_handle()),
+         2 * static_cast<Size>(matrix.size())},
+        std::array<Index, 3>{nrows, ncols, 2},
+        tag);
   }
 
   tag.read_from_stream(is_xml);
@@ -2473,11 +2472,251 @@ void xml_write_to_stream(std::ostream&,
 
 //=== AbsorptionBand =========================================
 
+namespace {
+//! The version of the binary AbsorptionBandData layout
+constexpr Index band_data_binary_version = 2;
+
+template <typename E>
+E read_enum(bifstream& bif) {
+  std::int64_t x;
+  bif >> x;
+  const auto e = static_cast<E>(x);
+  ARTS_USER_ERROR_IF(not good_enum(e), "Invalid enum value {} in binary data", x)
+  return e;
+}
+
+template <typename E>
+void write_enum(bofstream& bof, E e) {
+  bof << static_cast<std::int64_t>(e);
+}
+
+//! Whether f0 is outside the frequency range
+bool outside(const Numeric f0, const Vector2& frequency_range) {
+  return f0 < frequency_range[0] or f0 > frequency_range[1];
+}
+
+//! Reads the quantum numbers and line shape of a line, see write_line_record
+void read_line_record(bifstream& bif,
+                      lbl::line& line,
+                      const std::vector<std::vector<QuantumNumberType>>& schemas) {
+  std::int64_t ischema;
+  bif >> ischema;
+  ARTS_USER_ERROR_IF(ischema < 0 or ischema >= std::ssize(schemas),
+                     "Invalid quantum number schema index {}",
+                     ischema)
+
+  auto& qns = line.qn.val;
+  qns.reserve(schemas[ischema].size());
+  for (auto t : schemas[ischema]) qns.emplace_back(t).read(bif);
+  qns.finalize();
+
+  std::int64_t nspec;
+  bif >> nspec;
+  line.ls.single_models.resize(nspec);
+  for (auto& model : line.ls.single_models) {
+    model.species = read_enum<SpeciesEnum>(bif);
+
+    std::int64_t nvar;
+    bif >> nvar;
+    model.data.reserve(nvar);
+    for (std::int64_t j = 0; j < nvar; j++) {
+      const auto var  = read_enum<LineShapeModelVariable>(bif);
+      const auto type = read_enum<LineShapeModelType>(bif);
+
+      std::int64_t nx;
+      bif >> nx;
+      Vector x(nx);
+      bif.readDoubleArray(x.data_handle(), nx);
+
+      model.data.emplace_back(var, lbl::temperature::data{type, std::move(x)});
+    }
+  }
+}
+
+/** Reads the lines of a band with f0 inside frequency_range
+ *
+ * The band starts with its size in bytes, so that it can be skipped as a
+ * whole.  The data is then stored column-wise.  First the numeric line
+ * parameters, then the flags, and then a table of the distinct sets of
+ * quantum number types of the band.  Last come the sizes in bytes of the line
+ * records, followed by the records with the quantum numbers and line shape
+ * model of each line.  The f0 column decides which lines are kept, and the
+ * records of the other lines are skipped without being parsed.
+ */
+void read_band_lines(bifstream& bif,
+                     std::vector<lbl::line>& lines,
+                     const Size n,
+                     const Vector2& frequency_range) {
+  std::int64_t nbytes;
+  bif >> nbytes;
+  const std::streampos end = bif.pos() + std::streamoff{nbytes};
+
+  lines.clear();
+  if (n == 0) return;
+
+  std::vector<Numeric> column(n);
+  bif.readDoubleArray(column.data(), n);
+
+  std::vector<Size> keep;
+  for (Size i = 0; i < n; i++) {
+    if (not outside(column[i], frequency_range)) keep.push_back(i);
+  }
+
+  if (keep.empty()) {
+    bif.seek(static_cast<long>(end), bifstream::Set);
+    return;
+  }
+
+  lines.resize(keep.size());
+  const auto assign_column = [&](auto&& member) {
+    for (Size k = 0; k < keep.size(); k++) member(lines[k]) = column[keep[k]];
+  };
+  const auto read_column = [&](auto&& member) {
+    bif.readDoubleArray(column.data(), n);
+    assign_column(member);
+  };
+
+  assign_column([](lbl::line& l) -> Numeric& { return l.f0; });
+  read_column([](lbl::line& l) -> Numeric& { return l.a; });
+  read_column([](lbl::line& l) -> Numeric& { return l.e0; });
+  read_column([](lbl::line& l) -> Numeric& { return l.gu; });
+  read_column([](lbl::line& l) -> Numeric& { return l.gl; });
+  read_column([](lbl::line& l) -> Numeric& { return l.z.mdata.gu; });
+  read_column([](lbl::line& l) -> Numeric& { return l.z.mdata.gl; });
+  read_column([](lbl::line& l) -> Numeric& { return l.ls.T0; });
+
+  std::vector<int> flags(n);
+  for (auto& flag : flags) bif >> flag;
+  for (Size k = 0; k < keep.size(); k++) {
+    lines[k].z.on          = flags[keep[k]] & 1;
+    lines[k].ls.one_by_one = flags[keep[k]] & 2;
+  }
+
+  std::int64_t nschema;
+  bif >> nschema;
+  std::vector<std::vector<QuantumNumberType>> schemas(nschema);
+  for (auto& schema : schemas) {
+    std::int64_t ntypes;
+    bif >> ntypes;
+    schema.reserve(ntypes);
+    for (std::int64_t j = 0; j < ntypes; j++) {
+      schema.push_back(read_enum<QuantumNumberType>(bif));
+    }
+  }
+
+  std::vector<std::int64_t> sizes(n);
+  for (auto& size : sizes) bif >> size;
+
+  for (Size i = 0, k = 0; i < n; i++) {
+    if (k < keep.size() and keep[k] == i) {
+      read_line_record(bif, lines[k++], schemas);
+    } else {
+      bif.seek(static_cast<long>(sizes[i]), bifstream::Add);
+    }
+  }
+}
+
+//! Writes the quantum numbers and line shape of a line
+void write_line_record(bofstream& bof,
+                       const lbl::line& line,
+                       const std::int64_t ischema) {
+  bof << ischema;
+  for (auto& v : line.qn.val) v.write(bof);
+
+  bof << static_cast<std::int64_t>(line.ls.single_models.size());
+  for (auto& model : line.ls.single_models) {
+    write_enum(bof, model.species);
+    bof << static_cast<std::int64_t>(model.data.size());
+    for (auto& [var, data] : model.data) {
+      write_enum(bof, var);
+      write_enum(bof, data.Type());
+      bof << static_cast<std::int64_t>(data.X().size());
+      bof.putRaw(reinterpret_cast<const char*>(data.X().data_handle()),
+                 sizeof(Numeric) * data.X().size());
+    }
+  }
+}
+
+/** Writes the lines of a band to the binary stream, see read_band_lines
+ *
+ * The sizes of the band and of the line records are only known once they are
+ * written, so they are written as zeros first and then overwritten.
+ */
+void write_band_lines(bofstream& bof, const std::vector<lbl::line>& lines) {
+  const Size n = lines.size();
+
+  const std::streampos start = bof.pos();
+  bof << std::int64_t{0};
+
+  std::vector<std::int64_t> sizes(n, 0);
+  std::streampos table = start;
+
+  if (n > 0) {
+    std::vector<Numeric> column(n);
+    const auto write_column = [&](auto&& member) {
+      for (Size i = 0; i < n; i++) column[i] = member(lines[i]);
+      bof.putRaw(reinterpret_cast<const char*>(column.data()),
+                 sizeof(Numeric) * n);
+    };
+
+    write_column([](const lbl::line& l) { return l.f0; });
+    write_column([](const lbl::line& l) { return l.a; });
+    write_column([](const lbl::line& l) { return l.e0; });
+    write_column([](const lbl::line& l) { return l.gu; });
+    write_column([](const lbl::line& l) { return l.gl; });
+    write_column([](const lbl::line& l) { return l.z.mdata.gu; });
+    write_column([](const lbl::line& l) { return l.z.mdata.gl; });
+    write_column([](const lbl::line& l) { return l.ls.T0; });
+
+    for (auto& line : lines) {
+      bof << (static_cast<int>(line.z.on) |
+              (static_cast<int>(line.ls.one_by_one) << 1));
+    }
+
+    std::vector<std::vector<QuantumNumberType>> schemas;
+    std::vector<std::int64_t> line_schema(n);
+    std::vector<QuantumNumberType> types;
+    for (Size i = 0; i < n; i++) {
+      types.clear();
+      for (auto& v : lines[i].qn.val) types.push_back(v.type);
+
+      auto ptr       = std::ranges::find(schemas, types);
+      line_schema[i] = std::distance(schemas.begin(), ptr);
+      if (ptr == schemas.end()) schemas.push_back(types);
+    }
+
+    bof << static_cast<std::int64_t>(schemas.size());
+    for (auto& schema : schemas) {
+      bof << static_cast<std::int64_t>(schema.size());
+      for (auto t : schema) write_enum(bof, t);
+    }
+
+    table = bof.pos();
+    for (auto& size : sizes) bof << size;
+
+    for (Size i = 0; i < n; i++) {
+      const std::streampos pos = bof.pos();
+      write_line_record(bof, lines[i], line_schema[i]);
+      sizes[i] = bof.pos() - pos;
+    }
+  }
+
+  const std::streampos end = bof.pos();
+
+  bof.seek(static_cast<long>(start), bofstream::Set);
+  bof << static_cast<std::int64_t>(end - start - std::streamoff{8});
+  if (n > 0) {
+    bof.seek(static_cast<long>(table), bofstream::Set);
+    for (auto& size : sizes) bof << size;
+  }
+  bof.seek(static_cast<long>(end), bofstream::Set);
+}
+}  // namespace
+
 void xml_read_from_stream(std::istream& is_xml,
                           lbl::band_data& data,
-                          bifstream* pbifs) try {
-  ARTS_USER_ERROR_IF(pbifs not_eq nullptr, "No binary data")
-
+                          bifstream* pbifs,
+                          const Vector2& frequency_range) try {
   String tag;
   Index nelem;
 
@@ -2495,10 +2734,41 @@ void xml_read_from_stream(std::istream& is_xml,
 
   open_tag.get_attribute_value("nelem", nelem);
   data.lines.resize(0);
-  data.lines.reserve(nelem);
 
-  for (Index j = 0; j < nelem; j++) {
-    is_xml >> data.lines.emplace_back();
+  if (pbifs) {
+    Index version = 0;
+    if (open_tag.has_attribute("version")) {
+      open_tag.get_attribute_value("version", version);
+    }
+    ARTS_USER_ERROR_IF(
+        version != band_data_binary_version,
+        "Unsupported binary version {} of AbsorptionBandData, expected {}",
+        version,
+        band_data_binary_version)
+
+    //! Bands entirely outside the range are skipped without reading them
+    Numeric f0_min = -std::numeric_limits<Numeric>::infinity();
+    Numeric f0_max = std::numeric_limits<Numeric>::infinity();
+    if (open_tag.has_attribute("f0_min")) {
+      open_tag.get_attribute_value("f0_min", f0_min);
+      open_tag.get_attribute_value("f0_max", f0_max);
+    }
+
+    if (f0_max < frequency_range[0] or f0_min > frequency_range[1]) {
+      std::int64_t nbytes;
+      *pbifs >> nbytes;
+      pbifs->seek(static_cast<long>(nbytes), bifstream::Add);
+    } else {
+      read_band_lines(*pbifs, data.lines, nelem, frequency_range);
+    }
+    ARTS_USER_ERROR_IF(pbifs->fail(), "Error reading binary AbsorptionBandData")
+  } else {
+    //! The text has no index, so all lines are parsed before filtering
+    data.lines.reserve(nelem);
+    for (Index j = 0; j < nelem; j++) {
+      is_xml >> data.lines.emplace_back();
+      if (outside(data.lines.back().f0, frequency_range)) data.lines.pop_back();
+    }
   }
 
   ArtsXMLTag close_tag;
@@ -2507,12 +2777,20 @@ void xml_read_from_stream(std::istream& is_xml,
 }
 ARTS_METHOD_ERROR_CATCH
 
+void xml_read_from_stream(std::istream& is_xml,
+                          lbl::band_data& data,
+                          bifstream* pbifs) {
+  xml_read_from_stream(is_xml,
+                       data,
+                       pbifs,
+                       Vector2{-std::numeric_limits<Numeric>::infinity(),
+                               std::numeric_limits<Numeric>::infinity()});
+}
+
 void xml_write_to_stream(std::ostream& os_xml,
                          const lbl::band_data& data,
                          bofstream* pbofs,
                          const String& name) {
-  ARTS_USER_ERROR_IF(pbofs not_eq nullptr, "No binary data")
-
   ArtsXMLTag open_tag;
   open_tag.set_name("AbsorptionBandData");
   if (name.length()) open_tag.add_attribute("name", name);
@@ -2520,11 +2798,24 @@ void xml_write_to_stream(std::ostream& os_xml,
   open_tag.add_attribute("cutoff_type", String{toString(data.cutoff)});
   open_tag.add_attribute("cutoff_value", data.cutoff_value);
   open_tag.add_attribute("nelem", static_cast<Index>(data.lines.size()));
+  if (pbofs) {
+    open_tag.add_attribute("version", band_data_binary_version);
+    if (not data.lines.empty()) {
+      const auto [f0_min, f0_max] =
+          std::ranges::minmax_element(data.lines, {}, &lbl::line::f0);
+      open_tag.add_attribute("f0_min", std::format("{}", f0_min->f0));
+      open_tag.add_attribute("f0_max", std::format("{}", f0_max->f0));
+    }
+  }
   open_tag.write_to_stream(os_xml);
   os_xml << '\n';
 
-  for (auto& line : data) {
-    os_xml << line << '\n';
+  if (pbofs) {
+    write_band_lines(*pbofs, data.lines);
+  } else {
+    for (auto& line : data) {
+      os_xml << line << '\n';
+    }
   }
 
   ArtsXMLTag close_tag;
@@ -3441,6 +3732,22 @@ void xml_read_from_stream(std::istream& is_xml,
   xml_read_from_stream(is_xml, lt.t_atmref, pbifs);
   xml_read_from_stream(is_xml, lt.xsec, pbifs);
 
+  lt.band_ranges.clear();
+  if (tag.has_attribute("bands")) {
+    ArrayOfQuantumIdentifier bands;
+    Matrix ranges;
+    xml_read_from_stream(is_xml, bands, pbifs);
+    xml_read_from_stream(is_xml, ranges, pbifs);
+    ARTS_USER_ERROR_IF(
+        (ranges.shape() != std::array{static_cast<Index>(bands.size()), 2}),
+        "Bad shape of band ranges {:B,} for {} bands",
+        ranges.shape(),
+        bands.size())
+    for (Size i = 0; i < bands.size(); i++) {
+      lt.band_ranges[bands[i]] = {ranges(i, 0), ranges(i, 1)};
+    }
+  }
+
   if (f) lt.f_grid = std::make_shared<const AscendingGrid>(std::move(fg));
   if (p) lt.log_p_grid = std::make_shared<const DescendingGrid>(std::move(pg));
   if (t) lt.t_pert = std::make_shared<const AscendingGrid>(std::move(tg));
@@ -3469,6 +3776,9 @@ void xml_write_to_stream(std::ostream& os_xml,
   open_tag.add_attribute("p", Index{lt.do_p() ? 1 : 0});
   open_tag.add_attribute("t", Index{lt.do_t() ? 1 : 0});
   open_tag.add_attribute("w", Index{lt.do_w() ? 1 : 0});
+  if (not lt.band_ranges.empty()) {
+    open_tag.add_attribute("bands", static_cast<Index>(lt.band_ranges.size()));
+  }
   open_tag.write_to_stream(os_xml);
   os_xml << '\n';
 
@@ -3495,6 +3805,21 @@ void xml_write_to_stream(std::ostream& os_xml,
   os_xml << '\n';
   xml_write_to_stream(os_xml, lt.xsec, pbofs, "xsec");
 
+  if (not lt.band_ranges.empty()) {
+    ArrayOfQuantumIdentifier bands;
+    Matrix ranges(lt.band_ranges.size(), 2);
+    for (auto& [key, range] : lt.band_ranges) {
+      ranges(bands.size(), 0) = range[0];
+      ranges(bands.size(), 1) = range[1];
+      bands.push_back(key);
+    }
+
+    os_xml << '\n';
+    xml_write_to_stream(os_xml, bands, pbofs, "bands");
+    os_xml << '\n';
+    xml_write_to_stream(os_xml, ranges, pbofs, "band_ranges");
+  }
+
   close_tag.set_name("/AbsorptionLookupTable");
   close_tag.write_to_stream(os_xml);
 }
@@ -12,7 +12,9 @@
 
 #include "xml_io_general_types.h"
 
+#include <array>
 #include <print>
+#include <span>
 
 #include "double_imanip.h"
 #include "matpack_constexpr.h"
@@ -107,17 +109,11 @@ void xml_read_from_stream(std::istream& is_xml,
   if (pbifs) {
     pbifs->readDoubleArray(matrix.data_handle(), nrows * ncols);
   } else {
-    for (Index r = 0; r < nrows; r++) {
-      for (Index c = 0; c < ncols; c++) {
-        is_xml >> double_imanip() >> matrix(r, c);
-        if (is_xml.fail()) {
-          std::ostringstream os;
-          os << " near "
-             << "\n  Row   : " << r << "\n  Column: " << c;
-          xml_data_parse_error(tag, os.str());
-        }
-      }
-    }
+    xml_parse_numeric_data(
+        is_xml,
+        {matrix.data_handle(), static_cast<Size>(matrix.size())},
+        matrix.shape(),
+        tag);
   }
 
   tag.read_from_stream(is_xml);
@@ -303,15 +299,11 @@ void xml_read_from_stream(std::istream& is_xml,
   if (pbifs) {
     pbifs->readDoubleArray(data.data_handle(), nnz);
   } else {
-    for (Index i = 0; i < nnz; i++) {
-      is_xml >> double_imanip() >> data[i];
-      if (is_xml.fail()) {
-        std::ostringstream os;
-        os << " near "
-           << "\n  Data element: " << i;
-        xml_data_parse_error(tag, os.str());
-      }
-    }
+    xml_parse_numeric_data(
+        is_xml,
+        {data.data_handle(), static_cast<Size>(data.size())},
+        std::array<Index, 1>{nnz},
+        tag);
   }
   tag.read_from_stream(is_xml);
   tag.check_name("/SparseData");
@@ -527,20 +519,11 @@ void xml_read_from_stream(std::istream& is_xml,
   if (pbifs) {
     pbifs->readDoubleArray(tensor.data_handle(), npages * nrows * ncols);
   } else {
-    for (Index p = 0; p < npages; p++) {
-      for (Index r = 0; r < nrows; r++) {
-        for (Index c = 0; c < ncols; c++) {
-          is_xml >> double_imanip() >> tensor(p, r, c);
-          if (is_xml.fail()) {
-            std::ostringstream os;
-            os << " near "
-               << "\n  Page  : " << p << "\n  Row   : " << r
-               << "\n  Column: " << c;
-            xml_data_parse_error(tag, os.str());
-          }
-        }
-      }
-    }
+    xml_parse_numeric_data(
+        is_xml,
+        {tensor.data_handle(), static_cast<Size>(tensor.size())},
+        tensor.shape(),
+        tag);
   }
 
   tag.read_from_stream(is_xml);
@@ -610,22 +593,11 @@ void xml_read_from_stream(std::istream& is_xml,
     pbifs->readDoubleArray(tensor.data_handle(),
                            nbooks * npages * nrows * ncols);
   } else {
-    for (Index b = 0; b < nbooks; b++) {
-      for (Index p = 0; p < npages; p++) {
-        for (Index r = 0; r < nrows; r++) {
-          for (Index c = 0; c < ncols; c++) {
-            is_xml >> double_imanip() >> tensor(b, p, r, c);
-            if (is_xml.fail()) {
-              std::ostringstream os;
-              os << " near "
-                 << "\n  Book  : " << b << "\n  Page  : " << p
-                 << "\n  Row   : " << r << "\n  Column: " << c;
-              xml_data_parse_error(tag, os.str());
-            }
-          }
-        }
-      }
-    }
+    xml_parse_numeric_data(
+        is_xml,
+        {tensor.data_handle(), static_cast<Size>(tensor.size())},
+        tensor.shape(),
+        tag);
   }
 
   tag.read_from_stream(is_xml);
@@ -697,25 +669,11 @@ void xml_read_from_stream(std::istream& is_xml,
     pbifs->readDoubleArray(tensor.data_handle(),
                            nshelves * nbooks * npages * nrows * ncols);
   } else {
-    for (Index s = 0; s < nshelves; s++) {
-      for (Index b = 0; b < nbooks; b++) {
-        for (Index p = 0; p < npages; p++) {
-          for (Index r = 0; r < nrows; r++) {
-            for (Index c = 0; c < ncols; c++) {
-              is_xml >> double_imanip() >> tensor(s, b, p, r, c);
-              if (is_xml.fail()) {
-                std::ostringstream os;
-                os << " near "
-                   << "\n  Shelf : " << s << "\n  Book  : " << b
-                   << "\n  Page  : " << p << "\n  Row   : " << r
-                   << "\n  Column: " << c;
-                xml_data_parse_error(tag, os.str());
-              }
-            }
-          }
-        }
-      }
-    }
+    xml_parse_numeric_data(
+        is_xml,
+        {tensor.data_handle(), static_cast<Size>(tensor.size())},
+        tensor.shape(),
+        tag);
   }
 
   tag.read_from_stream(is_xml);
@@ -790,27 +748,11 @@ void xml_read_from_stream(std::istream& is_xml,
         tensor.data_handle(),
         nvitrines * nshelves * nbooks * npages * nrows * ncols);
   } else {
-    for (Index v = 0; v < nvitrines; v++) {
-      for (Index s = 0; s < nshelves; s++) {
-        for (Index b = 0; b < nbooks; b++) {
-          for (Index p = 0; p < npages; p++) {
-            for (Index r = 0; r < nrows; r++) {
-              for (Index c = 0; c < ncols; c++) {
-                is_xml >> double_imanip() >> tensor(v, s, b, p, r, c);
-                if (is_xml.fail()) {
-                  std::ostringstream os;
-                  os << " near "
-                     << "\n  Vitrine: " << v << "\n  Shelf  : " << s
-                     << "\n  Book   : " << b << "\n  Page   : " << p
-                     << "\n  Row    : " << r << "\n  Column : " << c;
-                  xml_data_parse_error(tag, os.str());
-                }
-              }
-            }
-          }
-        }
-      }
-    }
+    xml_parse_numeric_data(
+        is_xml,
+        {tensor.data_handle(), static_cast<Size>(tensor.size())},
+        tensor.shape(),
+        tag);
   }
 
   tag.read_from_stream(is_xml);
@@ -887,30 +829,11 @@ void xml_read_from_stream(std::istream& is_xml,
         tensor.data_handle(),
         nlibraries * nvitrines * nshelves * nbooks * npages * nrows * ncols);
   } else {
-    for (Index l = 0; l < nlibraries; l++) {
-      for (Index v = 0; v < nvitrines; v++) {
-        for (Index s = 0; s < nshelves; s++) {
-          for (Index b = 0; b < nbooks; b++) {
-            for (Index p = 0; p < npages; p++) {
-              for (Index r = 0; r < nrows; r++) {
-                for (Index c = 0; c < ncols; c++) {
-                  is_xml >> double_imanip() >> tensor(l, v, s, b, p, r, c);
-                  if (is_xml.fail()) {
-                    std::ostringstream os;
-                    os << " near "
-                       << "\n  Library: " << l << "\n  Vitrine: " << v
-                       << "\n  Shelf  : " << s << "\n  Book   : " << b
-                       << "\n  Page   : " << p << "\n  Row    : " << r
-                       << "\n  Column : " << c;
-                    xml_data_parse_error(tag, os.str());
-                  }
-                }
-              }
-            }
-          }
-        }
-      }
-    }
+    xml_parse_numeric_data(
+        is_xml,
+        {tensor.data_handle(), static_cast<Size>(tensor.size())},
+        tensor.shape(),
+        tag);
   }
 
   tag.read_from_stream(is_xml);
@@ -978,15 +901,11 @@ void xml_parse_from_stream(std::istream& is_xml,
   if (pbifs) {
     pbifs->readDoubleArray(vector.data_handle(), vector.nelem());
   } else {
-    for (Index n = 0; n < nelem; n++) {
-      is_xml >> double_imanip() >> vector[n];
-      if (is_xml.fail()) {
-        std::ostringstream os;
-        os << " near "
-           << "\n  Element: " << n;
-        xml_data_parse_error(tag, os.str());
-      }
-    }
+    xml_parse_numeric_data(
+        is_xml,
+        {vector.data_handle(), static_cast<Size>(vector.size())},
+        vector.shape(),
+        tag);
   }
 }
 
@@ -1060,8 +979,10 @@ void xml_read_from_stream_tmpl(std::istream& is_xml,
   tag.get_attribute_value("nelem", nelem);
 
   if (pbifs == nullptr) {
-    for (Index i = 0; i < (DIM * ...); i++)
-      is_xml >> double_imanip{} >> group.data[i];
+    xml_parse_numeric_data(is_xml,
+                           std::span<Numeric>{group.data},
+                           std::array<Index, 1>{(DIM * ...)},
+                           tag);
   } else {
     pbifs->readDoubleArray(group.data.data(), (DIM * ...));
   }
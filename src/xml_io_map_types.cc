@@ -80,3 +80,33 @@ void xml_read(std::istream& is_xml,
 TMPL_XML_READ_WRITE_STREAM_MAP(AbsorptionBands)
 TMPL_XML_READ_WRITE_STREAM_MAP(AbsorptionLookupTables)
 TMPL_XML_READ_WRITE_STREAM_MAP(SpeciesEnumVectors)
+
+void xml_read_from_stream(std::istream& is_xml,
+                          AbsorptionBands& map,
+                          bifstream* pbifs,
+                          const Vector2& frequency_range) {
+  const static String valtype{WorkspaceGroupInfo<AbsorptionBand>::name};
+  const static String keytype{WorkspaceGroupInfo<QuantumIdentifier>::name};
+
+  ArtsXMLTag tag;
+  Index nelem;
+
+  tag.read_from_stream(is_xml);
+  tag.check_name("Map");
+  tag.check_attribute("type", valtype);
+  tag.check_attribute("key", keytype);
+
+  tag.get_attribute_value("nelem", nelem);
+  map.clear();
+
+  for (Index n = 0; n < nelem; n++) {
+    QuantumIdentifier key;
+    AbsorptionBand band;
+    xml_read_from_stream(is_xml, key, pbifs);
+    xml_read_from_stream(is_xml, band, pbifs, frequency_range);
+    if (not band.lines.empty()) map[std::move(key)] = std::move(band);
+  }
+
+  tag.read_from_stream(is_xml);
+  tag.check_name("/Map");
+}
@@ -0,0 +1,65 @@
+import pyarts
+import numpy as np
+
+ws = pyarts.Workspace()
+
+# %% O2 lines around 118 GHz, thin in the far wing and thick at the center
+
+ws.absorption_speciesSet(species=["O2-66"])
+ws.ReadCatalogData()
+ws.absorption_bandsSelectFrequency(fmin=118e9, fmax=119e9, by_line=1)
+
+ws.surface_fieldSetPlanetEllipsoid(option="Earth")
+ws.surface_field[pyarts.arts.SurfaceKey("t")] = 295.0
+ws.atmospheric_fieldRead(
+    toa=100e3, basename="planets/Earth/afgl/tropical/", missing_is_zero=1
+)
+
+line_f0 = 118750348044.712
+ws.frequency_grid = [118.05e9, line_f0 - 5e6, line_f0]
+ws.ray_path_observer_agendaSet(option="Geometric")
+ws.spectral_radiance_operatorClearsky1D(altitude_grid=np.linspace(0, 100e3, 201))
+
+# Nadir is thin in the wing and thick at the center, the limb path has its
+# tangent point at about 20 km
+geometries = {
+    "nadir": ([100e3, 0, 0], [180.0, 0.0]),
+    "limb": ([100e3, 0, 0], [99.0, 0.0]),
+}
+
+
+def plain():
+    ws.measurement_vectorFromOperatorPath()
+    return ws.measurement_vector * 1.0
+
+
+def adaptive(**kwargs):
+    err = pyarts.arts.Vector()
+    ws.measurement_vectorFromOperatorPathAdaptive(
+        measurement_vector_error=err, **kwargs
+    )
+    return ws.measurement_vector * 1.0, np.array(err)
+
+
+for name, (pos, los) in geometries.items():
+    ws.measurement_sensorSimple(pos=pos, los=los)
+    y = plain()
+
+    # Without merging and splitting it is the plain operator, also at the cutoff
+    y_a, err = adaptive(optical_depth=0.0, max_depth=0)
+    assert np.allclose(y_a, y, rtol=1e-10, atol=0), f"{name}: {y_a} vs {y}"
+
+    # Merging only, the estimate bounds the difference to the plain operator
+    y_a, err = adaptive(max_depth=0)
+    assert np.any(err > 0), f"{name}: no merged layers"
+    assert np.all(np.abs(y_a - y) <= err + 1e-10 * np.abs(y)), (
+        f"{name}: difference {np.abs(y_a - y)} exceeds the estimate {err}"
+    )
+
+    # Splitting refines the layers of the plain operator
+    y_a, err = adaptive()
+    assert np.allclose(y_a, y, rtol=1e-2, atol=0), f"{name}: {y_a} vs {y}"
+
+    # The stride is capped, so a stride of one merges nothing
+    y_a, err = adaptive(max_depth=0, max_stride=1)
+    assert np.allclose(y_a, y, rtol=1e-10, atol=0), f"{name}: {y_a} vs {y}"
@@ -0,0 +1,74 @@
+import pyarts
+import numpy as np
+
+ws = pyarts.Workspace()
+
+# %% O2 lines around 118 GHz
+
+ws.absorption_speciesSet(species=["O2-66"])
+ws.ReadCatalogData()
+ws.absorption_bandsSelectFrequency(fmin=118e9, fmax=119e9, by_line=1)
+
+ws.surface_fieldSetPlanetEllipsoid(option="Earth")
+ws.surface_field[pyarts.arts.SurfaceKey("t")] = 295.0
+ws.atmospheric_fieldRead(
+    toa=100e3, basename="planets/Earth/afgl/tropical/", missing_is_zero=1
+)
+ws.atmospheric_fieldIGRF(time="2000-03-11 14:39:37")
+
+line_f0 = 118750348044.712
+f_bake = np.linspace(-50e6, 50e6, 11) + line_f0
+f_other = f_bake[:-1] + 1e6
+geometries = [([100e3, 0, 0], [180.0, 0.0]), ([100e3, 0, 0], [120.0, 30.0])]
+
+
+def calc(op, f):
+    return [np.array(op.geometric_planar(f, pos, los)) for pos, los in geometries]
+
+
+def check(ws):
+    ws.spectral_radiance_operatorClearsky1D(altitude_grid=np.linspace(0, 100e3, 51))
+    op = ws.spectral_radiance_operator
+    plain = calc(op, f_bake)
+    other = calc(op, f_other)
+
+    op.bake(f_bake)
+    for a, b in zip(calc(op, f_bake), plain):
+        assert np.allclose(a, b, rtol=1e-10, atol=0), (
+            f"Max relative difference {np.max(np.abs(a[:, 0] / b[:, 0] - 1))}"
+        )
+
+    # Other frequencies are computed by the models
+    for a, b in zip(calc(op, f_other), other):
+        assert np.allclose(a, b, rtol=1e-12, atol=0)
+
+    # The setters remove the tables
+    op.set_continuum_cache([f_bake[0], f_bake[-1]], 0)
+    for a, b in zip(calc(op, f_bake), plain):
+        assert np.allclose(a, b, rtol=1e-12, atol=0)
+
+    return plain
+
+
+# %% Without and with Zeeman splitting
+
+unpolarized = check(ws)
+assert all(np.allclose(x[:, 1:], 0) for x in unpolarized)
+
+ws.absorption_bandsSetZeeman(species="O2-66", fmin=118e9, fmax=119e9)
+polarized = check(ws)
+assert not all(np.allclose(x[:, 1:], 0) for x in polarized)
+
+# %% The Doppler shift depends on the line of sight, so wind cannot be baked
+
+ws.atmospheric_field[pyarts.arts.AtmKey.wind_u] = 10.0
+ws.spectral_radiance_operatorClearsky1D(altitude_grid=np.linspace(0, 100e3, 51))
+ws.spectral_radiance_operator.bake(f_bake)
+
+ws.spectral_radiance_operatorWindShift()
+try:
+    ws.spectral_radiance_operator.bake(f_bake)
+except RuntimeError as e:
+    assert "wind" in str(e), str(e)
+else:
+    assert False, "Baking a node with wind should fail"
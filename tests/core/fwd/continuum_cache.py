@@ -0,0 +1,53 @@
+import pyarts
+import numpy as np
+
+ws = pyarts.Workspace()
+
+# %% Predefined absorption only, no resolved lines between 200 and 300 GHz
+
+ws.absorption_speciesSet(species=["O2-PWR98", "H2O-PWR98"])
+ws.ReadCatalogData()
+
+ws.surface_fieldSetPlanetEllipsoid(option="Earth")
+ws.surface_field[pyarts.arts.SurfaceKey("t")] = 295.0
+ws.atmospheric_fieldRead(
+    toa=100e3, basename="planets/Earth/afgl/tropical/", missing_is_zero=1
+)
+
+ws.spectral_radiance_operatorClearsky1D(altitude_grid=np.linspace(0, 100e3, 51))
+
+f_in = np.linspace(200e9, 300e9, 101)
+f_out = np.array([150e9, 199e9, 301e9, 350e9])
+geometries = [([100e3, 0, 0], [180.0, 0.0]), ([0, 0, 0], [0.0, 0.0])]
+
+
+def calc(op, f):
+    return [np.array(op.geometric_planar(f, pos, los)) for pos, los in geometries]
+
+
+uncached_in = calc(ws.spectral_radiance_operator, f_in)
+uncached_out = calc(ws.spectral_radiance_operator, f_out)
+
+# %% Interpolate the continua over the range of the frequency grid
+
+ws.frequency_grid = f_in
+ws.spectral_radiance_operatorContinuumCache(tolerance=1e-4)
+
+cached_in = calc(ws.spectral_radiance_operator, f_in)
+cached_out = calc(ws.spectral_radiance_operator, f_out)
+
+for a, b in zip(cached_in, uncached_in):
+    assert np.allclose(a, b, rtol=1e-3, atol=0), (
+        f"Max relative difference {np.max(np.abs(a[:, 0] / b[:, 0] - 1))}"
+    )
+
+# Outside the range the models are used as before
+for a, b in zip(cached_out, uncached_out):
+    assert np.allclose(a, b, rtol=1e-12, atol=0)
+
+# %% A non-positive tolerance turns the interpolation off
+
+ws.spectral_radiance_operatorContinuumCache(tolerance=0)
+
+for a, b in zip(calc(ws.spectral_radiance_operator, f_in), uncached_in):
+    assert np.allclose(a, b, rtol=1e-12, atol=0)
@@ -0,0 +1,58 @@
+import pyarts
+import numpy as np
+
+ws = pyarts.Workspace()
+
+# %% Line and continuum absorption around the 118 GHz O2 line
+
+ws.absorption_speciesSet(species=["O2-66", "H2O-PWR98"])
+ws.ReadCatalogData()
+ws.absorption_bandsSelectFrequency(fmin=118e9, fmax=119e9, by_line=1)
+
+ws.surface_fieldSetPlanetEllipsoid(option="Earth")
+ws.surface_field[pyarts.arts.SurfaceKey("t")] = 295.0
+ws.atmospheric_fieldRead(
+    toa=100e3, basename="planets/Earth/afgl/tropical/", missing_is_zero=1
+)
+
+ws.spectral_radiance_operatorClearsky1D(altitude_grid=np.linspace(0, 100e3, 51))
+op = ws.spectral_radiance_operator
+
+freq = np.linspace(-50e6, 50e6, 11) + 118750348044.712
+pos = np.array([[100e3, 0, 0], [100e3, 0, 0], [0, 0, 0], [20e3, 0, 0]])
+los = np.array([[180.0, 0.0], [120.0, 30.0], [0.0, 0.0], [60.0, 0.0]])
+
+ref = np.array([np.array(op.geometric_planar(freq, p, l)) for p, l in zip(pos, los)])
+
+# %% A new output array
+
+out = op.geometric_planar_batch(freq, pos, los)
+assert out.shape == (len(pos), len(freq), 4), out.shape
+assert out.dtype == np.float64, out.dtype
+assert np.allclose(out, ref, rtol=1e-12, atol=0)
+
+# %% A given output array is written into and returned
+
+buf = np.full((len(pos), len(freq), 4), np.nan)
+res = op.geometric_planar_batch(freq, pos, los, out=buf)
+assert np.shares_memory(res, buf)
+assert np.allclose(buf, ref, rtol=1e-12, atol=0)
+
+
+# %% Bad output arrays are rejected
+
+
+def raises(los=los, out=None):
+    try:
+        op.geometric_planar_batch(freq, pos, los, out=out)
+    except (TypeError, RuntimeError):
+        return True
+    return False
+
+
+assert raises(out=np.zeros((len(pos), len(freq) + 1, 4)))
+assert raises(out=np.zeros((len(pos) - 1, len(freq), 4)))
+assert raises(out=np.zeros((len(pos), len(freq), 3)))
+assert raises(out=np.zeros((len(pos), len(freq), 4), dtype=np.float32))
+assert raises(out=np.zeros((len(pos), 4, len(freq))).transpose(0, 2, 1))
+assert raises(los=np.zeros((len(pos) - 1, 2)))
@@ -0,0 +1,66 @@
+import pyarts
+import numpy as np
+
+ws = pyarts.Workspace()
+
+# %% O2 lines around 118 GHz
+
+ws.absorption_speciesSet(species=["O2-66"])
+ws.ReadCatalogData()
+ws.absorption_bandsSelectFrequency(fmin=118e9, fmax=119e9, by_line=1)
+
+ws.surface_fieldSetPlanetEllipsoid(option="Earth")
+ws.surface_field[pyarts.arts.SurfaceKey("t")] = 295.0
+ws.atmospheric_fieldRead(
+    toa=100e3, basename="planets/Earth/afgl/tropical/", missing_is_zero=1
+)
+
+line_f0 = 118750348044.712
+ws.frequency_grid = np.linspace(-50e6, 50e6, 7) + line_f0
+ws.ray_path_observer_agendaSet(option="Geometric")
+ws.spectral_radiance_operatorClearsky1D(altitude_grid=np.linspace(0, 100e3, 11))
+
+zenith_grid = [30.0, 80.0, 100.0, 150.0]
+azimuth_grid = [0.0, 90.0]
+
+
+def fields(ws):
+    planar = pyarts.arts.StokvecGriddedField6()
+    path = pyarts.arts.StokvecGriddedField6()
+    ws.spectral_radiance_fieldFromOperatorPlanarGeometric(
+        spectral_radiance_field=planar,
+        zenith_grid=zenith_grid,
+        azimuth_grid=azimuth_grid,
+    )
+    ws.spectral_radiance_fieldFromOperatorPath(
+        spectral_radiance_field=path,
+        zenith_grid=zenith_grid,
+        azimuth_grid=azimuth_grid,
+    )
+    return np.array(planar.data), np.array(path.data)
+
+
+# %% The blocks of frequencies do not change the result
+
+nthreads = pyarts.arts.globals.omp_get_max_threads()
+planar, path = fields(ws)
+
+pyarts.arts.globals.omp_set_num_threads(1)
+serial_planar, serial_path = fields(ws)
+pyarts.arts.globals.omp_set_num_threads(nthreads)
+
+assert np.array_equal(planar, serial_planar)
+assert np.array_equal(path, serial_path)
+assert not np.allclose(path[..., 0], 0)
+
+# %% Each direction of the path field is the radiance seen from that node
+
+alts = ws.spectral_radiance_operator.altitude()
+for iza, za in enumerate(zenith_grid):
+    for iaa, aa in enumerate(azimuth_grid):
+        for ialt in [0, len(alts) // 2, len(alts) - 1]:
+            ws.measurement_sensorSimple(pos=[alts[ialt], 0, 0], los=[za, aa])
+            ws.measurement_vectorFromOperatorPath()
+            assert np.allclose(
+                ws.measurement_vector, path[iza, iaa, ialt, 0, 0, :, 0], rtol=1e-12
+            ), f"za={za}, aa={aa}, alt={alts[ialt]}"
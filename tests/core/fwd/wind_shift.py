@@ -0,0 +1,46 @@
+import pyarts
+import numpy as np
+
+ws = pyarts.Workspace()
+
+# %% O2 lines around 118 GHz
+
+ws.absorption_speciesSet(species=["O2-66"])
+ws.ReadCatalogData()
+ws.absorption_bandsSelectFrequency(fmin=118e9, fmax=119e9, by_line=1)
+
+ws.surface_fieldSetPlanetEllipsoid(option="Earth")
+ws.surface_field[pyarts.arts.SurfaceKey("t")] = 295.0
+ws.atmospheric_fieldRead(
+    toa=100e3, basename="planets/Earth/afgl/tropical/", missing_is_zero=1
+)
+
+line_f0 = 118750348044.712
+f = np.linspace(-5e6, 5e6, 11) + line_f0
+pos, los = [100e3, 0, 0], [180.0, 0.0]
+
+
+def calc(ws, f, shift):
+    ws.spectral_radiance_operatorClearsky1D(altitude_grid=np.linspace(0, 100e3, 51))
+    if shift:
+        ws.spectral_radiance_operatorWindShift()
+    return np.array(ws.spectral_radiance_operator.geometric_planar(f, pos, los))
+
+
+still = calc(ws, f, False)
+
+# %% The wind does not change the radiance unless the shift is on
+
+w = 100.0
+ws.atmospheric_field[pyarts.arts.AtmKey.wind_w] = w
+
+assert np.array_equal(calc(ws, f, False), still)
+
+# %% Upward looking photons see a uniform vertical wind as a scaled frequency
+
+shifted = calc(ws, f, True)
+assert np.max(np.abs(shifted - still)) > 0
+
+c = pyarts.arts.constants.c
+ws.atmospheric_field[pyarts.arts.AtmKey.wind_w] = 0.0
+assert np.allclose(shifted, calc(ws, f * (1.0 - w / c), False), rtol=1e-12, atol=0)
@@ -0,0 +1,137 @@
+import pyarts
+import numpy as np
+
+NFREQ = 101
+noise = 0.1
+
+ws = pyarts.workspace.Workspace()
+
+# %% Sampled frequency range
+
+line_f0 = 118750348044.712
+ws.frequency_grid = np.linspace(-20e6, 20e6, NFREQ) + line_f0
+
+# %% Species and line absorption
+
+ws.absorption_speciesSet(species=["O2-66"])
+ws.ReadCatalogData()
+ws.absorption_bandsSelectFrequency(fmin=40e9, fmax=120e9, by_line=1)
+ws.absorption_bandsSetZeeman(species="O2-66", fmin=118e9, fmax=119e9)
+ws.WignerInit()
+
+# %% Use the automatic agenda setter for propagation matrix calculations
+ws.propagation_matrix_agendaAuto()
+
+# %% Grids and planet
+
+ws.surface_fieldSetPlanetEllipsoid(option="Earth")
+ws.surface_field[pyarts.arts.SurfaceKey("t")] = 295.0
+ws.atmospheric_fieldRead(
+    toa=120e3, basename="planets/Earth/afgl/tropical/", missing_is_zero=1
+)
+ws.atmospheric_fieldIGRF(time="2000-03-11 14:39:37")
+
+# %% Checks and settings
+
+ws.spectral_radiance_unit = "Tb"
+ws.spectral_radiance_observer_agendaSet(option="EmissionUnits")
+ws.spectral_radiance_space_agendaSet(option="UniformCosmicBackground")
+ws.spectral_radiance_surface_agendaSet(option="Blackbody")
+ws.ray_path_observer_agendaSet(option="Geometric")
+
+# %% Artificial VMR
+
+grid = pyarts.arts.GriddedField3(
+    name="VMR",
+    data=np.ones((3, 1, 1)) * 0.2,
+    grid_names=["Altitude", "Latitude", "Longitude"],
+    grids=[[0, 50e3, 120e3], [0], [0]],
+)
+
+ws.atmospheric_field[pyarts.arts.SpeciesEnum.O2] = grid
+ws.atmospheric_field[pyarts.arts.SpeciesEnum.O2].lat_low = "Nearest"
+ws.atmospheric_field[pyarts.arts.SpeciesEnum.O2].lat_upp = "Nearest"
+ws.atmospheric_field[pyarts.arts.SpeciesEnum.O2].lon_low = "Nearest"
+ws.atmospheric_field[pyarts.arts.SpeciesEnum.O2].lon_upp = "Nearest"
+
+# %% Jacobian
+
+ws.RetrievalInit()
+ws.RetrievalAddSpeciesVMR(species="O2", matrix=np.diag(np.ones((3)) * 5))
+ws.RetrievalFinalizeDiagonal()
+
+# %% Retrieval agenda
+
+@pyarts.workspace.arts_agenda(ws=ws, fix=True)
+def inversion_iterate_agenda(ws):
+    ws.UpdateModelStates()
+    ws.measurement_vectorFromSensor()
+    ws.measurement_vector_fittedFromMeasurement()
+
+# %% Sensor with several groups of independent simulations
+
+pos = [100e3, 0, 0]
+sensor = []
+for za in [180.0, 170.0, 160.0, 150.0]:
+    ws.measurement_sensorSimple(pos=pos, los=[za, 0.0])
+    sensor.extend(ws.measurement_sensor)
+ws.measurement_sensor = pyarts.arts.ArrayOfSensorObsel(sensor)
+
+ws.measurement_vectorFromSensor()
+y = np.array(ws.measurement_vector) + np.random.normal(0, noise, 4 * NFREQ)
+
+ws.atmospheric_field[pyarts.arts.SpeciesEnum.O2].data += 0.1
+ws.model_state_vector_aprioriFromData()
+ws.measurement_vector_error_covariance_matrixConstant(value=noise**2)
+
+# %% Serial and distributed retrievals must agree
+
+results = []
+for processes in [0, 3]:
+    ws.atmospheric_field[pyarts.arts.SpeciesEnum.O2].data = grid
+    ws.atmospheric_field[pyarts.arts.SpeciesEnum.O2].data += 0.1
+    ws.measurement_vector = y
+    ws.measurement_vector_fitted = []
+    ws.model_state_vector = []
+    ws.measurement_jacobian = [[]]
+
+    ws.OEM(method="gn", processes=processes)
+
+    results.append(
+        [
+            np.array(ws.model_state_vector),
+            np.array(ws.measurement_vector_fitted),
+            np.array(ws.measurement_jacobian),
+        ]
+    )
+
+for serial, distributed in zip(*results):
+    assert np.allclose(serial, distributed), "Distributed OEM differs from serial OEM"
+
+# %% Agendas with callbacks cannot be distributed
+
+calls = []
+
+
+def count_call():
+    calls.append(1)
+
+
+@pyarts.workspace.arts_agenda(ws=ws, fix=True)
+def inversion_iterate_agenda(ws):
+    count_call()
+    ws.UpdateModelStates()
+    ws.measurement_vectorFromSensor()
+    ws.measurement_vector_fittedFromMeasurement()
+
+
+ws.measurement_vector_fitted = []
+ws.model_state_vector = []
+ws.measurement_jacobian = [[]]
+try:
+    ws.OEM(method="gn", processes=3)
+except RuntimeError as e:
+    assert "callbacks" in str(e), str(e)
+else:
+    raise AssertionError("Distributed OEM ran an agenda with callbacks")
+assert len(calls) == 0, "The callback ran before the error"
@@ -0,0 +1,101 @@
+import pyarts
+import numpy as np
+
+ws = pyarts.workspace.Workspace()
+
+# %% Sampled frequency range
+
+line_f0 = 118750348044.712
+ws.frequency_grid = np.linspace(-50e6, 50e6, 21) + line_f0
+
+# %% Species and line absorption
+
+ws.absorption_speciesSet(species=["O2-66"])
+ws.ReadCatalogData()
+ws.absorption_bandsSelectFrequency(fmin=118e9, fmax=119e9, by_line=1)
+
+# %% Grids and planet
+
+ws.surface_fieldSetPlanetEllipsoid(option="Earth")
+ws.surface_field[pyarts.arts.SurfaceKey("t")] = 295.0
+ws.atmospheric_fieldRead(
+    toa=100e3, basename="planets/Earth/afgl/tropical/", missing_is_zero=1
+)
+ws.atmospheric_fieldIGRF(time="2000-03-11 14:39:37")
+
+# Profiles on a coarser altitude grid than the operator, so that each level
+# spreads to several operator nodes
+alts = np.linspace(0, 100e3, 6)
+state = {
+    pyarts.arts.AtmKey.t: np.array([290.0, 220.0, 230.0, 260.0, 220.0, 200.0]),
+    pyarts.arts.SpeciesEnum.O2: np.array([0.21, 0.21, 0.2, 0.2, 0.19, 0.18]),
+    pyarts.arts.AtmKey.wind_u: np.array([5.0, 10.0, 20.0, 30.0, 40.0, 50.0]),
+}
+
+
+def set_profile(ws, key, values):
+    ws.atmospheric_field[key] = pyarts.arts.GriddedField3(
+        name="Profile",
+        data=values.reshape(-1, 1, 1),
+        grid_names=["Altitude", "Latitude", "Longitude"],
+        grids=[alts, [0], [0]],
+    )
+    ws.atmospheric_field[key].lat_low = "Nearest"
+    ws.atmospheric_field[key].lat_upp = "Nearest"
+    ws.atmospheric_field[key].lon_low = "Nearest"
+    ws.atmospheric_field[key].lon_upp = "Nearest"
+
+
+for key in state:
+    set_profile(ws, key, state[key])
+
+ws.ray_path_observer_agendaSet(option="Geometric")
+ws.measurement_sensorSimple(pos=[100e3, 0, 0], los=[150.0, 30.0])
+
+# %% Jacobian
+
+ws.jacobian_targetsInit()
+ws.jacobian_targetsAddTemperature(d=0.01)
+ws.jacobian_targetsAddSpeciesVMR(species="O2", d=1e-5)
+ws.jacobian_targetsAddWindField(component="u")
+ws.jacobian_targetsFinalize()
+
+
+def calc(ws):
+    ws.spectral_radiance_operatorClearsky1D(altitude_grid=np.linspace(0, 100e3, 51))
+    ws.spectral_radiance_operatorWindShift()
+    ws.spectral_radiance_operatorSetJacobian()
+    ws.measurement_vectorFromOperatorPathWithJacobian()
+    return ws.measurement_vector * 1.0, ws.measurement_jacobian * 1.0
+
+
+def perturbed(ws, key, level, d):
+    x = state[key].copy()
+    x[level] += d
+    set_profile(ws, key, x)
+    y_p = calc(ws)[0]
+    x[level] -= 2 * d
+    set_profile(ws, key, x)
+    y_m = calc(ws)[0]
+    set_profile(ws, key, state[key])
+    return (y_p - y_m) / (2 * d)
+
+
+# %% Compare analytical and perturbed derivatives of every level
+
+jac = calc(ws)[1]
+assert jac.shape[1] == len(state) * len(alts), jac.shape
+
+steps = {
+    pyarts.arts.AtmKey.t: 0.1,
+    pyarts.arts.SpeciesEnum.O2: 1e-3,
+    pyarts.arts.AtmKey.wind_u: 1.0,
+}
+
+for i, key in enumerate(state):
+    d = np.array([perturbed(ws, key, k, steps[key]) for k in range(len(alts))]).T
+    j = jac[:, i * len(alts) : (i + 1) * len(alts)]
+    assert np.allclose(j, d, rtol=1e-2, atol=1e-3 * np.max(np.abs(d))), (
+        f"Target {key}: max difference {np.max(np.abs(j - d))} "
+        f"of max derivative {np.max(np.abs(d))}"
+    )
@@ -0,0 +1,55 @@
+import pyarts
+import numpy as np
+import tempfile
+import os
+
+ws = pyarts.Workspace()
+
+ws.absorption_speciesSet(species=["O2-66", "H2O-161"])
+ws.ReadCatalogData()
+ws.absorption_bandsSelectFrequency(fmax=1e12)
+
+orig = pyarts.arts.AbsorptionBands(ws.absorption_bands)
+
+with tempfile.TemporaryDirectory() as tmp:
+    ascii_dir = os.path.join(tmp, "ascii")
+    binary_dir = os.path.join(tmp, "binary")
+
+    ws.absorption_bandsSaveSplit(dir=ascii_dir)
+    ws.absorption_bandsSaveSplit(dir=binary_dir, binary=1)
+
+    ws.absorption_bandsReadSplit(dir=ascii_dir)
+    from_ascii = pyarts.arts.AbsorptionBands(ws.absorption_bands)
+
+    ws.absorption_bandsReadSplit(dir=binary_dir)
+    from_binary = pyarts.arts.AbsorptionBands(ws.absorption_bands)
+
+    ws.absorption_bandsReadSplit(dir=binary_dir, frequency_range=[50e9, 70e9])
+    selected = pyarts.arts.AbsorptionBands(ws.absorption_bands)
+
+    ws.absorption_bandsReadSplit(dir=ascii_dir, frequency_range=[50e9, 70e9])
+    selected_ascii = pyarts.arts.AbsorptionBands(ws.absorption_bands)
+
+assert len(from_binary) == len(orig), "Lost bands in binary round-trip"
+assert len(from_ascii) == len(orig), "Lost bands in ascii round-trip"
+
+for key in orig:
+    assert str(from_binary[key]) == str(orig[key]), f"Binary mismatch in {key}"
+    assert str(from_binary[key]) == str(from_ascii[key]), f"Format mismatch in {key}"
+
+assert len(selected) > 0, "No bands in the frequency range"
+for key in selected:
+    f0 = np.array([line.f0 for line in selected[key].lines])
+    assert np.all((f0 >= 50e9) & (f0 <= 70e9)), f"Lines outside range in {key}"
+    assert len(f0) == sum(
+        1 for line in orig[key].lines if 50e9 <= line.f0 <= 70e9
+    ), f"Missing lines in {key}"
+
+# Bands outside the range are skipped, and both formats select the same lines
+in_range = [
+    key for key in orig if any(50e9 <= line.f0 <= 70e9 for line in orig[key].lines)
+]
+assert len(selected) == len(in_range), "Wrong bands selected"
+assert len(selected_ascii) == len(in_range), "Wrong bands selected from ascii"
+for key in in_range:
+    assert str(selected[key]) == str(selected_ascii[key]), f"Format mismatch in {key}"
@@ -0,0 +1,52 @@
+import pyarts
+import numpy as np
+
+ws = pyarts.Workspace()
+
+ws.absorption_speciesSet(species=["O2-66"])
+ws.ReadCatalogData()
+
+bandkey = "O2-66 ElecStateLabel X X Lambda 0 0 S 1 1 v 0 0"
+ws.absorption_bandsSelectFrequency(fmax=120e9)
+ws.absorption_bandsKeepID(id=bandkey)
+ws.absorption_bands[bandkey].lineshape = "VP_ECS_MAKAROV"
+
+ws.WignerInit()
+ws.frequency_grid = np.linspace(40e9, 80e9, 1001)
+ws.jacobian_targetsInit()
+
+ws.atmospheric_pointInit()
+ws.atmospheric_point.temperature = 250
+ws.atmospheric_point.pressure = 1e4
+ws.atmospheric_point[pyarts.arts.SpeciesEnum("O2")] = 0.21
+ws.atmospheric_point[pyarts.arts.SpeciesEnum("N2")] = 0.79
+ws.ray_path_point = pyarts.arts.PropagationPathPoint()
+
+ws.ecs_dataInit()
+ws.ecs_dataAddMakarov2020()
+ws.ecs_dataAddMeanAir(vmrs=[1], species=["N2"])
+
+
+def calc(ws):
+    ws.propagation_matrixInit()
+    ws.propagation_matrixAddLines()
+    return 1.0 * ws.propagation_matrix[:, 0]
+
+
+direct = calc(ws)
+
+ws.ecs_dataAddTabulatedBands(
+    temperatures=np.linspace(150, 350, 41),
+    pressures=np.logspace(2, 5, 13),
+    max_relative_error=1e-2,
+)
+assert bandkey in [str(x) for x in ws.ecs_data.table_errors]
+
+tabulated = calc(ws)
+
+assert np.allclose(tabulated, direct, rtol=1e-2), (
+    f"Max relative difference {np.max(np.abs(tabulated / direct - 1))}"
+)
+
+ws.ecs_dataRemoveTabulatedBands()
+assert np.allclose(calc(ws), direct)
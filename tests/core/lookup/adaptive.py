@@ -0,0 +1,89 @@
+import pyarts
+import numpy as np
+
+toa = 100e3
+
+# %% Setup workspace
+
+ws = pyarts.Workspace()
+
+ws.absorption_speciesSet(species=["CO2-626", "H2O-161"])
+
+ws.ReadCatalogData()
+for key in ws.absorption_bands:
+    ws.absorption_bands[key].cutoff = "ByLine"
+    ws.absorption_bands[key].cutoff_value = 750e9
+
+ws.surface_fieldSetPlanetEllipsoid(option="Earth")
+ws.surface_field["t"] = 295.0
+
+ws.atmospheric_fieldRead(
+    toa=toa, basename="planets/Earth/afgl/tropical/", missing_is_zero=1
+)
+
+v = np.linspace(400, 2500, 101)
+ws.frequency_grid = pyarts.arts.convert.kaycm2freq(v)
+
+# %% Adaptive table from dense candidate grids
+
+alts = np.linspace(0, toa, 101)
+ws.ray_path_atmospheric_point = [ws.atmospheric_field.at(z, 0, 0) for z in alts]
+
+tolerance = 1e-3
+ws.absorption_lookup_tableInit()
+ws.absorption_lookup_tableAdaptive(
+    temperature_perturbation=np.linspace(-30, 30, 33),
+    water_perturbation=np.logspace(-1, 1, 33),
+    water_affected_species=["H2O"],
+    tolerance=tolerance,
+    p_interp_order=5,
+    t_interp_order=4,
+    water_interp_order=4,
+)
+print(ws.report)
+
+for spec in ["CO2", "H2O"]:
+    shape = ws.absorption_lookup_table[spec].xsec.shape
+    candidates = 33 * (33 if spec == "H2O" else 1) * len(alts)
+    assert np.prod(shape[:3]) < candidates, f"{spec}: no nodes saved, {shape}"
+
+# %% Compare with line-by-line away from the nodes
+
+ws.jacobian_targetsInit()
+
+for z in np.linspace(0.5e3, 0.9 * toa, 7):
+    ws.atmospheric_point = ws.atmospheric_field.at(z, 0, 0)
+
+    ws.propagation_matrixInit()
+    ws.propagation_matrixAddLines()
+    lbl = ws.propagation_matrix[:, 0] * 1.0
+
+    ws.propagation_matrixInit()
+    ws.propagation_matrixAddLookup(
+        p_interp_order=5, t_interp_order=4, water_interp_order=4, f_interp_order=0
+    )
+    lut = ws.propagation_matrix[:, 0] * 1.0
+
+    err = np.max(np.abs(lut - lbl)) / np.max(np.abs(lbl))
+    assert err < 10 * tolerance, f"Relative error {err} at {z} m"
+
+# %% A looser tolerance for one species keeps the nodes of the others
+
+shapes = {spec: ws.absorption_lookup_table[spec].xsec.shape for spec in ["CO2", "H2O"]}
+
+ws.absorption_lookup_tableAdaptive(
+    temperature_perturbation=np.linspace(-30, 30, 33),
+    water_perturbation=np.logspace(-1, 1, 33),
+    water_affected_species=["H2O"],
+    tolerance=tolerance,
+    tolerance_species=["CO2"],
+    species_tolerance=[100 * tolerance],
+    p_interp_order=5,
+    t_interp_order=4,
+    water_interp_order=4,
+)
+print(ws.report)
+
+loose = ws.absorption_lookup_table["CO2"].xsec.shape
+assert np.prod(loose[:3]) <= np.prod(shapes["CO2"][:3]), f"{loose} vs {shapes['CO2']}"
+assert ws.absorption_lookup_table["H2O"].xsec.shape == shapes["H2O"]
@@ -0,0 +1,115 @@
+import pyarts
+import numpy as np
+
+toa = 100e3
+
+# %% Setup workspace
+
+ws = pyarts.Workspace()
+
+ws.absorption_speciesSet(species=["CO2-626", "H2O-161"])
+
+ws.ReadCatalogData()
+for key in ws.absorption_bands:
+    ws.absorption_bands[key].cutoff = "ByLine"
+    ws.absorption_bands[key].cutoff_value = 750e9
+
+ws.surface_fieldSetPlanetEllipsoid(option="Earth")
+ws.surface_field["t"] = 295.0
+
+ws.atmospheric_fieldRead(
+    toa=toa, basename="planets/Earth/afgl/tropical/", missing_is_zero=1
+)
+
+atm = [ws.atmospheric_field.at(z, 0, 0) for z in np.linspace(0, toa, 21)]
+f = pyarts.arts.convert.kaycm2freq(np.linspace(400, 2500, 101))
+
+
+def build(atm, f):
+    ws.ray_path_atmospheric_point = atm
+    ws.frequency_grid = f
+    ws.absorption_lookup_tableInit()
+    ws.absorption_lookup_tablePrecomputeAll(
+        temperature_perturbation=np.linspace(-20, 20, 3),
+        water_perturbation=np.logspace(-1, 1, 3),
+        water_affected_species=["H2O"],
+    )
+    return pyarts.arts.AbsorptionLookupTables(ws.absorption_lookup_table)
+
+
+def assert_same(a, b):
+    for spec in b:
+        assert np.allclose(a[spec].xsec, b[spec].xsec, rtol=1e-10, atol=0), spec
+
+
+# %% Modify one band and remove another
+
+original = build(atm, f)
+
+keys = list(ws.absorption_bands.keys())
+band = ws.absorption_bands[keys[0]]
+lines = band.lines
+for line in lines:
+    line.a *= 2
+band.lines = lines
+ws.absorption_bands[keys[0]] = band
+del ws.absorption_bands[keys[1]]
+
+ws.absorption_lookup_table = original
+ws.ray_path_atmospheric_point = atm
+ws.absorption_lookup_tableUpdateBands(changed_bands=[keys[0]])
+updated = pyarts.arts.AbsorptionLookupTables(ws.absorption_lookup_table)
+
+assert any(
+    not np.allclose(updated[spec].xsec, original[spec].xsec) for spec in original
+), "The update changed nothing"
+assert_same(updated, build(atm, f))
+
+# %% Extend pressure and frequency grids
+
+ws.absorption_lookup_table = build(atm[::2], f[::2])
+ws.ray_path_atmospheric_point = atm
+ws.frequency_grid = f
+ws.absorption_lookup_tableExtendGrids()
+extended = pyarts.arts.AbsorptionLookupTables(ws.absorption_lookup_table)
+
+assert_same(extended, build(atm, f))
+
+# %% Retained levels must keep their water VMR
+
+wet = [pyarts.arts.AtmPoint(x) for x in atm]
+wet[0]["H2O"] *= 2
+
+ws.absorption_lookup_table = build(atm[::2], f[::2])
+ws.ray_path_atmospheric_point = wet
+ws.frequency_grid = f
+try:
+    ws.absorption_lookup_tableExtendGrids()
+except RuntimeError as e:
+    assert "water VMR" in str(e), str(e)
+else:
+    assert False, "A changed water VMR should not extend the table"
+
+# %% Narrow cutoffs, the pressure shift moves the lines outside f0 +- cutoff
+
+for key in ws.absorption_bands:
+    ws.absorption_bands[key].cutoff_value = 50e6
+
+band = ws.absorption_bands[keys[0]]
+f0 = max(band.lines, key=lambda line: line.a).f0
+f = f0 + np.linspace(-500e6, 500e6, 201)
+
+original = build(atm, f)
+
+lines = band.lines
+for line in lines:
+    line.a *= 2
+band.lines = lines
+ws.absorption_bands[keys[0]] = band
+
+ws.absorption_lookup_table = original
+ws.ray_path_atmospheric_point = atm
+ws.absorption_lookup_tableUpdateBands(changed_bands=[keys[0]])
+updated = pyarts.arts.AbsorptionLookupTables(ws.absorption_lookup_table)
+
+assert_same(updated, build(atm, f))
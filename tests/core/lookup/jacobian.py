@@ -0,0 +1,96 @@
+import pyarts
+import numpy as np
+
+toa = 100e3
+
+# %% Setup workspace
+
+ws = pyarts.Workspace()
+
+ws.absorption_speciesSet(species=["CO2-626", "H2O-161"])
+
+ws.ReadCatalogData()
+for key in ws.absorption_bands:
+    ws.absorption_bands[key].cutoff = "ByLine"
+    ws.absorption_bands[key].cutoff_value = 750e9
+
+ws.surface_fieldSetPlanetEllipsoid(option="Earth")
+ws.surface_field["t"] = 295.0
+
+ws.atmospheric_fieldRead(
+    toa=toa, basename="planets/Earth/afgl/tropical/", missing_is_zero=1
+)
+
+v = np.linspace(400, 2500, 101)
+ws.frequency_grid = pyarts.arts.convert.kaycm2freq(v)
+f = ws.frequency_grid * 1.0
+
+ws.absorption_lookup_tableSimpleWide(
+    water_affected_species=["H2O"], pressure_range=[1e-2, 1100e2]
+)
+
+# %% Jacobian targets
+
+ws.jacobian_targetsInit()
+ws.jacobian_targetsAddTemperature()
+ws.jacobian_targetsAddPressure()
+ws.jacobian_targetsAddSpeciesVMR(species="H2O")
+ws.jacobian_targetsAddSpeciesVMR(species="CO2")
+ws.jacobian_targetsAddWindField(component="u")
+ws.jacobian_targetsFinalize()
+
+atm = ws.atmospheric_field.at(5e3, 0, 0)
+
+
+def calc(ws, atm, f):
+    ws.atmospheric_point = atm
+    ws.frequency_grid = f
+    ws.propagation_matrixInit()
+    ws.propagation_matrixAddLookup()
+    return ws.propagation_matrix[:, 0] * 1.0, ws.propagation_matrix_jacobian[:, :, 0] * 1.0
+
+
+def perturbed(ws, atm, f, set_value, d):
+    atm_p = pyarts.arts.AtmPoint(atm)
+    atm_m = pyarts.arts.AtmPoint(atm)
+    set_value(atm_p, d)
+    set_value(atm_m, -d)
+    return (calc(ws, atm_p, f)[0] - calc(ws, atm_m, f)[0]) / (2 * d)
+
+
+def add_t(x, d):
+    x.temperature += d
+
+
+def add_p(x, d):
+    x.pressure += d
+
+
+def add_h2o(x, d):
+    x["H2O"] += d
+
+
+def add_co2(x, d):
+    x["CO2"] += d
+
+
+# %% Compare analytical and perturbed derivatives
+
+# The frequency derivative of the interpolation is discontinuous at the table
+# frequencies, so the comparison is done between them
+f_mid = 0.5 * (f[1:] + f[:-1])
+
+x, dx = calc(ws, atm, f_mid)
+
+dx_perturbed = [
+    perturbed(ws, atm, f_mid, add_t, 0.01),
+    perturbed(ws, atm, f_mid, add_p, atm.pressure * 1e-5),
+    perturbed(ws, atm, f_mid, add_h2o, atm["H2O"] * 1e-5),
+    perturbed(ws, atm, f_mid, add_co2, atm["CO2"] * 1e-5),
+    (calc(ws, atm, f_mid + 1e3)[0] - calc(ws, atm, f_mid - 1e3)[0]) / 2e3,
+]
+
+for i, d in enumerate(dx_perturbed):
+    assert np.allclose(dx[i], d, rtol=1e-3, atol=1e-6 * np.max(np.abs(d))), (
+        f"Target {i}: max relative difference {np.max(np.abs(dx[i] / d - 1))}"
+    )
@@ -0,0 +1,105 @@
+import pyarts
+import numpy as np
+
+ws = pyarts.Workspace()
+
+# %% Planet and atmosphere
+
+ws.absorption_speciesSet(species=["O2-66"])
+ws.ReadCatalogData()
+
+ws.surface_fieldSetPlanetEllipsoid(option="Earth")
+ws.surface_field[pyarts.arts.SurfaceKey("t")] = 295.0
+ws.atmospheric_fieldRead(
+    toa=100e3, basename="planets/Earth/afgl/tropical/", missing_is_zero=1
+)
+
+ws.frequency_grid = [pyarts.arts.convert.wavelen2freq(700e-9)]
+ws.sunBlackbody(latitude=30.0, longitude=40.0)
+
+pos = [1e3, 10.0, 20.0]
+
+
+# %% A path bent away from the geometric line-of-sight at the observer
+
+
+def bend(spectral_radiance_observer_line_of_sight):
+    za, aa = np.array(spectral_radiance_observer_line_of_sight)
+    spectral_radiance_observer_line_of_sight = pyarts.arts.Vector2(
+        [za + 0.5 * np.sin(np.deg2rad(za)) ** 2, aa + 0.05 * za]
+    )
+    return spectral_radiance_observer_line_of_sight
+
+
+@pyarts.workspace.arts_agenda(ws=ws, fix=True)
+def ray_path_observer_agenda(ws):
+    bend()
+    ws.ray_pathGeometric(
+        pos=ws.spectral_radiance_observer_position,
+        los=ws.spectral_radiance_observer_line_of_sight,
+        as_observer=1,
+    )
+
+
+def search(**kwargs):
+    ws.sun_pathFromObserverAgenda(pos=pos, refinement=10, **kwargs)
+    ws.spectral_radianceSunOrCosmicBackground()
+    return np.array(ws.sun_path[0].los), np.array(ws.spectral_radiance)
+
+
+# %% The secant steps find the sun of the plain search in the four directions
+
+los, srad = search()
+old_los, old_srad = search(secant_steps=0)
+
+assert np.allclose(srad, old_srad), f"{srad} vs {old_srad}"
+assert np.allclose(los, old_los, atol=0.05), f"{los} vs {old_los}"
+
+ws.spectral_radianceUniformCosmicBackground()
+assert not np.allclose(srad, ws.spectral_radiance), "The sun is not hit"
+
+ws.ray_path_observer_agendaSet(option="Geometric")
+geo_los, geo_srad = search()
+assert np.allclose(srad, geo_srad)
+assert np.abs(los - geo_los).max() > 1.0, f"{los} is not bent from {geo_los}"
+
+# %% Suns at the same place and of the same size share their paths
+
+ws.suns = []
+ws.sunsAddSun(suns=ws.suns)
+ws.sunBlackbody(latitude=30.0, longitude=40.0, temperature=4000.0)
+ws.sunsAddSun(suns=ws.suns)
+ws.sunBlackbody(latitude=-20.0, longitude=60.0)
+ws.sunsAddSun(suns=ws.suns)
+
+ws.ray_pathGeometric(pos=[100e3, 0, 0], los=[120.0, 30.0], max_step=10e3)
+
+
+def same_path(a, b):
+    return len(a) == len(b) and all(
+        np.array_equal(x.pos, y.pos) and np.array_equal(x.los, y.los)
+        for x, y in zip(a, b)
+    )
+
+
+# One thread so that the warm starts do not depend on the number of suns
+nthreads = pyarts.arts.globals.omp_get_max_threads()
+pyarts.arts.globals.omp_set_num_threads(1)
+
+shared = pyarts.arts.ArrayOfArrayOfArrayOfPropagationPathPoint()
+ws.ray_path_suns_pathFromPathObserver(ray_path_suns_path=shared)
+
+# The second sun searched on its own
+ws.suns = []
+ws.sunBlackbody(latitude=30.0, longitude=40.0, temperature=4000.0)
+ws.sunsAddSun(suns=ws.suns)
+alone = pyarts.arts.ArrayOfArrayOfArrayOfPropagationPathPoint()
+ws.ray_path_suns_pathFromPathObserver(ray_path_suns_path=alone)
+
+pyarts.arts.globals.omp_set_num_threads(nthreads)
+
+assert len(shared) == len(ws.ray_path)
+for i in range(len(shared)):
+    assert same_path(shared[i][0], shared[i][1]), i
+    assert same_path(shared[i][1], alone[i][0]), i
+    assert not same_path(shared[i][0], shared[i][2]), i
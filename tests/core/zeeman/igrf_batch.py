@@ -0,0 +1,23 @@
+import pyarts
+import numpy as np
+
+t = pyarts.arts.Time("2017-06-01 00:00:00")
+
+alts = [0.0, 50e3, 100e3]
+lats = [-60.0, 0.0, 45.0]
+lons = [-120.0, 30.0]
+pos = [[alt, lat, lon] for lon in lons for lat in lats for alt in alts]
+
+batch = pyarts.arts.igrf(pos, t=t)
+single = [pyarts.arts.igrf(x, t=t) for x in pos]
+assert np.allclose(batch, single, rtol=1e-12, atol=0)
+
+ws = pyarts.Workspace()
+ws.atmospheric_fieldInit(toa=100e3)
+ws.atmospheric_fieldIGRF(time=t)
+func = [ws.atmospheric_field.at(*x).mag for x in pos]
+assert np.allclose(func, single, rtol=1e-12, atol=0)
+
+ws.atmospheric_fieldIGRF(time=t, alts=alts, lats=lats, lons=lons)
+grid = [ws.atmospheric_field.at(*x).mag for x in pos]
+assert np.allclose(grid, single, rtol=1e-12, atol=0)